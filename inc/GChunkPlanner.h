@@ -0,0 +1,55 @@
+#ifndef __GChunkPlanner_h__
+#define __GChunkPlanner_h__
+
+
+#include <vector>
+#include <ostream>
+
+#include "GConfigFile.h"
+
+
+struct  GChunk
+{
+    std::string inputFile;
+    std::string outputFile;
+    std::string finalOutputFile;
+    Int_t       first;
+    Int_t       last;
+    Bool_t      isMC;
+    Double_t    nEvents;
+};
+
+/**
+ * @brief Splits the files of a GoAT file list into chunks of roughly equal event counts.
+ *
+ *   Acqu files are cut at scaler reads (--first-scaler/--last-scaler), MC files
+ *   without scaler tree at event numbers (--first-event/--last-event).
+ *   Each chunk gets its own output file which can be merged afterwards.
+ *   The arguments given to SetArguments() are passed on to every chunk,
+ *   followed by the file and range options of the chunk, which take
+ *   precedence since BaseConfig() keeps the last value of an option.
+ *   Range options are not passed on, the chunks cover whole files.
+ */
+class  GChunkPlanner : public GConfigFile
+{
+private:
+    Int_t   nChunks;
+    Int_t   eventsPerChunk;
+    std::vector<std::string>    arguments;
+
+            Bool_t  ReadBoundaries(const char* fileName, std::vector<Int_t>& boundaries, Bool_t& isMC);
+    static  void    SplitPath(const std::string& path, std::string& directory, std::string& name);
+
+public:
+    GChunkPlanner();
+    virtual ~GChunkPlanner();
+
+            void    GetArguments(const GChunk& chunk, std::vector<std::string>& args)  const;
+            Bool_t  MakeChunks(std::vector<GChunk>& chunks);
+            Bool_t  Plan(std::ostream& out);
+            void    SetNChunks(const Int_t n)           {nChunks = n;}
+            void    SetEventsPerChunk(const Int_t n)    {eventsPerChunk = n;}
+            void    SetArguments(const int argc, char* argv[]);
+};
+
+#endif
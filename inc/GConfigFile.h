@@ -13,6 +13,12 @@ private:
     std::vector<std::string> inputFileList;
     std::vector<std::string> outputFileList;
 
+    Int_t   firstScaler;
+    Int_t   lastScaler;
+    Int_t   firstEvent;
+    Int_t   lastEvent;
+    std::string stagingDirectory;
+
 protected:
 
 public:
@@ -28,6 +34,15 @@ public:
     const   Int_t   GetNFiles() {return inputFileList.size();}
     std::string GetInputFile(const Int_t i) {return inputFileList.at(i);}
     std::string GetOutputFile(const Int_t i) {return outputFileList.at(i);}
+            Int_t   GetFirstScaler()    const   {return firstScaler;}
+            Int_t   GetLastScaler()     const   {return lastScaler;}
+            Int_t   GetFirstEvent()     const   {return firstEvent;}
+            Int_t   GetLastEvent()      const   {return lastEvent;}
+    const   std::string&    GetStagingDirectory()   const   {return stagingDirectory;}
+            Bool_t  HasScalerRange()    const   {return (firstScaler>=0 || lastScaler>=0);}
+            Bool_t  HasEventRange()     const   {return (firstEvent>=0 || lastEvent>=0);}
+            void    SetScalerRange(const Int_t first, const Int_t last)    {firstScaler = first; lastScaler = last;}
+            void    SetEventRange(const Int_t first, const Int_t last)     {firstEvent = first; lastEvent = last;}
 
     std::string	ReadConfig(const std::string& inputKey, const Int_t instance, const Char_t* configName);
     std::string	ReadConfig(const std::string& inputKey, const Int_t instance)                             {return ReadConfig(inputKey, instance, globalConfigFile.c_str());}
@@ -0,0 +1,70 @@
+#ifndef __GCrystalAngleTable_h__
+#define __GCrystalAngleTable_h__
+
+
+#include "Rtypes.h"
+#include "GDetectorGeometry.h"
+#include "GKinematics.h"
+
+
+/**
+ * @brief Cosine of the opening angle between every pair of crystals.
+ *
+ *   N_CRYSTALS^2 floats (about 5.4 MB), filled by the constructor from
+ *   GDetectorGeometry. With it the invariant mass of two photons is
+ *   sqrt(2 E1 E2 (1 - cos)) with the directions of the central crystals,
+ *   which approximates the cluster directions of the track trees.
+ */
+class  GCrystalAngleTable
+{
+private:
+    Float_t*    cosAngle;
+
+    GCrystalAngleTable(const GCrystalAngleTable&);
+    GCrystalAngleTable& operator=(const GCrystalAngleTable&);
+
+public:
+    GCrystalAngleTable();
+    ~GCrystalAngleTable();
+
+            Float_t GetCosAngle(const Int_t crystal1, const Int_t crystal2)   const   {return cosAngle[crystal1*GDetectorGeometry::N_CRYSTALS + crystal2];}
+    inline  void    PairMass(const Int_t i, const Int_t n, const Int_t* crystal, const Double_t* energy, const GP4* p4, Double_t* out)    const;
+    inline  void    PairMasses(const Int_t n, const Int_t* crystal, const Double_t* energy, const GP4* p4, Double_t* out)    const;
+};
+
+// Like GKinematics::PairMass, out[j-i-1] for j>i. Pairs of two massless
+// particles with known crystals take the table, the others the exact p4.
+void    GCrystalAngleTable::PairMass(const Int_t i, const Int_t n, const Int_t* crystal, const Double_t* energy, const GP4* p4, Double_t* out)   const
+{
+    if(crystal[i] < 0)
+    {
+        GKinematics::PairMass(i, n, p4, out);
+        return;
+    }
+    const Float_t*  row = cosAngle + crystal[i]*GDetectorGeometry::N_CRYSTALS;
+    const Double_t  e2  = 2*energy[i];
+    for(Int_t j=i+1; j<n; j++)
+    {
+        if(crystal[j] < 0)
+            out[j-i-1]  = (p4[i] + p4[j]).M();
+        else
+        {
+            const Double_t  c   = 1 - row[crystal[j]];
+            out[j-i-1]  = c > 0 ? sqrt(e2*energy[j]*c) : 0;
+        }
+    }
+}
+
+// Like GKinematics::PairMasses, all pairs flat and row by row
+void    GCrystalAngleTable::PairMasses(const Int_t n, const Int_t* crystal, const Double_t* energy, const GP4* p4, Double_t* out)   const
+{
+    Int_t   offset  = 0;
+    for(Int_t i=0; i<n; i++)
+    {
+        PairMass(i, n, crystal, energy, p4, out + offset);
+        offset  += n - (i+1);
+    }
+}
+
+
+#endif
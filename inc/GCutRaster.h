@@ -0,0 +1,68 @@
+#ifndef __GCutRaster_h__
+#define __GCutRaster_h__
+
+
+#include <TCutG.h>
+#include "Rtypes.h"
+
+
+#define GCutRaster_CELLS    256         // cells per axis
+#define GCutRaster_WORDS    (GCutRaster_CELLS*GCutRaster_CELLS/64)
+
+/**
+ * @brief TCutG with a precomputed inside/outside bitmap.
+ *
+ *   The bounding box of the polygon is divided into a grid of cells. A
+ *   cell touched by a polygon edge is a boundary cell and is answered by
+ *   TCutG::IsInside, every other cell is entirely inside or outside and is
+ *   answered from the bitmap. Points outside the bounding box are outside.
+ */
+class  GCutRaster
+{
+private:
+    TCutG*      cut;
+    Bool_t      exact;              // degenerate polygon, always use the cut
+    Double_t    xMin;
+    Double_t    xMax;
+    Double_t    yMin;
+    Double_t    yMax;
+    Double_t    xScale;             // cells per unit
+    Double_t    yScale;
+    ULong64_t   inside[GCutRaster_WORDS];
+    ULong64_t   boundary[GCutRaster_WORDS];
+    Int_t       nBoundary;
+
+    GCutRaster(const GCutRaster&);
+    GCutRaster& operator=(const GCutRaster&);
+
+            void    MarkEdge(const Double_t x0, const Double_t y0, const Double_t x1, const Double_t y1);
+
+public:
+    GCutRaster(TCutG* _Cut);
+    ~GCutRaster()   {}
+
+            TCutG*  GetCut()                const   {return cut;}
+            Int_t   GetNBoundaryCells()     const   {return nBoundary;}
+    inline  Bool_t  IsInside(const Double_t x, const Double_t y)    const;
+};
+
+Bool_t  GCutRaster::IsInside(const Double_t x, const Double_t y)    const
+{
+    if(exact)
+        return cut->IsInside(x, y);
+    if(!(x >= xMin && x <= xMax && y >= yMin && y <= yMax))
+        return kFALSE;
+
+    Int_t   ix  = Int_t((x - xMin) * xScale);
+    Int_t   iy  = Int_t((y - yMin) * yScale);
+    if(ix >= GCutRaster_CELLS)  ix  = GCutRaster_CELLS - 1;
+    if(iy >= GCutRaster_CELLS)  iy  = GCutRaster_CELLS - 1;
+    Int_t       cell    = iy*GCutRaster_CELLS + ix;
+    ULong64_t   bit     = 1ULL << (cell & 63);
+    if(boundary[cell >> 6] & bit)
+        return cut->IsInside(x, y);
+    return (inside[cell >> 6] & bit) != 0;
+}
+
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef __GDetectorGeometry_h__
+#define __GDetectorGeometry_h__
+
+
+#include "Rtypes.h"
+
+
+/**
+ * @brief Crystal positions of Crystal Ball and TAPS.
+ *
+ *   The tables are compiled in (src/GDetectorGeometry.cc is generated by
+ *   scripts/MakeGeometry.sh from macros/NaI.dat and macros/BaF2-PbWO4.dat)
+ *   and indexed by a global crystal number: the NaI crystals come first,
+ *   followed by the TAPS crystals. GetCrystal() converts the centralCrystal
+ *   of a track. Positions are in cm, angles in degree like the track trees.
+ */
+class  GDetectorGeometry
+{
+public:
+    enum
+    {
+        N_NaI       = 720,
+        N_TAPS      = 438,
+        TAPS_OFFSET = N_NaI,
+        N_CRYSTALS  = N_NaI + N_TAPS
+    };
+
+    static  const   Double_t    X[N_CRYSTALS];
+    static  const   Double_t    Y[N_CRYSTALS];
+    static  const   Double_t    Z[N_CRYSTALS];
+    static  const   Double_t    Theta[N_CRYSTALS];
+    static  const   Double_t    Phi[N_CRYSTALS];
+    static  const   Double_t    UnitX[N_CRYSTALS];
+    static  const   Double_t    UnitY[N_CRYSTALS];
+    static  const   Double_t    UnitZ[N_CRYSTALS];
+
+    // global crystal number of a central crystal, -1 if it is out of range
+    static  Int_t       GetCrystal(const Int_t centralCrystal, const Bool_t taps)
+    {
+        if(centralCrystal < 0)  return -1;
+        if(taps)                return centralCrystal < N_TAPS ? TAPS_OFFSET + centralCrystal : -1;
+        return centralCrystal < N_NaI ? centralCrystal : -1;
+    }
+    static  Bool_t      IsTAPS(const Int_t crystal)                     {return crystal >= TAPS_OFFSET;}
+    static  Double_t    GetTheta(const Int_t crystal)                   {return Theta[crystal];}
+    static  Double_t    GetPhi(const Int_t crystal)                     {return Phi[crystal];}
+    static  Double_t    GetCosAngle(const Int_t crystal1, const Int_t crystal2)   {return UnitX[crystal1]*UnitX[crystal2] + UnitY[crystal1]*UnitY[crystal2] + UnitZ[crystal1]*UnitZ[crystal2];}
+};
+
+
+#endif
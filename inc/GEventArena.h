@@ -0,0 +1,66 @@
+#ifndef __GEventArena_h__
+#define __GEventArena_h__
+
+
+#include <stddef.h>
+
+#include <Rtypes.h>
+
+
+/**
+ * @brief Bump allocator for per event temporaries.
+ *
+ *   Memory handed out is valid until the next Reset(), which the
+ *   GTreeManager calls once before every event. Nothing is freed or
+ *   destructed individually, so only types without owned resources may
+ *   be placed in the arena. If an event needs more than the current block,
+ *   extra blocks are taken from the heap and merged into one larger block
+ *   at the next Reset(), so after a few events no heap allocations happen.
+ */
+class  GEventArena
+{
+private:
+    Char_t*     block;
+    size_t      size;
+    size_t      used;
+    Char_t*     overflow;           // chain of extra blocks of the current event
+    size_t      overflowUsed;
+    size_t      peak;
+    Long64_t    nAllocations;
+    Long64_t    nHeapAllocations;
+
+    GEventArena(const GEventArena&);
+    GEventArena& operator=(const GEventArena&);
+
+            void*   AllocSlow(const size_t bytes, const size_t align);
+    static  Char_t* AllocHeap(const size_t bytes);
+
+public:
+    GEventArena(const size_t initialSize = 65536);
+    ~GEventArena();
+
+    inline  void*   Alloc(const size_t bytes, const size_t align = 16);
+    template<typename T>
+    inline  T*      Alloc(const Int_t n)        {return (T*)Alloc((n>0 ? n : 1)*sizeof(T), __alignof__(T) > 16 ? __alignof__(T) : 16);}
+            void    Reset();
+
+            size_t      GetSize()               const   {return size;}
+            size_t      GetPeak()               const   {return peak;}
+            Long64_t    GetNAllocations()       const   {return nAllocations;}
+            Long64_t    GetNHeapAllocations()   const   {return nHeapAllocations;}
+};
+
+void*   GEventArena::Alloc(const size_t bytes, const size_t align)
+{
+    nAllocations++;
+    size_t  start   = (used + align - 1) & ~(align - 1);
+    if(start + bytes <= size)
+    {
+        used    = start + bytes;
+        return block + start;
+    }
+    return AllocSlow(bytes, align);
+}
+
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef __GEventBlock_h__
+#define __GEventBlock_h__
+
+
+#include "Rtypes.h"
+#include "GTreeColumn.h"
+#include "GTreeTrack.h"
+
+
+/**
+ * @brief Raw columns of a block of events.
+ *
+ *   The track columns of all events are concatenated, offset[e] is the
+ *   first track of event e and offset[nEvents] the total. Block kernels
+ *   run over all tracks at once and store one flag word per track.
+ *   Compact() drops rejected events together with their tracks, so the
+ *   next stage only sees the survivors.
+ */
+class  GEventBlock
+{
+private:
+    Int_t                   nEvents;
+    Int_t                   nTracks;
+    GTreeColumn<Int_t>      entry;          // input tree entry of every event
+    GTreeColumn<Int_t>      offset;
+    GTreeColumn<Double_t>   energySum;      // trigger CB energy sum
+    GTreeColumn<Int_t>      detectors;
+    GTreeColumn<GTreeReal>  time;
+    GTreeColumn<GTreeReal>  vetoEnergy;
+    GTreeColumn<GTreeReal>  MWPC0Energy;
+    GTreeColumn<GTreeReal>  MWPC1Energy;
+    GTreeColumn<Int_t>      flags;
+
+    GEventBlock(const GEventBlock&);
+    GEventBlock& operator=(const GEventBlock&);
+
+            void    ReserveEvents(const Int_t n);
+            void    ReserveTracks(const Int_t n);
+
+public:
+    GEventBlock();
+    ~GEventBlock()  {}
+
+            void    AddEvent(const UInt_t _Entry, const GTreeTrack& tracks, const Double_t _EnergySum);
+            void    Clear()     {nEvents = 0; nTracks = 0;}
+            void    Compact(const Bool_t* keep);
+
+            Int_t           GetNEvents()                        const   {return nEvents;}
+            Int_t           GetNTracks()                        const   {return nTracks;}
+            Int_t           GetNTracks(const Int_t event)       const   {return offset[event+1] - offset[event];}
+            UInt_t          GetEntry(const Int_t event)         const   {return entry[event];}
+            Int_t           GetOffset(const Int_t event)        const   {return offset[event];}
+            Double_t        GetEnergySum(const Int_t event)     const   {return energySum[event];}
+    const   Int_t*          GetDetectors()                      const   {return detectors;}
+    const   GTreeReal*      GetTime()                           const   {return time;}
+    const   GTreeReal*      GetVetoEnergy()                     const   {return vetoEnergy;}
+    const   GTreeReal*      GetMWPC0Energy()                    const   {return MWPC0Energy;}
+    const   GTreeReal*      GetMWPC1Energy()                    const   {return MWPC1Energy;}
+            Int_t*          GetFlags()                                  {return flags;}
+    const   Int_t*          GetFlags(const Int_t event)         const   {return flags + offset[event];}
+};
+
+
+#endif
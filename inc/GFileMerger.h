@@ -0,0 +1,48 @@
+#ifndef __GFileMerger_h__
+#define __GFileMerger_h__
+
+
+#include <string>
+#include <vector>
+
+#include <TDirectory.h>
+#include <TH1.h>
+
+
+/**
+ * @brief Merges GoAT and physics output files with a parallel tree reduction.
+ *
+ *   Groups of up to fanIn files are merged in forked worker processes, the
+ *   results again in groups, until a single file is left.
+ *   Unlike hadd it knows the GHistLinked output layout:
+ *   - SingleScalerRead_i folders are concatenated (renumbered), not summed,
+ *   - flags (GoAT_File, Physics_File, Sampling_Fraction) are written once,
+ *   - background subtracted results are rebuilt from the merged prompt and
+ *     random windows (corrected and NoScaCor), the merge fails if the
+ *     inputs subtracted with different factors or filled results directly,
+ *   - the scaler trees are checked for continuous event numbers first.
+ */
+class  GFileMerger
+{
+private:
+    Int_t   nWorkers;
+    Int_t   fanIn;
+    Bool_t  force;
+
+            Bool_t  CheckScalerContinuity(const std::vector<std::string>& inputs);
+    static  Bool_t  GetSubtractionFactor(const TH1* result, const TH1* prompt, const TH1* rand, Double_t& factor, Bool_t& defined);
+            Bool_t  RebuildBackgroundSubtraction(const std::vector<TDirectory*>& inputs, TDirectory* output);
+            Bool_t  RebuildResult(TDirectory* output, const TString& name, TH1* prompt, TH1* rand, const Double_t factor);
+            Bool_t  MergeDirectory(const std::vector<TDirectory*>& inputs, TDirectory* output);
+            Bool_t  MergeGroup(const std::vector<std::string>& inputs, const std::string& output);
+            Bool_t  MergeSingleScalerReads(const std::vector<TDirectory*>& inputs, TDirectory* output);
+
+public:
+    GFileMerger(const Int_t NWorkers = 1, const Int_t FanIn = 8);
+    virtual ~GFileMerger();
+
+            Bool_t  Merge(const std::vector<std::string>& inputs, const std::string& output);
+            void    SetForce(const Bool_t value)    {force = value;}
+};
+
+#endif
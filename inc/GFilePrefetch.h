@@ -0,0 +1,43 @@
+#ifndef __GFilePrefetch_h__
+#define __GFilePrefetch_h__
+
+
+#include <string>
+#include <thread>
+#include <atomic>
+
+#include <Rtypes.h>
+
+
+/**
+ * @brief Reads the head and tail of a file in a background thread.
+ *
+ *   Used to warm the page cache with the next input file of a chain
+ *   (file header, key list, streamer info, setupParameters and the
+ *   first baskets) while the current file is still processed.
+ *   No ROOT objects are touched by the background thread.
+ */
+class  GFilePrefetch
+{
+private:
+    std::string         fileName;
+    std::thread         worker;
+    std::atomic<bool>   cancel;
+    Long64_t            headSize;
+    Long64_t            tailSize;
+    std::atomic<Long64_t>   nBytesRead;
+
+            void    Run();
+
+public:
+    GFilePrefetch(const Long64_t head = 64*1024*1024, const Long64_t tail = 8*1024*1024);
+    virtual ~GFilePrefetch();
+
+            Long64_t    GetNBytesRead()     const   {return nBytesRead;}
+            Bool_t      IsRunning()         const   {return worker.joinable();}
+            void        Start(const char* name);
+            void        Stop();
+            void        Wait();
+};
+
+#endif
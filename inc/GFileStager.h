@@ -0,0 +1,61 @@
+#ifndef __GFileStager_h__
+#define __GFileStager_h__
+
+
+#include <string>
+#include <thread>
+#include <mutex>
+#include <vector>
+
+#include <Rtypes.h>
+
+
+/**
+ * @brief Copies input files to and output files from a local staging directory in background threads.
+ *
+ *   Inputs are copied to the staging directory ahead of time (StageIn).
+ *   Outputs are written locally and moved to their final place afterwards
+ *   (StageOut): the copy goes to a temporary name, is verified and renamed
+ *   atomically. The verification compares the size with the local file and
+ *   the Adler-32 checksum of the copy, read back after dropping its pages
+ *   from the page cache, with the one computed while copying. On network
+ *   file systems the client may still serve the read from its own cache.
+ *   The checksum is stored next to the output as <file>.adler32.
+ */
+class  GFileStager
+{
+private:
+    struct  Job
+    {
+        std::string     source;
+        std::string     destination;
+        std::thread     worker;
+        Bool_t          success;
+        UInt_t          checksum;
+    };
+
+    std::string         directory;
+    std::vector<Job*>   stageIn;
+    std::vector<Job*>   stageOut;
+    std::mutex          logMutex;
+
+    static  Bool_t  Copy(const std::string& source, const std::string& destination, UInt_t& checksum);
+    static  Bool_t  Checksum(const std::string& fileName, UInt_t& checksum);
+    static  Long64_t    GetSize(const std::string& fileName);
+            void    RunStageIn(Job* job);
+            void    RunStageOut(Job* job);
+
+public:
+    GFileStager(const std::string& stagingDirectory);
+    virtual ~GFileStager();
+
+    static  UInt_t      Adler32(UInt_t adler, const char* buffer, const size_t length);
+            std::string GetLocalName(const std::string& fileName)   const;
+            void        StageIn(const std::string& fileName);
+            Bool_t      StageOut(const std::string& localName, const std::string& fileName);
+            void        RemoveStagedIn(const std::string& fileName);
+            std::string WaitStageIn(const std::string& fileName);
+            Bool_t      WaitAll();
+};
+
+#endif
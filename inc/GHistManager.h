@@ -31,6 +31,7 @@ public:
     virtual ~GHistManager();
 
     void    ClearLinkedHistograms();
+    void    ScaleLinkedHistograms(const Double_t factor);
     void    WriteLinkedHistograms(TDirectory* dir);
 
     friend  class   GHistLinked;
@@ -55,6 +56,7 @@ public:
             void        Link();
     virtual void        PrepareWriteList(GHistWriteList* arr, const char* name = 0) = 0;
     virtual void        Reset(Option_t* option = "") = 0;
+    virtual void        Scale(Double_t c1 = 1, Option_t* option = "") = 0;
             void        Unlink();
     virtual Int_t       WriteWithoutCalcResult(const char* name = 0, Int_t option = 0, Int_t bufsize = 0) = 0;
     virtual Int_t       Write(const char* name = 0, Int_t option = 0, Int_t bufsize = 0)    {CalcResult(); WriteWithoutCalcResult(name, option, bufsize);}
@@ -0,0 +1,381 @@
+#ifndef __GKinFit_h__
+#define __GKinFit_h__
+
+
+#include <cmath>
+
+#include "Rtypes.h"
+
+
+/**
+ * @brief Constrained least squares fit with fixed sizes.
+ *
+ *   NM measured variables with uncorrelated errors, NU unmeasured
+ *   variables and NC constraints f(y, x) = 0, solved with Lagrange
+ *   multipliers by repeated linearisation. The constraint is any object
+ *   with operator()(const Double_t* y, const Double_t* x, Double_t* f) and
+ *   Jacobian(y, x, Double_t* D, Double_t* E), which fills the derivatives
+ *   by the measured (NC x NM) and unmeasured variables (NC x NU), both row
+ *   major. All matrices are members of compile-time size, so a fit
+ *   allocates nothing.
+ *
+ *   The derivatives of the constraints by the measured variables must have
+ *   full rank. Start() linearises at the measured point and the start of
+ *   the unmeasured variables once; Fit() reuses that first step, also
+ *   after SetMeasured() changed a variable the constraints are linear in
+ *   (e.g. the beam energy for every tagger hit).
+ */
+template<Int_t NM, Int_t NU, Int_t NC>
+class  GKinFit
+{
+private:
+    enum
+    {
+        SIZE_U  = NU > 0 ? NU : 1
+    };
+
+    Double_t    y0[NM];
+    Double_t    sigma2[NM];
+    Double_t    x0[SIZE_U];
+
+    // linearisation
+    Double_t    D[NC][NM];
+    Double_t    E[NC][SIZE_U];
+    Double_t    VD[NC][NC];
+    Double_t    VE[SIZE_U][SIZE_U];
+    Double_t    startD[NC][NM];
+    Double_t    startE[NC][SIZE_U];
+    Double_t    startVD[NC][NC];
+    Double_t    startVE[SIZE_U][SIZE_U];
+    Bool_t      startValid;
+
+    // result
+    Double_t    y[NM];
+    Double_t    x[SIZE_U];
+    Double_t    chi2;
+    Double_t    pull[NM];
+    Int_t       nIterations;
+
+    template<Int_t N>
+    static  Bool_t  Invert(Double_t a[][N]);
+    template<typename C>
+            void    Derivatives(const C& constraint, const Double_t* yA, const Double_t* xA);
+            Bool_t  Factorise();
+
+public:
+    GKinFit()   : startValid(kFALSE), chi2(-1), nIterations(0) {}
+
+    // measured values, their errors and the start of the unmeasured ones
+    template<typename C>
+            Bool_t      Start(const C& constraint, const Double_t* measured, const Double_t* sigma, const Double_t* unmeasured);
+    template<typename C>
+            Bool_t      Fit(const C& constraint, const Int_t maxIterations = 10);
+            void        SetMeasured(const Int_t i, const Double_t value)    {y0[i] = value;}
+
+            Double_t    GetChi2()                       const   {return chi2;}
+            Double_t    GetPull(const Int_t i)          const   {return pull[i];}
+            Double_t    GetMeasured(const Int_t i)      const   {return y[i];}
+            Double_t    GetUnmeasured(const Int_t i)    const   {return x[i];}
+            Int_t       GetNIterations()                const   {return nIterations;}
+};
+
+// Gauss-Jordan with partial pivoting, a is replaced by its inverse
+template<Int_t NM, Int_t NU, Int_t NC>
+template<Int_t N>
+Bool_t  GKinFit<NM, NU, NC>::Invert(Double_t a[][N])
+{
+    Double_t    inv[N][N];
+    for(Int_t r=0; r<N; r++)
+    {
+        for(Int_t k=0; k<N; k++)
+            inv[r][k]   = r == k ? 1 : 0;
+    }
+    for(Int_t c=0; c<N; c++)
+    {
+        Int_t   p   = c;
+        for(Int_t r=c+1; r<N; r++)
+        {
+            if(std::fabs(a[r][c]) > std::fabs(a[p][c]))
+                p   = r;
+        }
+        if(a[p][c] == 0)
+            return kFALSE;
+        for(Int_t k=0; k<N; k++)
+        {
+            Double_t    t   = a[c][k];
+            a[c][k]     = a[p][k];
+            a[p][k]     = t;
+            t           = inv[c][k];
+            inv[c][k]   = inv[p][k];
+            inv[p][k]   = t;
+        }
+        const Double_t  scale   = 1/a[c][c];
+        for(Int_t k=0; k<N; k++)
+        {
+            a[c][k]     *= scale;
+            inv[c][k]   *= scale;
+        }
+        for(Int_t r=0; r<N; r++)
+        {
+            if(r == c)  continue;
+            const Double_t  f   = a[r][c];
+            for(Int_t k=0; k<N; k++)
+            {
+                a[r][k]     -= f*a[c][k];
+                inv[r][k]   -= f*inv[c][k];
+            }
+        }
+    }
+    for(Int_t r=0; r<N; r++)
+    {
+        for(Int_t k=0; k<N; k++)
+            a[r][k] = inv[r][k];
+    }
+    return kTRUE;
+}
+
+template<Int_t NM, Int_t NU, Int_t NC>
+template<typename C>
+void    GKinFit<NM, NU, NC>::Derivatives(const C& constraint, const Double_t* yA, const Double_t* xA)
+{
+    constraint.Jacobian(yA, xA, &D[0][0], &E[0][0]);
+}
+
+// VD = (D V D^T)^-1, VE = (E^T VD E)^-1
+template<Int_t NM, Int_t NU, Int_t NC>
+Bool_t  GKinFit<NM, NU, NC>::Factorise()
+{
+    for(Int_t a=0; a<NC; a++)
+    {
+        for(Int_t b=a; b<NC; b++)
+        {
+            Double_t    s   = 0;
+            for(Int_t i=0; i<NM; i++)
+                s   += D[a][i]*sigma2[i]*D[b][i];
+            VD[a][b] = VD[b][a] = s;
+        }
+    }
+    if(!Invert<NC>(VD))
+        return kFALSE;
+    if(NU == 0)
+        return kTRUE;
+
+    Double_t    VDE[NC][SIZE_U];
+    for(Int_t a=0; a<NC; a++)
+    {
+        for(Int_t u=0; u<NU; u++)
+        {
+            Double_t    s   = 0;
+            for(Int_t b=0; b<NC; b++)
+                s   += VD[a][b]*E[b][u];
+            VDE[a][u]   = s;
+        }
+    }
+    for(Int_t u=0; u<NU; u++)
+    {
+        for(Int_t v=0; v<NU; v++)
+        {
+            Double_t    s   = 0;
+            for(Int_t a=0; a<NC; a++)
+                s   += E[a][u]*VDE[a][v];
+            VE[u][v]    = s;
+        }
+    }
+    return Invert<SIZE_U>(VE);
+}
+
+template<Int_t NM, Int_t NU, Int_t NC>
+template<typename C>
+Bool_t  GKinFit<NM, NU, NC>::Start(const C& constraint, const Double_t* measured, const Double_t* sigma, const Double_t* unmeasured)
+{
+    for(Int_t i=0; i<NM; i++)
+    {
+        y0[i]       = measured[i];
+        sigma2[i]   = sigma[i]*sigma[i];
+    }
+    for(Int_t u=0; u<NU; u++)
+        x0[u]   = unmeasured[u];
+
+    Derivatives(constraint, y0, x0);
+    startValid  = Factorise();
+    if(!startValid)
+        return kFALSE;
+    for(Int_t c=0; c<NC; c++)
+    {
+        for(Int_t i=0; i<NM; i++)
+            startD[c][i]    = D[c][i];
+        for(Int_t u=0; u<NU; u++)
+            startE[c][u]    = E[c][u];
+        for(Int_t b=0; b<NC; b++)
+            startVD[c][b]   = VD[c][b];
+    }
+    for(Int_t u=0; u<NU; u++)
+    {
+        for(Int_t v=0; v<NU; v++)
+            startVE[u][v]   = VE[u][v];
+    }
+    return kTRUE;
+}
+
+// Fit from the point given to Start(). Returns kFALSE if a matrix is singular or the fit does not
+// converge; chi2 is -1 then.
+template<Int_t NM, Int_t NU, Int_t NC>
+template<typename C>
+Bool_t  GKinFit<NM, NU, NC>::Fit(const C& constraint, const Int_t maxIterations)
+{
+    chi2        = -1;
+    nIterations = 0;
+    if(!startValid)
+        return kFALSE;
+
+    for(Int_t i=0; i<NM; i++)
+        y[i]    = y0[i];
+    for(Int_t u=0; u<NU; u++)
+        x[u]    = x0[u];
+
+    Double_t    previous    = -1;
+    for(nIterations=1; nIterations<=maxIterations; nIterations++)
+    {
+        if(nIterations == 1)
+        {
+            for(Int_t c=0; c<NC; c++)
+            {
+                for(Int_t i=0; i<NM; i++)
+                    D[c][i] = startD[c][i];
+                for(Int_t u=0; u<NU; u++)
+                    E[c][u] = startE[c][u];
+                for(Int_t b=0; b<NC; b++)
+                    VD[c][b]    = startVD[c][b];
+            }
+            for(Int_t u=0; u<NU; u++)
+            {
+                for(Int_t v=0; v<NU; v++)
+                    VE[u][v]    = startVE[u][v];
+            }
+        }
+        else
+        {
+            Derivatives(constraint, y, x);
+            if(!Factorise())
+                return kFALSE;
+        }
+
+        // r = f(yA, xA) + D (y0 - yA)
+        Double_t    r[NC];
+        constraint(y, x, r);
+        for(Int_t c=0; c<NC; c++)
+        {
+            for(Int_t i=0; i<NM; i++)
+                r[c]    += D[c][i]*(y0[i] - y[i]);
+        }
+
+        // z = -VE E^T VD r, r += E z
+        if(NU > 0)
+        {
+            Double_t    VDr[NC];
+            for(Int_t a=0; a<NC; a++)
+            {
+                VDr[a]  = 0;
+                for(Int_t b=0; b<NC; b++)
+                    VDr[a]  += VD[a][b]*r[b];
+            }
+            Double_t    ETVDr[SIZE_U];
+            for(Int_t u=0; u<NU; u++)
+            {
+                ETVDr[u]    = 0;
+                for(Int_t a=0; a<NC; a++)
+                    ETVDr[u]    += E[a][u]*VDr[a];
+            }
+            Double_t    z[SIZE_U];
+            for(Int_t u=0; u<NU; u++)
+            {
+                z[u]    = 0;
+                for(Int_t v=0; v<NU; v++)
+                    z[u]    -= VE[u][v]*ETVDr[v];
+                x[u]    += z[u];
+            }
+            for(Int_t c=0; c<NC; c++)
+            {
+                for(Int_t u=0; u<NU; u++)
+                    r[c]    += E[c][u]*z[u];
+            }
+        }
+
+        // lambda = VD r, y = y0 - V D^T lambda, chi2 = lambda r
+        Double_t    lambda[NC];
+        chi2    = 0;
+        for(Int_t a=0; a<NC; a++)
+        {
+            lambda[a]   = 0;
+            for(Int_t b=0; b<NC; b++)
+                lambda[a]   += VD[a][b]*r[b];
+            chi2    += lambda[a]*r[a];
+        }
+        for(Int_t i=0; i<NM; i++)
+        {
+            Double_t    s   = 0;
+            for(Int_t c=0; c<NC; c++)
+                s   += D[c][i]*lambda[c];
+            y[i]    = y0[i] - sigma2[i]*s;
+        }
+
+        if(previous >= 0 && std::fabs(chi2 - previous) < 1e-3*(1 + chi2))
+            break;
+        previous    = chi2;
+    }
+    if(nIterations > maxIterations || !(chi2 >= 0))
+    {
+        chi2    = -1;
+        return kFALSE;
+    }
+
+    // pull = (y0 - y) / sqrt(V - V_fit), V - V_fit = V D^T G D V with
+    // G = VD - VD E VE E^T VD
+    Double_t    G[NC][NC];
+    for(Int_t a=0; a<NC; a++)
+    {
+        for(Int_t b=0; b<NC; b++)
+            G[a][b] = VD[a][b];
+    }
+    if(NU > 0)
+    {
+        Double_t    VDE[NC][SIZE_U];
+        for(Int_t a=0; a<NC; a++)
+        {
+            for(Int_t u=0; u<NU; u++)
+            {
+                VDE[a][u]   = 0;
+                for(Int_t b=0; b<NC; b++)
+                    VDE[a][u]   += VD[a][b]*E[b][u];
+            }
+        }
+        for(Int_t a=0; a<NC; a++)
+        {
+            for(Int_t b=0; b<NC; b++)
+            {
+                Double_t    s   = 0;
+                for(Int_t u=0; u<NU; u++)
+                {
+                    for(Int_t v=0; v<NU; v++)
+                        s   += VDE[a][u]*VE[u][v]*VDE[b][v];
+                }
+                G[a][b] -= s;
+            }
+        }
+    }
+    for(Int_t i=0; i<NM; i++)
+    {
+        Double_t    s   = 0;
+        for(Int_t a=0; a<NC; a++)
+        {
+            for(Int_t b=0; b<NC; b++)
+                s   += D[a][i]*G[a][b]*D[b][i];
+        }
+        const Double_t  v   = sigma2[i]*sigma2[i]*s;
+        pull[i] = v > 0 ? (y0[i] - y[i])/std::sqrt(v) : 0;
+    }
+    return kTRUE;
+}
+
+
+#endif
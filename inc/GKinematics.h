@@ -0,0 +1,153 @@
+#ifndef __GKinematics_h__
+#define __GKinematics_h__
+
+
+#include <cmath>
+
+#include <Rtypes.h>
+#include <TLorentzVector.h>
+
+
+/**
+ * @brief Plain 4-vector for the hot paths.
+ *
+ *   Unlike TLorentzVector it is not a TObject and has no virtual table, so
+ *   arrays of it can be kept in the event arena and the batch functions in
+ *   GKinematics are simple loops the compiler can vectorise. Use
+ *   ToTLorentzVector() where the ROOT interface is needed.
+ */
+template<typename T>
+struct  GP4T
+{
+    T   px;
+    T   py;
+    T   pz;
+    T   e;
+
+    GP4T()                                              : px(0), py(0), pz(0), e(0)    {}
+    GP4T(const T _px, const T _py, const T _pz, const T _e) : px(_px), py(_py), pz(_pz), e(_e)  {}
+    explicit GP4T(const TLorentzVector& v)              : px(v.Px()), py(v.Py()), pz(v.Pz()), e(v.E())  {}
+
+    GP4T    operator+(const GP4T& o)    const   {return GP4T(px+o.px, py+o.py, pz+o.pz, e+o.e);}
+    GP4T    operator-(const GP4T& o)    const   {return GP4T(px-o.px, py-o.py, pz-o.pz, e-o.e);}
+    GP4T&   operator+=(const GP4T& o)           {px+=o.px; py+=o.py; pz+=o.pz; e+=o.e; return *this;}
+    GP4T&   operator-=(const GP4T& o)           {px-=o.px; py-=o.py; pz-=o.pz; e-=o.e; return *this;}
+
+    T       P2()    const   {return px*px + py*py + pz*pz;}
+    T       P()     const   {return std::sqrt(P2());}
+    T       M2()    const   {return e*e - P2();}
+    // same sign convention as TLorentzVector::M()
+    T       M()     const   {T m2 = M2(); return m2 < 0 ? -std::sqrt(-m2) : std::sqrt(m2);}
+    TLorentzVector  ToTLorentzVector()  const   {return TLorentzVector(px, py, pz, e);}
+};
+
+typedef GP4T<Double_t>  GP4;
+typedef GP4T<Float_t>   GP4F;
+
+
+// The masses sum the momentum terms before subtracting them like
+// TLorentzVector::M2(), so in double precision they are bit-identical to
+// the TLorentzVector results.
+namespace   GKinematics
+{
+    // signed square root like TLorentzVector::M()
+    template<typename T>
+    inline  T   SignedSqrt(const T m2)      {return m2 < 0 ? -std::sqrt(-m2) : std::sqrt(m2);}
+
+    // 4-vector from momentum, energy and the sines and cosines of theta and
+    // phi, multiplied as (p*sin(theta))*cos(phi) like GTreeTrack::GetVector()
+    // always did, so the results do not depend on where they are computed
+    template<typename T>
+    inline  GP4T<T> FromAngles(const T p, const T e, const T sinTheta, const T cosTheta, const T sinPhi, const T cosPhi)
+    {
+        return GP4T<T>(p*sinTheta*cosPhi, p*sinTheta*sinPhi, p*cosTheta, e);
+    }
+
+    // 4-vector of a particle from kinetic energy, angles in degree and mass
+    template<typename T>
+    inline  GP4T<T> FromTrack(const T kineticEnergy, const T theta, const T phi, const T mass)
+    {
+        const T th  = theta * T(M_PI/180.);
+        const T ph  = phi   * T(M_PI/180.);
+        const T e   = kineticEnergy + mass;
+        const T p   = std::sqrt(e*e - mass*mass);
+        return FromAngles(p, e, T(std::sin(th)), T(std::cos(th)), T(std::sin(ph)), T(std::cos(ph)));
+    }
+
+    // out[i] = (a[i] + b[i]).M()
+    template<typename T>
+    inline  void    InvariantMass(const Int_t n, const GP4T<T>* __restrict__ a, const GP4T<T>* __restrict__ b, T* __restrict__ out)
+    {
+        for(Int_t i=0; i<n; i++)
+        {
+            const T px  = a[i].px + b[i].px;
+            const T py  = a[i].py + b[i].py;
+            const T pz  = a[i].pz + b[i].pz;
+            const T e   = a[i].e  + b[i].e;
+            out[i]  = SignedSqrt(e*e - (px*px + py*py + pz*pz));
+        }
+    }
+
+    // out[j-i-1] = (p[i] + p[j]).M() for j>i, the pair masses of one particle against the following ones
+    template<typename T>
+    inline  void    PairMass(const Int_t i, const Int_t n, const GP4T<T>* __restrict__ p, T* __restrict__ out)
+    {
+        const GP4T<T>   a   = p[i];
+        for(Int_t j=i+1; j<n; j++)
+        {
+            const T px  = a.px + p[j].px;
+            const T py  = a.py + p[j].py;
+            const T pz  = a.pz + p[j].pz;
+            const T e   = a.e  + p[j].e;
+            out[j-i-1]  = SignedSqrt(e*e - (px*px + py*py + pz*pz));
+        }
+    }
+
+    // all pair masses (p[i] + p[j]).M() for i<j, flat and row by row:
+    // (0,1) (0,2) ... (0,n-1) (1,2) ... , n*(n-1)/2 values
+    template<typename T>
+    inline  void    PairMasses(const Int_t n, const GP4T<T>* __restrict__ p, T* __restrict__ out)
+    {
+        Int_t   offset  = 0;
+        for(Int_t i=0; i<n; i++)
+        {
+            PairMass(i, n, p, out + offset);
+            offset  += n - (i+1);
+        }
+    }
+
+    // missing 4-vector of beam photon along z + target at rest - particle
+    template<typename T>
+    inline  GP4T<T> MissingP4(const T beamEnergy, const T targetMass, const GP4T<T>& particle)
+    {
+        return GP4T<T>(-particle.px, -particle.py, beamEnergy - particle.pz, beamEnergy + targetMass - particle.e);
+    }
+
+    // out[i] = missing mass of one particle for every beam energy
+    template<typename T>
+    inline  void    MissingMass(const Int_t n, const T* __restrict__ beamEnergy, const T targetMass, const GP4T<T>& particle, T* __restrict__ out)
+    {
+        const T pt2 = particle.px*particle.px + particle.py*particle.py;
+        for(Int_t i=0; i<n; i++)
+        {
+            const T pz  = beamEnergy[i] - particle.pz;
+            const T e   = beamEnergy[i] + targetMass - particle.e;
+            out[i]  = SignedSqrt(e*e - (pt2 + pz*pz));
+        }
+    }
+
+    // out[i] = cosine of the opening angle between a[i] and b[i]
+    template<typename T>
+    inline  void    CosOpeningAngle(const Int_t n, const GP4T<T>* __restrict__ a, const GP4T<T>* __restrict__ b, T* __restrict__ out)
+    {
+        for(Int_t i=0; i<n; i++)
+        {
+            const T dot = a[i].px*b[i].px + a[i].py*b[i].py + a[i].pz*b[i].pz;
+            const T nn  = (a[i].px*a[i].px + a[i].py*a[i].py + a[i].pz*a[i].pz) * (b[i].px*b[i].px + b[i].py*b[i].py + b[i].pz*b[i].pz);
+            out[i]  = nn > 0 ? dot / std::sqrt(nn) : T(1);
+        }
+    }
+}
+
+
+#endif
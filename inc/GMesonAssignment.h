@@ -0,0 +1,63 @@
+#ifndef __GMesonAssignment_h__
+#define __GMesonAssignment_h__
+
+
+#include "Rtypes.h"
+
+
+/**
+ * @brief Exact choice of disjoint 2 particle mesons.
+ *
+ *   Takes the candidate pairs of the meson reconstruction and chooses the
+ *   disjoint subset with the most mesons and, among those, the smallest
+ *   sum of squared window distances. Only particles with at least one
+ *   candidate take part; the search removes the lowest open particle,
+ *   either unpaired or with one of its partners, and memoises every subset
+ *   by bit mask. The memo table is kept between events and invalidated by
+ *   a generation counter, so it is never cleared.
+ */
+class  GMesonAssignment
+{
+public:
+    enum
+    {
+        MAX_PARTICLES   = 16
+    };
+
+private:
+    struct  Memo
+    {
+        Double_t    chi2;
+        Int_t       nPairs;
+        Int_t       choice;     // candidate taken for the lowest particle, -1 => unpaired
+        UInt_t      generation;
+    };
+
+    Memo*       memo;
+    UInt_t      generation;
+    Int_t*      compact;        // particle -> bit, -1 if it is in no candidate
+    Int_t       compactCapacity;
+
+    Int_t       nEdges[MAX_PARTICLES];
+    Int_t       edgePartner[MAX_PARTICLES][MAX_PARTICLES];
+    Int_t       edgeCandidate[MAX_PARTICLES][MAX_PARTICLES];
+    Double_t    edgeChi2[MAX_PARTICLES][MAX_PARTICLES];
+
+    GMesonAssignment(const GMesonAssignment&);
+    GMesonAssignment& operator=(const GMesonAssignment&);
+
+    const Memo& Solve(const UInt_t open);
+
+public:
+    GMesonAssignment();
+    ~GMesonAssignment();
+
+    // nParticles particles, nCandidates pairs (first, second) with window
+    // distance diff. chosen[c] marks the candidates of the best assignment.
+    // Returns kFALSE, and chooses nothing, if more than MAX_PARTICLES
+    // particles are in candidates.
+            Bool_t  Run(const Int_t nParticles, const Int_t nCandidates, const Int_t* first, const Int_t* second, const Double_t* diff, Bool_t* chosen);
+};
+
+
+#endif
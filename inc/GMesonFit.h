@@ -0,0 +1,67 @@
+#ifndef __GMesonFit_h__
+#define __GMesonFit_h__
+
+
+#include "GTreeTrack.h"
+#include "GTreeTagger.h"
+#include "GTreeMeson.h"
+#include "GKinFit.h"
+
+#include <vector>
+
+
+/**
+ * @brief Kinematic fits of the reconstructed 2 photon mesons.
+ *
+ *   Every meson with two photons or rootinos is fitted to its nominal mass
+ *   (6 measured variables, 1 constraint). If the event holds nothing else
+ *   than up to MAX_MESONS such mesons and at most one recoil nucleon, the
+ *   whole event is fitted to beam + target -> mesons + recoil with the
+ *   unmeasured recoil momentum for every tagger hit (4 + number of mesons
+ *   constraints), and the best tagger hit is kept. The photons are
+ *   measured by energy, theta and phi with fixed resolutions of Crystal
+ *   Ball and TAPS, the beam energy with the tagger resolution (MeV). The
+ *   target (and recoil) mass is the proton mass unless configured.
+ */
+class  GMesonFit
+{
+public:
+    enum
+    {
+        MAX_MESONS  = 3
+    };
+
+private:
+    Double_t    targetMass;
+    Double_t    beamResolution;
+    GKinFit<6, 0, 1>        mesonFit;
+    std::vector<Double_t>   beam;
+
+    template<Int_t K>
+            Int_t   FitEvent(const Double_t* mass, const Double_t* measured, const Double_t* sigma, const Int_t nBeam, const Double_t* beamEnergy, Double_t& chi2, Double_t* pulls);
+
+public:
+    GMesonFit(const Double_t _TargetMass = MASS_PROTON, const Double_t _BeamResolution = 2.0);
+
+    // energy (MeV), theta and phi (rad) errors of a photon
+    static  void    Resolution(const Double_t energy, const Double_t theta, const Bool_t taps, Double_t* sigma);
+
+    // one meson: measured holds energy, theta and phi of both photons,
+    // chi2, pulls and iterations are left in GetMesonFit()
+            Bool_t  FitMeson(const Double_t mass, const Double_t* measured, const Double_t* sigma);
+    const   GKinFit<6, 0, 1>&   GetMesonFit()   const   {return mesonFit;}
+    // nMesons mesons (6 measured values each as in FitMeson) for every beam
+    // energy. Returns the index of the one with the smallest chi2, -1 if no
+    // fit converged. pulls, if not 0, get the 6*nMesons+1 pulls of that fit,
+    // the beam energy last.
+            Int_t   FitEvent(const Int_t nMesons, const Double_t* mass, const Double_t* measured, const Double_t* sigma, const Int_t nBeam, const Double_t* beamEnergy, Double_t& chi2, Double_t* pulls = 0);
+
+    // nTrees meson trees with their nominal masses, tagger may be 0
+            void    Fit(GTreeTrack* tracks, GTreeTagger* tagger, const Int_t nTrees, GTreeMeson** trees, const Double_t* masses, const Bool_t exclusive);
+
+            Double_t    GetTargetMass()     const   {return targetMass;}
+            Double_t    GetBeamResolution() const   {return beamResolution;}
+};
+
+
+#endif
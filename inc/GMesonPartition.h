@@ -0,0 +1,103 @@
+#ifndef __GMesonPartition_h__
+#define __GMesonPartition_h__
+
+
+#include <limits>
+
+#include "Rtypes.h"
+
+
+/**
+ * @brief Best partition of N particles into N/2 two particle mesons.
+ *
+ *   chi2 is the N*N matrix of the pair chi2 (infinity for pairs outside
+ *   every meson window). The search always pairs the lowest open particle
+ *   and cuts a branch as soon as its partial chi2 plus a lower bound for
+ *   the open particles (half of the smallest chi2 each of them can reach)
+ *   is not better than the best partition found so far. N is a template
+ *   argument so the masks and loops are fixed at compile time; Find()
+ *   dispatches the supported sizes.
+ */
+template<Int_t N>
+class  GMesonPartition
+{
+private:
+    const Double_t* chi2;
+    Double_t    bound[N];
+    Int_t       partner[N];
+    Int_t*      bestPartner;
+    Double_t    best;
+
+    Double_t    Bound(UInt_t open)  const
+    {
+        Double_t    sum = 0;
+        for(; open; open &= open-1)
+            sum += bound[__builtin_ctz(open)];
+        return sum;
+    }
+
+    void        Search(const UInt_t open, const Double_t sum)
+    {
+        if(!open)
+        {
+            best    = sum;
+            for(Int_t i=0; i<N; i++)
+                bestPartner[i]  = partner[i];
+            return;
+        }
+        const Int_t     i       = __builtin_ctz(open);
+        const UInt_t    others  = open & ~(1u << i);
+        for(UInt_t m=others; m; m &= m-1)
+        {
+            const Int_t     j       = __builtin_ctz(m);
+            const UInt_t    rest    = others & ~(1u << j);
+            const Double_t  partial = sum + chi2[i*N + j];
+            if(partial + Bound(rest) >= best)  continue;
+            partner[i]  = j;
+            partner[j]  = i;
+            Search(rest, partial);
+        }
+    }
+
+public:
+    // total chi2 of the best partition and its partner of every particle,
+    // infinity if there is none
+    Double_t    Run(const Double_t* _chi2, Int_t* _partner)
+    {
+        chi2        = _chi2;
+        bestPartner = _partner;
+        best        = std::numeric_limits<Double_t>::infinity();
+        for(Int_t i=0; i<N; i++)
+        {
+            bound[i]    = std::numeric_limits<Double_t>::infinity();
+            for(Int_t j=0; j<N; j++)
+            {
+                if(j != i && chi2[i*N + j] < bound[i])
+                    bound[i]    = chi2[i*N + j];
+            }
+            bound[i]    *= 0.5;
+        }
+        Search((1u << N) - 1, 0);
+        return best;
+    }
+};
+
+namespace   GMesonPartitionSearch
+{
+    inline  Bool_t  IsSupported(const Int_t n)  {return n == 4 || n == 6 || n == 8;}
+
+    // GMesonPartition<n>::Run for the supported sizes, infinity otherwise
+    inline  Double_t    Find(const Int_t n, const Double_t* chi2, Int_t* partner)
+    {
+        switch(n)
+        {
+        case 4: {GMesonPartition<4> search; return search.Run(chi2, partner);}
+        case 6: {GMesonPartition<6> search; return search.Run(chi2, partner);}
+        case 8: {GMesonPartition<8> search; return search.Run(chi2, partner);}
+        }
+        return std::numeric_limits<Double_t>::infinity();
+    }
+}
+
+
+#endif
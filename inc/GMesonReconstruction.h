@@ -3,6 +3,10 @@
 
 
 #include "GTreeManager.h"
+#include "GCrystalAngleTable.h"
+#include "GMesonPartition.h"
+#include "GMesonAssignment.h"
+#include "GMesonFit.h"
 
 #define DEFAULT_WIDTH_NEUTRAL_PION 20.0
 #define DEFAULT_WIDTH_ETA 44.0
@@ -11,7 +15,22 @@
 
 class  GMesonReconstruction  : virtual public GTreeManager
 {
+protected:
+    enum
+    {
+        MESON_NONE      = 0,
+        MESON_PI0       = 1,
+        MESON_ETA       = 2,
+        MESON_ETA_PRIME = 3
+    };
+
 private:
+    Double_t	massNeutralPion;
+    Double_t	massEta;
+    Double_t	massEtaPrime;
+    Int_t       pdgPhoton;
+    Int_t       pdgChargedPion;
+
     Double_t	widthNeutralPion;
     Double_t	widthEta;
     Double_t	widthEtaPrime;
@@ -19,7 +38,16 @@ private:
     Double_t	mesonThetaMin;
     Double_t	mesonThetaMax;
 
+    GCrystalAngleTable* crystalAngles;  // 0 => exact pair angles
+    Bool_t      usePartition;
+    GMesonAssignment*   assignment;     // 0 => greedy choice of the 2 particle mesons
+    GMesonFit*  fitter;                 // 0 => no kinematic fit
+
+            Bool_t  ReconstructMesons();
+
 protected:
+            void    ClassifyPairs(const Int_t nPairs, const Double_t* mass, Int_t* type, Double_t* diff)  const;
+    static  Int_t   CompactPairs(const Int_t n, const Int_t* pairType, const Double_t* pairDiff, Int_t* index1, Int_t* index2, Int_t* type, Double_t* diff);
 
             Bool_t  ProcessEventWithoutFilling();
     virtual void    ProcessEvent();
@@ -5,6 +5,7 @@
 
 
 #include "GDataChecks.h"
+#include "GCutRaster.h"
 
 #define	PDG_ROOTINO 0
 
@@ -23,7 +24,57 @@ public:
         ReconstructAllProtons   = 64
     };
 
+    enum Species
+    {
+        SpeciesRootino      = 0,
+        SpeciesPhoton       = 1,
+        SpeciesProton       = 2,
+        SpeciesChargedPion  = 3,
+        SpeciesElectron     = 4,
+        SpeciesNeutron      = 5,
+        SpeciesCount        = 6
+    };
+
 private:
+    // per track result of the pre-pass over all tracks (ClassifyTracks)
+    enum TrackFlag
+    {
+        FlagCB          = 1,
+        FlagTAPS        = 2,
+        FlagTimeCB      = 4,    // inside the CB time cut
+        FlagTimeTAPS    = 8,
+        FlagChargeCB    = 16,   // energy in PID, MWPC0 or MWPC1 unless ignored
+        FlagChargeTAPS  = 32    // energy in the Veto unless ignored
+    };
+
+    // outcome of a rule program for one track
+    enum RuleResult
+    {
+        RuleDone    = 0,        // species decided
+        RuleOpen    = 1,        // species from the dE-E cuts, other detectors may still override
+        RuleStop    = 2,        // charged track outside the theta range, stops the track loop
+        RuleReject  = 3         // outside the time cut, rejects the event
+    };
+
+    // Particle identification of one detector, compiled by Init() from the
+    // configured cuts. Only the configured steps are stored, and the dE-E
+    // cuts are ordered so the first match is the one that used to win.
+    // The polygon cuts are rasterised (see GCutRaster).
+    struct  RuleProgram
+    {
+        Int_t       fixed;                  // species of all tracks, -1 => apply the cuts
+        Int_t       timeFlag;               // TrackFlag of the detector
+        Int_t       chargeFlag;
+        Int_t       nHadronCuts;
+        GCutRaster* hadronCut[2];
+        Bool_t      hadronClusterSize[2];   // kFALSE => time of flight cut
+        Int_t       nSpeciesCuts;
+        GCutRaster* speciesCut[3];
+        Int_t       species[3];
+
+        RuleProgram() : nHadronCuts(0), nSpeciesCuts(0)    {}
+    };
+
 	std::string config;
 
     ReconstructType   typeCB;
@@ -44,9 +95,9 @@ private:
     Double_t	chargedThetaMin;
     Double_t	chargedThetaMax;
 
-    Int_t* 		identified;
-    Int_t* 		charge;
-    Int_t* 		hadron;
+    RuleProgram programCB;
+    RuleProgram programTAPS;
+    Double_t    speciesMass[SpeciesCount];
 
     Bool_t 		chargeIgnorePID;
     Bool_t 		chargeIgnoreMWPC0;
@@ -63,9 +114,13 @@ private:
 
     TCutG*	OpenCutFile(Char_t* filename, Char_t* cutname);
     Bool_t  Trigger();
+    void    Compile(RuleProgram& program, const ReconstructType type, const Bool_t cb);
+    void    Release(RuleProgram& program);
+            RuleResult  Identify(const RuleProgram& program, const Int_t track, const Int_t flags, Int_t& species) const;
 
 protected:
-            Bool_t  ProcessEventWithoutFilling();
+            void    ClassifyTracks(const Int_t n, const Int_t* detectors, const GTreeReal* time, const GTreeReal* vetoEnergy, const GTreeReal* MWPC0Energy, const GTreeReal* MWPC1Energy, Int_t* flags) const;
+            Bool_t  ProcessEventWithoutFilling(const Int_t* trackFlags = 0);
     virtual void    ProcessEvent();
     virtual Bool_t  Start();
 
@@ -0,0 +1,98 @@
+#ifndef __GReclustering_h__
+#define __GReclustering_h__
+
+
+#include "Rtypes.h"
+#include "GDetectorGeometry.h"
+#include "GTreeTrack.h"
+#include "GTreeDetectorHits.h"
+
+
+/**
+ * @brief Merging of split-off clusters and splitting of overlapping
+ *        clusters from the crystal hit patterns.
+ *
+ *   The neighbour tables of Crystal Ball and TAPS are built once from
+ *   GDetectorGeometry: crystals of the same detector whose opening angle is
+ *   below NEIGHBOUR_CB (NEIGHBOUR_TAPS) times the one to the closest
+ *   crystal, made symmetric. Only neutral tracks (no veto energy) are
+ *   touched, and the crystals of a track are the hits of detectorHits
+ *   labelled with its central crystal.
+ *
+ *   Splitting needs the crystal energies of the event (SetEnergies(), e.g.
+ *   from a2geant); detectorHits holds none, so without them clusters are
+ *   only merged. A track whose crystals have several local maxima above
+ *   the split energy is split into one track per maximum: every crystal
+ *   goes to the maximum it reaches by climbing to its most energetic
+ *   neighbour, and the cluster energy is shared by the crystal energies.
+ *
+ *   For merging, the hit crystals are put into a bitset and flood filled
+ *   into connected regions. A track whose central crystal shares its region
+ *   with a more energetic track is merged into it if its energy and their
+ *   opening angle are below the limits. Tracks of a split are not merged.
+ *
+ *   Run() rewrites the tracks in place and relabels the cluster of the
+ *   detectorHits entries to the new central crystals, so both trees written
+ *   afterwards describe the reclustered event.
+ */
+class  GReclustering
+{
+public:
+    enum
+    {
+        MAX_NEIGHBOURS  = 16,
+        MAX_TRACKS      = 64,   // tracks beyond are neither split nor created by a split
+        MAX_MAXIMA      = 8,    // clusters with more local maxima are not split
+        N_WORDS         = (GDetectorGeometry::N_CRYSTALS + 63)/64
+    };
+
+private:
+    Int_t       nNeighbours[GDetectorGeometry::N_CRYSTALS];
+    Short_t     neighbours[GDetectorGeometry::N_CRYSTALS][MAX_NEIGHBOURS];
+    ULong64_t   hit[N_WORDS];
+    ULong64_t   visited[N_WORDS];
+    ULong64_t   member[N_WORDS];
+    Int_t       region[GDetectorGeometry::N_CRYSTALS];     // valid for hit crystals only
+    Short_t     stack[GDetectorGeometry::N_CRYSTALS];
+    Double_t    energy[GDetectorGeometry::N_CRYSTALS];
+    Bool_t      hasEnergies;
+    Bool_t      split[MAX_TRACKS];
+    Double_t    maxEnergy;
+    Double_t    minCosAngle;
+    Double_t    minSplitEnergy;
+    Int_t       nMerged;
+    Int_t       nSplit;
+
+            void    AddNeighbour(const Int_t crystal, const Int_t neighbour);
+            void    BuildNeighbours(const Int_t first, const Int_t n, const Double_t factor);
+            void    SetHits(const Int_t n, const Int_t* hits, const Int_t offset, const Int_t size);
+            void    FloodFill(const Int_t n, const Int_t* hits, const Int_t offset, const Int_t size, Int_t& nRegions);
+            Int_t   GetRegion(const Int_t crystal)   const   {return crystal >= 0 && (hit[crystal >> 6] >> (crystal & 63) & 1) ? region[crystal] : -1;}
+            Bool_t  IsMember(const Int_t crystal)    const   {return member[crystal >> 6] >> (crystal & 63) & 1;}
+            Bool_t  IsSplit(const Int_t track)       const   {return track < MAX_TRACKS && split[track];}
+            Int_t   Climb(const Int_t crystal)       const;
+            Int_t   Owner(const Int_t crystal, const Int_t nMaxima, const Int_t* maxima)    const;
+            void    Relabel(GTreeDetectorHits& hits, const Bool_t taps, const Int_t from, const Int_t to)    const;
+            Bool_t  SplitTrack(GTreeTrack& tracks, GTreeDetectorHits& hits, const Int_t track);
+            void    MergeTracks(GTreeTrack& tracks, GTreeDetectorHits& hits);
+
+public:
+    GReclustering(const Double_t _MaxEnergy, const Double_t _MaxAngle, const Double_t _MinSplitEnergy = 0);
+    ~GReclustering();
+
+            Int_t           GetNNeighbours(const Int_t crystal)             const   {return nNeighbours[crystal];}
+    const   Short_t*        GetNeighbours(const Int_t crystal)              const   {return neighbours[crystal];}
+            Bool_t          IsNeighbour(const Int_t crystal1, const Int_t crystal2)    const;
+
+    // crystal energies of the next Run(), scaled to MeV
+            void            ClearEnergies();
+            void            SetEnergies(const Int_t n, const Int_t* crystals, const Float_t* energies, const Int_t offset, const Int_t size, const Double_t scale);
+
+    // splits and merges the neutral tracks, returns the change of their number
+            Int_t           Run(GTreeTrack& tracks, GTreeDetectorHits& hits);
+            Int_t           GetNMerged()    const   {return nMerged;}
+            Int_t           GetNSplit()     const   {return nSplit;}
+};
+
+
+#endif
@@ -3,6 +3,7 @@
 #define __GSort_h__
 
 #include "GTreeManager.h"
+#include "GEventBlock.h"
 
 
 class	GSort : virtual public GTreeManager
@@ -61,6 +62,8 @@ public:
     virtual void	Reconstruct();
 
     Bool_t	SortAnalyseEvent();
+    void    SortAnalyseBlock(GEventBlock& block);
+    Bool_t  SortRaw(const Int_t nTracks, const Int_t nCB, const Int_t nTAPS, const Double_t energySum) const;
     Bool_t	SortFillEvent();
     Bool_t 	SortOnParticle(const GTreeParticle& tree, Int_t Num, Int_t cond, Double_t ThetaMin, Double_t ThetaMax);
     Bool_t 	SortOnNeutrality(Bool_t charge, Int_t Num, Sort_Condition cond, Double_t ThetaMin, Double_t ThetaMax);
@@ -30,17 +30,27 @@ private:
     Bool_t          correlatedToScalerRead;
     Bool_t          singleRead;
     Int_t           status;
+    Int_t           slot;
 
-    void    GetEntryFast(const UInt_t index)    {inputTree->GetEntry(index);}
+    void    GetEntryFast(const UInt_t index)    {inputTree->GetEntry(index); generation++; if(convertInput) ConvertInput();}
 
 protected:
     TTree*          inputTree;
     TTree*          outputTree;
     GTreeManager*   manager;
     bool            saveToFile;
+    Bool_t          convertInput;
+    Int_t           capacity;       // entries per column of GTreeColumn based trees
+    UInt_t          generation;     // changes with every new entry or edit, invalidates derived caches
 
     virtual void    SetBranchAdresses() = 0;
     virtual void    SetBranches() = 0;
+    virtual void    ConvertInput()  {}
+    virtual void    ReserveColumns(const Int_t n)   {}
+    virtual void    SetOutputAddresses()            {}
+            void    Reserve(const Int_t n);
+            void    ReserveFromInput(const char* counter);
+            void    Modified()      {generation++;}
 
 public:
     GTree(GTreeManager* Manager, const TString& _Name, const Bool_t CorrelatedToScalerRead = kFALSE, const Bool_t SingleRead = kFALSE);
@@ -50,7 +60,7 @@ public:
             void        CloseForInput();
             void        CloseForOutput();
             void        Close();
-            void        Fill();
+    virtual void        Fill();
     inline  Bool_t      GetEntry(const UInt_t index);
     const   char*       GetName() const {return name.Data();}
             UInt_t      GetNEntries()   { if(IsOpenForInput()) return inputTree->GetEntries(); return 0;}
@@ -69,6 +79,10 @@ Bool_t  GTree::GetEntry(const UInt_t index)
     if(index > inputTree->GetEntries())
         return kFALSE;
     inputTree->GetEntry(index);
+    generation++;
+    if(convertInput)
+        ConvertInput();
+    return kTRUE;
 }
 
 
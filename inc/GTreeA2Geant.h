@@ -2,6 +2,7 @@
 #define __GTreeA2Geant_h__
 
 #include "GTree.h"
+#include "GTreeColumn.h"
 #include "Rtypes.h"
 
 #include "TVector3.h"
@@ -19,6 +20,68 @@
 #define GEANT_MAX_MWPCHITS  400
 #define GEANT_MAX_PART      100
 
+// The a2geant branches. The storage stays Float_t, the precision of the
+// a2geant files, and every group is reserved once with its maximum.
+#define GTreeA2Geant_SCALARS(SCALAR, ARG)           \
+    SCALAR(ARG, Int_t,      nhits)                  \
+    SCALAR(ARG, Int_t,      npart)                  \
+    SCALAR(ARG, Int_t,      ntaps)                  \
+    SCALAR(ARG, Int_t,      nvtaps)                 \
+    SCALAR(ARG, Int_t,      vhits)                  \
+    SCALAR(ARG, Float_t,    eleak)                  \
+    SCALAR(ARG, Float_t,    enai)                   \
+    SCALAR(ARG, Float_t,    etot)                   \
+    SCALAR(ARG, Int_t,      nmwpc)
+
+// [npart], dircos is [npart][3]
+#define GTreeA2Geant_PART_COLUMNS(COLUMN, ARG)      \
+    COLUMN(ARG, Float_t,    plab)                   \
+    COLUMN(ARG, Float_t,    elab)                   \
+    COLUMN(ARG, Int_t,      idpart)
+
+// [nhits]
+#define GTreeA2Geant_CB_COLUMNS(COLUMN, ARG)        \
+    COLUMN(ARG, Float_t,    ecryst)                 \
+    COLUMN(ARG, Float_t,    tcryst)                 \
+    COLUMN(ARG, Int_t,      icryst)
+
+// [ntaps]
+#define GTreeA2Geant_TAPS_COLUMNS(COLUMN, ARG)      \
+    COLUMN(ARG, Float_t,    tctaps)                 \
+    COLUMN(ARG, Float_t,    ectapfs)                \
+    COLUMN(ARG, Float_t,    ectapsl)                \
+    COLUMN(ARG, Int_t,      ictaps)
+
+// [nvtaps]
+#define GTreeA2Geant_VTAPS_COLUMNS(COLUMN, ARG)     \
+    COLUMN(ARG, Float_t,    evtaps)                 \
+    COLUMN(ARG, Int_t,      ivtaps)
+
+// [vhits]
+#define GTreeA2Geant_PID_COLUMNS(COLUMN, ARG)       \
+    COLUMN(ARG, Float_t,    eveto)                  \
+    COLUMN(ARG, Float_t,    tveto)                  \
+    COLUMN(ARG, Int_t,      iveto)
+
+// [nmwpc]
+#define GTreeA2Geant_MWPC_COLUMNS(COLUMN, ARG)      \
+    COLUMN(ARG, Int_t,      imwpc)                  \
+    COLUMN(ARG, Float_t,    mposx)                  \
+    COLUMN(ARG, Float_t,    mposy)                  \
+    COLUMN(ARG, Float_t,    mposz)                  \
+    COLUMN(ARG, Float_t,    emwpc)
+
+// fixed length, [3], [5] and [npart][3]
+#define GTreeA2Geant_FIXED_COLUMNS(COLUMN, ARG)     \
+    COLUMN(ARG, Float_t,    vertex)                 \
+    COLUMN(ARG, Float_t,    beam)                   \
+    COLUMN(ARG, Float_t,    dircos)
+
+// only bound and written if the input has them
+#define GTreeA2Geant_MCID_SCALARS(SCALAR, ARG)      \
+    SCALAR(ARG, Long64_t,   mc_evt_id)              \
+    SCALAR(ARG, Long64_t,   mc_rnd_id)
+
 /**
  * @brief A GTree for a2geant output files.
  *
@@ -37,44 +100,21 @@ public:
 protected:
 
         // Brach memories
-       Int_t           fnhits;
-       Int_t           fnpart;
-       Int_t           fntaps;
-       Int_t           fnvtaps;
-       Int_t           fvhits;
-       Float_t         plab[GEANT_MAX_PART];
-       Float_t         tctaps[GEANT_MAX_TAPSHITS];
-       Float_t         fvertex[3];
-       Float_t         fbeam[5];
-       Float_t         dircos[GEANT_MAX_PART][3];
-       Float_t         ecryst[GEANT_MAX_CBHITS];
-       Float_t         tcryst[GEANT_MAX_CBHITS];
-       Float_t         ectapfs[GEANT_MAX_TAPSHITS];
-       Float_t         ectapsl[GEANT_MAX_TAPSHITS];
-       Float_t         elab[GEANT_MAX_PART];
-       Float_t         feleak;
-       Float_t         fenai;
-       Float_t         fetot;
-       Float_t         eveto[GEANT_MAX_PIDHITS];
-       Float_t         tveto[GEANT_MAX_PIDHITS];
-       Float_t         evtaps[GEANT_MAX_TAPSHITS];
-       Int_t           icryst[GEANT_MAX_CBHITS];
-       Int_t           ictaps[GEANT_MAX_TAPSHITS];
-       Int_t           ivtaps[GEANT_MAX_TAPSHITS];
-       Int_t           idpart[GEANT_MAX_PART];
-       Int_t           iveto[GEANT_MAX_PIDHITS];
-       Int_t           fnmwpc;
-       Int_t           imwpc[GEANT_MAX_MWPCHITS];
-       Float_t         mposx[GEANT_MAX_MWPCHITS];
-       Float_t         mposy[GEANT_MAX_MWPCHITS];
-       Float_t         mposz[GEANT_MAX_MWPCHITS];
-       Float_t         emwpc[GEANT_MAX_MWPCHITS];
-       Long64_t        mc_evt_id;
-       Long64_t        mc_rnd_id;
+       GTreeA2Geant_SCALARS(GTREE_DECLARE_SCALAR, )
+       GTreeA2Geant_PART_COLUMNS(GTREE_DECLARE_COLUMN, )
+       GTreeA2Geant_CB_COLUMNS(GTREE_DECLARE_COLUMN, )
+       GTreeA2Geant_TAPS_COLUMNS(GTREE_DECLARE_COLUMN, )
+       GTreeA2Geant_VTAPS_COLUMNS(GTREE_DECLARE_COLUMN, )
+       GTreeA2Geant_PID_COLUMNS(GTREE_DECLARE_COLUMN, )
+       GTreeA2Geant_MWPC_COLUMNS(GTREE_DECLARE_COLUMN, )
+       GTreeA2Geant_FIXED_COLUMNS(GTREE_DECLARE_COLUMN, )
+       GTreeA2Geant_MCID_SCALARS(GTREE_DECLARE_SCALAR, )
+       Bool_t          hasMCID;
 
 
     virtual void    SetBranchAdresses();
     virtual void    SetBranches();
+    virtual void    ConvertInput();
 
     static Double_t sumArray( const Float_t* const data, const Int_t size);
     static void buildPattern( hitvector& pattern, const Int_t* const indices, const Float_t* const data, const Int_t nhits, const Int_t patternsize);
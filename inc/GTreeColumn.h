@@ -0,0 +1,193 @@
+#ifndef __GTreeColumn_h__
+#define __GTreeColumn_h__
+
+
+#include <cstring>
+#include <stdlib.h>
+
+#include <TString.h>
+#include <TTree.h>
+#include <TBranch.h>
+#include <TLeaf.h>
+#include "Rtypes.h"
+
+
+// Storage precision of the floating point columns. Branches written with the
+// other precision are read through a conversion buffer (see GTreeColumn).
+#ifdef GOAT_FLOAT_STORAGE
+typedef Float_t     GTreeReal;
+#else
+typedef Double_t    GTreeReal;
+#endif
+
+
+template<typename T>    struct  GTreeLeafType;
+template<>  struct  GTreeLeafType<Bool_t>   {static const char* Name() {return "Bool_t";}   static const char* Code() {return "O";}};
+template<>  struct  GTreeLeafType<Int_t>    {static const char* Name() {return "Int_t";}    static const char* Code() {return "I";}};
+template<>  struct  GTreeLeafType<UInt_t>   {static const char* Name() {return "UInt_t";}   static const char* Code() {return "i";}};
+template<>  struct  GTreeLeafType<Long64_t> {static const char* Name() {return "Long64_t";} static const char* Code() {return "L";}};
+template<>  struct  GTreeLeafType<Float_t>  {static const char* Name() {return "Float_t";}  static const char* Code() {return "F";}};
+template<>  struct  GTreeLeafType<Double_t> {static const char* Name() {return "Double_t";} static const char* Code() {return "D";}};
+
+
+#define GTreeColumn_ALIGN   64
+
+// 64 byte aligned array, so each column starts on its own cache line.
+template<typename T>
+inline  T*  GTreeColumnAlloc(const Int_t n)
+{
+    void*   ptr = 0;
+    if(posix_memalign(&ptr, GTreeColumn_ALIGN, (n>0 ? n : 1)*sizeof(T)) != 0)
+        return 0;
+    return (T*)ptr;
+}
+
+
+// One array branch. The column decays to T* so the trees keep indexing
+// it like the plain arrays it replaces. Reserve() grows the storage and
+// moves it, so pointers handed out before are invalid afterwards and the
+// owning tree has to rebind its branches (see GTree::Reserve).
+template<typename T>
+class   GTreeColumn
+{
+private:
+    T*          values;
+    Int_t       capacity;
+    T           init;
+    Double_t*   readDouble;     // file buffer if the branch holds Double_t and T does not
+    Float_t*    readFloat;      // file buffer if the branch holds Float_t and T does not
+    Int_t       readCapacity;
+    Int_t       readType;
+
+    GTreeColumn(const GTreeColumn&);
+    GTreeColumn& operator=(const GTreeColumn&);
+
+public:
+    enum
+    {
+        READ_DIRECT = 0,
+        READ_DOUBLE = 1,
+        READ_FLOAT  = 2
+    };
+
+    GTreeColumn() : values(0), capacity(0), init(0), readDouble(0), readFloat(0), readCapacity(0), readType(READ_DIRECT)   {}
+    ~GTreeColumn()  {free(values); free(readDouble); free(readFloat);}
+
+    operator        T*()                        {return values;}
+    operator const  T*()                const   {return values;}
+
+            Int_t   GetCapacity()       const   {return capacity;}
+            void    Fill(const T value)         {init = value; for(Int_t i=0; i<capacity; i++) values[i] = value;}
+    inline  Bool_t  Reserve(const Int_t n);
+    inline  Bool_t  SetBranchAddress(TTree* tree, const char* name);
+    inline  void    SetOutputAddress(TTree* tree, const char* name)    {tree->SetBranchAddress(name, values);}
+    inline  void    Branch(TTree* tree, const char* name, const char* counter, const char* inner = "");
+    inline  void    Convert(const Int_t n);
+};
+
+template<typename T>
+Bool_t  GTreeColumn<T>::Reserve(const Int_t n)
+{
+    if(n <= capacity)
+        return kFALSE;
+    T*  grown   = GTreeColumnAlloc<T>(n);
+    if(capacity > 0)
+        memcpy(grown, values, capacity*sizeof(T));
+    for(Int_t i=capacity; i<n; i++)
+        grown[i]    = init;
+    free(values);
+    values      = grown;
+    capacity    = n;
+    return kTRUE;
+}
+
+template<typename T>
+Bool_t  GTreeColumn<T>::SetBranchAddress(TTree* tree, const char* name)
+{
+    readType    = READ_DIRECT;
+    TBranch*    branch  = tree->GetBranch(name);
+    TLeaf*      leaf    = branch ? branch->GetLeaf(name) : 0;
+    if(leaf && strcmp(leaf->GetTypeName(), GTreeLeafType<T>::Name()) != 0)
+    {
+        if(readCapacity < capacity)
+        {
+            free(readDouble);
+            free(readFloat);
+            readDouble  = 0;
+            readFloat   = 0;
+            readCapacity    = capacity;
+        }
+        if(strcmp(leaf->GetTypeName(), "Double_t") == 0)
+        {
+            if(!readDouble)
+                readDouble  = GTreeColumnAlloc<Double_t>(readCapacity);
+            readType    = READ_DOUBLE;
+            tree->SetBranchAddress(name, readDouble);
+            return kTRUE;
+        }
+        if(strcmp(leaf->GetTypeName(), "Float_t") == 0)
+        {
+            if(!readFloat)
+                readFloat   = GTreeColumnAlloc<Float_t>(readCapacity);
+            readType    = READ_FLOAT;
+            tree->SetBranchAddress(name, readFloat);
+            return kTRUE;
+        }
+    }
+    tree->SetBranchAddress(name, values);
+    return kFALSE;
+}
+
+template<typename T>
+void    GTreeColumn<T>::Branch(TTree* tree, const char* name, const char* counter, const char* inner)
+{
+    tree->Branch(name, values, TString::Format("%s[%s]%s/%s", name, counter, inner, GTreeLeafType<T>::Code()));
+}
+
+// Scalar branch, the leaflist derived the same way as for a column.
+template<typename T>
+inline  void    GTreeBranchScalar(TTree* tree, const char* name, T* address)
+{
+    tree->Branch(name, address, TString::Format("%s/%s", name, GTreeLeafType<T>::Code()));
+}
+
+template<typename T>
+void    GTreeColumn<T>::Convert(const Int_t n)
+{
+    if(readType == READ_DOUBLE)
+    {
+        for(Int_t i=0; i<n; i++)
+            values[i]   = T(readDouble[i]);
+    }
+    else if(readType == READ_FLOAT)
+    {
+        for(Int_t i=0; i<n; i++)
+            values[i]   = T(readFloat[i]);
+    }
+}
+
+
+// A tree lists its columns once as an X-macro, COLUMN(ARG, TYPE, NAME), and
+// expands that list with the macros below into members, input bindings,
+// output branches, growth and the read conversion. The leaflist of every
+// branch is derived from the same entry, so name, type and counter can not
+// drift apart.
+#define GTREE_DECLARE_COLUMN(UNUSED, TYPE, NAME)    GTreeColumn<TYPE>  NAME;
+#define GTREE_BIND_COLUMN(TREE, TYPE, NAME)         convertInput |= NAME.SetBranchAddress(TREE, #NAME);
+#define GTREE_BRANCH_COLUMN(COUNTER, TYPE, NAME)    NAME.Branch(outputTree, #NAME, COUNTER);
+#define GTREE_OUTPUT_COLUMN(TREE, TYPE, NAME)       NAME.SetOutputAddress(TREE, #NAME);
+#define GTREE_RESERVE_COLUMN(N, TYPE, NAME)         NAME.Reserve(N);
+#define GTREE_CONVERT_COLUMN(N, TYPE, NAME)         NAME.Convert(N);
+#define GTREE_SHIFT_COLUMN(INDEX, TYPE, NAME)       NAME[INDEX] = NAME[INDEX+1];
+#define GTREE_ZERO_COLUMN(UNUSED, TYPE, NAME)       NAME.Fill(0);
+
+// Trees holding several arrays with fixed maxima, e.g. one per detector,
+// list one group per counter and reserve each group once with its maximum.
+// Scalars, counters included, are listed as SCALAR(ARG, TYPE, NAME).
+#define GTREE_DECLARE_SCALAR(UNUSED, TYPE, NAME)    TYPE    NAME;
+#define GTREE_BIND_SCALAR(TREE, TYPE, NAME)         TREE->SetBranchAddress(#NAME, &NAME);
+#define GTREE_BRANCH_SCALAR(TREE, TYPE, NAME)       GTreeBranchScalar<TYPE>(TREE, #NAME, &NAME);
+#define GTREE_ZERO_SCALAR(UNUSED, TYPE, NAME)       NAME = 0;
+
+
+#endif
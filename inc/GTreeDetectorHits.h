@@ -4,27 +4,55 @@
 
 #include "Rtypes.h"
 #include "GTree.h"
+#include "GTreeColumn.h"
+
+
+// hits per detector, the maxima are the numbers of channels
+#define GTreeDetectorHits_MAX_NaI   720
+#define GTreeDetectorHits_MAX_PID   24
+#define GTreeDetectorHits_MAX_MWPC  860
+#define GTreeDetectorHits_MAX_BaF2  438
+#define GTreeDetectorHits_MAX_Veto  438
+
+#define GTreeDetectorHits_SCALARS(SCALAR, ARG)          \
+    SCALAR(ARG, Int_t,      nNaIHits)                   \
+    SCALAR(ARG, Int_t,      nPIDHits)                   \
+    SCALAR(ARG, Int_t,      nMWPCHits)                  \
+    SCALAR(ARG, Int_t,      nBaF2Hits)                  \
+    SCALAR(ARG, Int_t,      nVetoHits)
+
+#define GTreeDetectorHits_NaI_COLUMNS(COLUMN, ARG)      \
+    COLUMN(ARG, Int_t,      NaIHits)                    \
+    COLUMN(ARG, Int_t,      NaICluster)
+
+#define GTreeDetectorHits_PID_COLUMNS(COLUMN, ARG)      \
+    COLUMN(ARG, Int_t,      PIDHits)
+
+#define GTreeDetectorHits_MWPC_COLUMNS(COLUMN, ARG)     \
+    COLUMN(ARG, Int_t,      MWPCHits)
+
+#define GTreeDetectorHits_BaF2_COLUMNS(COLUMN, ARG)     \
+    COLUMN(ARG, Int_t,      BaF2Hits)                   \
+    COLUMN(ARG, Int_t,      BaF2Cluster)
+
+#define GTreeDetectorHits_Veto_COLUMNS(COLUMN, ARG)     \
+    COLUMN(ARG, Int_t,      VetoHits)
 
 
 class  GTreeDetectorHits    : public GTree
 {
 private:
-    Int_t		nNaIHits;
-    Int_t		NaIHits[720];
-    Int_t		NaICluster[720];
-    Int_t		nPIDHits;
-    Int_t		PIDHits[24];
-    Int_t		nMWPCHits;
-    Int_t		MWPCHits[860];
-    Int_t		nBaF2Hits;
-    Int_t		BaF2Hits[438];
-    Int_t		BaF2Cluster[438];
-    Int_t		nVetoHits;
-    Int_t		VetoHits[438];
+    GTreeDetectorHits_SCALARS(GTREE_DECLARE_SCALAR, )
+    GTreeDetectorHits_NaI_COLUMNS(GTREE_DECLARE_COLUMN, )
+    GTreeDetectorHits_PID_COLUMNS(GTREE_DECLARE_COLUMN, )
+    GTreeDetectorHits_MWPC_COLUMNS(GTREE_DECLARE_COLUMN, )
+    GTreeDetectorHits_BaF2_COLUMNS(GTREE_DECLARE_COLUMN, )
+    GTreeDetectorHits_Veto_COLUMNS(GTREE_DECLARE_COLUMN, )
 
 protected:
     virtual void    SetBranchAdresses();
     virtual void    SetBranches();
+    virtual void    ConvertInput();
 
 public:
     GTreeDetectorHits(GTreeManager *Manager);
@@ -37,6 +65,7 @@ public:
             Int_t		GetNaIHits(const Int_t index)	const	{return NaIHits[index];}
     const	Int_t*		GetNaICluster()           		const	{return NaICluster;}
             Int_t		GetNaICluster(const Int_t index)	const	{return NaICluster[index];}
+            void		SetNaICluster(const Int_t index, const Int_t cluster)	{NaICluster[index] = cluster;}
 
             Int_t		GetNPIDHits()      			const	{return nPIDHits;}
     const	Int_t*		GetPIDHits()               	const	{return PIDHits;}
@@ -51,6 +80,7 @@ public:
             Int_t		GetBaF2Hits(const Int_t index)	const	{return BaF2Hits[index];}
     const	Int_t*		GetBaF2Cluster()                    const	{return BaF2Cluster;}
             Int_t		GetBaF2Cluster(const Int_t index)	const	{return BaF2Cluster[index];}
+            void		SetBaF2Cluster(const Int_t index, const Int_t cluster)	{BaF2Cluster[index] = cluster;}
 
             Int_t		GetNVetoHits()                 const	{return nVetoHits;}
     const	Int_t*		GetVetoHits()                  const	{return VetoHits;}
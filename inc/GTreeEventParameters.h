@@ -4,16 +4,20 @@
 
 #include "Rtypes.h"
 #include "GTree.h"
+#include "GTreeColumn.h"
 
 
 #define GTreeEventParameters_MAX 128
 
+#define GTreeEventParameters_SCALARS(SCALAR, ARG)   \
+    SCALAR(ARG, Int_t,      eventNumber)            \
+    SCALAR(ARG, Int_t,      nReconstructed)
+
 
 class  GTreeEventParameters : public GTree
 {
 private:
-    Int_t     eventNumber;
-    Int_t     nReconstructed;
+    GTreeEventParameters_SCALARS(GTREE_DECLARE_SCALAR, )
 
    protected:
     virtual void    SetBranchAdresses();
@@ -7,6 +7,7 @@
 #include <TDatabasePDG.h>
 
 #include "GConfigFile.h"
+#include "GTreeRegistry.h"
 #include "GTreeTrack.h"
 #include "GTreeTagger.h"
 #include "GTreeLinPol.h"
@@ -18,6 +19,9 @@
 #include "GTreeSetupParameters.h"
 #include "GTreeEventParameters.h"
 #include "GHistManager.h"
+#include "GFilePrefetch.h"
+#include "GFileStager.h"
+#include "GEventArena.h"
 
 #ifdef hasPluto
 #include "GTreePluto.h"
@@ -26,25 +30,63 @@
 
 #include <stdio.h>
 #include <TSystem.h>
+#include <TRandom3.h>
 
 
 class  GTreeManager : public GHistManager, public GConfigFile
 {
 private:
     TFile*      inputFile;
-    TObjArray   treeList;
-    TObjArray   treeCorreleatedToScalerReadList;
-    TObjArray   treeSingleReadList;
-    TObjArray   readList;
-    TObjArray   readCorreleatedToScalerReadList;
-    TObjArray   readSingleReadList;
-    TObjArray   writeList;
+    GTreeRegistry   registry;
+    const   GTreeSet&   treeList;
+    const   GTreeSet&   treeCorreleatedToScalerReadList;
+    const   GTreeSet&   treeSingleReadList;
+    const   GTreeSet&   readList;
+    const   GTreeSet&   readCorreleatedToScalerReadList;
+    const   GTreeSet&   readSingleReadList;
+    const   GTreeSet&   writeList;
     Bool_t      isWritten;
 
     UInt_t  currentScalerEntry;
 
     Int_t   countReconstructed;
 
+    // quick-look sampling of scaler blocks
+    Int_t       samplingPeriod;
+    Double_t    samplingFraction;
+    UInt_t      samplingSeed;
+    TRandom3    samplingRandom;
+    Int_t       nScalerBlocks;
+    Int_t       nScalerBlocksSampled;
+    Double_t    inputSamplingFraction;
+
+            void        InitSampling();
+            Bool_t      SampleScalerBlock();
+
+    // stop after target statistics, counted over all input files
+    Long64_t    maxEventsAccepted;
+    Long64_t    maxEventsRead;
+    Long64_t    nEventsAccepted;
+    Long64_t    nEventsRead;
+
+            void        InitEventLimits();
+
+    // chained input: all input files are written to the first output file
+    Bool_t      chainInput;
+    Int_t       chainFile;
+    Int_t       eventNumberOffset;
+    TH1I*       countScalerValid;
+    GFilePrefetch   prefetch;
+
+    // temporaries of the current event, reset before every ProcessEvent()
+    GEventArena     eventArena;
+
+    // events per ProcessBlock() call, 0 => one ProcessEvent() per event
+    Int_t           blockSize;
+
+            Bool_t      OpenChainFile(const Int_t index);
+            Int_t       GetEventNumberEnd();
+            Bool_t      TraverseMCEvents();
             Bool_t      TraverseValidEvents_AcquTreeFile();
             Bool_t      TraverseValidEvents_GoATTreeFile();
 
@@ -134,16 +176,25 @@ protected:
 
     TDatabasePDG *pdgDB;
 
-            void    FillReadList()      {for(Int_t l=0; l<readList.GetEntriesFast(); l++) ((GTree*)readList[l])->Fill();}
-    const   TObjArray&  GetTreeList()    const   {return treeList;}
+            void    AcceptEvent()       {nEventsAccepted++;}
+            GEventArena&    GetEventArena() {return eventArena;}
+            Int_t   GetBlockSize()      const   {return blockSize;}
+            void    SetBlockSize(const Int_t size)  {blockSize = size;}
+            void    ReadEntry(const UInt_t index);
+            void    ReadEntry(const UInt_t index, GTree* tree)  {tree->GetEntryFast(index);}
+            void    CountEntry(const UInt_t index);
+            void    ReadCountedEntry(const UInt_t index);
+            void    FillReadList()      {for(Int_t l=0; l<readList.GetEntries(); l++) readList[l]->Fill();}
+    const   GTreeSet&   GetTreeList()    const   {return treeList;}
     virtual void    ProcessEvent() = 0;
+    virtual void    ProcessBlock(const UInt_t min, const UInt_t max)    {for(UInt_t i=min; i<max; i++) {ReadEntry(i); ProcessEvent();}}
     virtual void    ProcessScalerRead() {}
             void    SetAsGoATFile();
             void    SetAsPhysicsFile();
     virtual Bool_t  Start() = 0;
             Bool_t  TraverseEntries(const UInt_t min, const UInt_t max);
             Bool_t  TraverseScalerEntries(const UInt_t min, const UInt_t max);
-            Bool_t  TraverseValidEvents()   {if(IsAcquFile()) return TraverseValidEvents_AcquTreeFile(); return TraverseValidEvents_GoATTreeFile();}
+            Bool_t  TraverseValidEvents();
     virtual Bool_t  Write();
             Bool_t  Write(const TNamed* object);
 
@@ -155,6 +206,11 @@ public:
             Int_t   GetEventNumber()    const   {return eventParameters->GetEventNumber();}
             UInt_t  GetNEntries()       const;
             Int_t   GetNReconstructed() const   {return countReconstructed;}
+            Double_t    GetSamplingFraction()   const;
+            Bool_t      IsSampling()            const   {return (samplingPeriod>1 || samplingFraction<1);}
+            Long64_t    GetNEventsAccepted()    const   {return nEventsAccepted;}
+            Long64_t    GetNEventsRead()        const   {return nEventsRead;}
+            Bool_t      IsEventLimitReached()   const   {return ((maxEventsAccepted>0 && nEventsAccepted>=maxEventsAccepted) || (maxEventsRead>0 && nEventsRead>=maxEventsRead));}
             UInt_t  GetNScalerEntries() const;
             Bool_t  IsAcquFile()    const;
             Bool_t  IsGoATFile()    const;
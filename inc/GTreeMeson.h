@@ -11,27 +11,53 @@
 #define MASS_ETAP   957.78
 #define MASS_PROTON 938.272046
 
+#define GTreeMeson_COLUMNS(COLUMN, ARG)             \
+    COLUMN(ARG, Int_t,      nSubParticles)          \
+    COLUMN(ARG, Int_t,      nSubRootinos)           \
+    COLUMN(ARG, Int_t,      nSubPhotons)            \
+    COLUMN(ARG, Int_t,      nSubChargedPions)
+
+// kinematic fit of 2 particle mesons (see GMesonFit), written only if enabled;
+// sub particle 0 and 1 of the pulls are in the order of GetTrackIndexList,
+// i.e. by increasing track index, not in the order of AddParticle
+#define GTreeMeson_FIT_COLUMNS(COLUMN, ARG)         \
+    COLUMN(ARG, GTreeReal,  fitChi2)                \
+    COLUMN(ARG, GTreeReal,  fitPullEnergy0)         \
+    COLUMN(ARG, GTreeReal,  fitPullTheta0)          \
+    COLUMN(ARG, GTreeReal,  fitPullPhi0)            \
+    COLUMN(ARG, GTreeReal,  fitPullEnergy1)         \
+    COLUMN(ARG, GTreeReal,  fitPullTheta1)          \
+    COLUMN(ARG, GTreeReal,  fitPullPhi1)            \
+    COLUMN(ARG, GTreeReal,  fitEventChi2)           \
+    COLUMN(ARG, Int_t,      fitEventTagger)
+
 
 using namespace std;
 
 class  GTreeMeson   : public GTreeParticle
 {
 private:
-    Int_t             nSubParticles[GTreeTrack_MAX];
-    Int_t             nSubRootinos[GTreeTrack_MAX];
-    Int_t             nSubPhotons[GTreeTrack_MAX];
-    Int_t             nSubChargedPions[GTreeTrack_MAX];
+    GTreeMeson_COLUMNS(GTREE_DECLARE_COLUMN, )
+    GTreeMeson_FIT_COLUMNS(GTREE_DECLARE_COLUMN, )
+    Bool_t          hasFit;
+    Int_t           pdgPhoton;
+    Int_t           pdgChargedPion;
+
+            void    ResetFit(const Int_t meson);
 
 protected:
     virtual void    SetBranchAdresses();
     virtual void    SetBranches();
+    virtual void    ConvertInput();
+    virtual void    ReserveColumns(const Int_t n);
+    virtual void    SetOutputAddresses();
 
 public:
     GTreeMeson(GTreeManager *Manager, const TString& _Name);
     virtual ~GTreeMeson();
 
-            void            AddParticle(Int_t subParticle_index0, const TLorentzVector subParticle0, const Int_t pdg0, Int_t subParticle_index1, const TLorentzVector subParticle1, const Int_t pdg1);
-            void            AddParticle(const Int_t _NSubRootinos, const Int_t _NSubPhotons, const Int_t _NSubChargedPions, Int_t* subParticles_index, TLorentzVector* subParticles_list);
+            void            AddParticle(Int_t subParticle_index0, const GP4& subParticle0, const Int_t pdg0, Int_t subParticle_index1, const GP4& subParticle1, const Int_t pdg1);
+            void            AddParticle(const Int_t _NSubRootinos, const Int_t _NSubPhotons, const Int_t _NSubChargedPions, Int_t* subParticles_index, const GP4* subParticles_list);
     virtual void            Clear();
             Int_t          GetNMesons()                            const	{return GetNParticles();}
             Int_t          GetNSubParticles(const Int_t meson)     const	{return nSubParticles[meson];}
@@ -39,7 +65,18 @@ public:
             Int_t          GetNSubPhotons(const Int_t meson)       const	{return nSubPhotons[meson];}
             Int_t          GetNSubChargedPi(const Int_t meson)     const	{return nSubChargedPions[meson];}
     inline  const   std::vector<Int_t> GetTrackIndexList(const Int_t meson)    const;
+    inline          Int_t          GetTrackIndexList(const Int_t meson, Int_t* list) const;
             Bool_t         HasTrack(const Int_t meson, const Int_t track) const {return (trackIndex[meson] & 1<<track);}
+            Bool_t         HasFit()                                 const   {return hasFit;}
+            void           SetHasFit(const Bool_t value)                    {hasFit = value;}
+            void           SetFit(const Int_t meson, const Double_t chi2, const Double_t* pulls);
+            void           SetEventFit(const Int_t meson, const Double_t chi2, const Int_t tagger)  {fitEventChi2[meson] = chi2; fitEventTagger[meson] = tagger;}
+            Double_t       GetFitChi2(const Int_t meson)            const   {return fitChi2[meson];}
+            Double_t       GetFitPullEnergy(const Int_t meson, const Int_t sub) const   {return sub ? fitPullEnergy1[meson] : fitPullEnergy0[meson];}
+            Double_t       GetFitPullTheta(const Int_t meson, const Int_t sub)  const   {return sub ? fitPullTheta1[meson] : fitPullTheta0[meson];}
+            Double_t       GetFitPullPhi(const Int_t meson, const Int_t sub)    const   {return sub ? fitPullPhi1[meson] : fitPullPhi0[meson];}
+            Double_t       GetFitEventChi2(const Int_t meson)       const   {return fitEventChi2[meson];}
+            Int_t          GetFitEventTagger(const Int_t meson)     const   {return fitEventTagger[meson];}
             TLorentzVector Meson(const Int_t meson)             {return Particle(meson);}
     const   TLorentzVector Meson(const Int_t meson) const       {return Particle(meson);}
     virtual void            Print() const;
@@ -47,16 +84,24 @@ public:
 
 const std::vector<Int_t> GTreeMeson::GetTrackIndexList(const Int_t meson) const
 {
-    std::vector<Int_t> trackIndexList;
+    std::vector<Int_t> trackIndexList(nSubParticles[meson]);
+    if(nSubParticles[meson] > 0)
+        GetTrackIndexList(meson, &trackIndexList[0]);
+    return trackIndexList;
+}
+
+// Fills list, which needs room for GetNSubParticles(meson) entries, without allocating.
+Int_t GTreeMeson::GetTrackIndexList(const Int_t meson, Int_t* list) const
+{
     Int_t i=0;
 
     for(Int_t j=0; j<nSubParticles[meson]; j++)
     {
         while((trackIndex[meson] & 1<<i) == 0) i++;
-        trackIndexList.push_back(i++);
+        list[j] = i++;
     }
 
-    return trackIndexList;
+    return nSubParticles[meson];
 }
 
 #endif
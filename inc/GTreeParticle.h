@@ -6,19 +6,35 @@
 #include "GTreeTrack.h"
 
 
+// trackIndex: index of the corresponding track in the track list, -1 => No track
+#define GTreeParticle_COLUMNS(COLUMN, ARG)          \
+    COLUMN(ARG, GTreeReal,  mass)                   \
+    COLUMN(ARG, Int_t,      trackIndex)
+
+// Track column getters of a particle tree. While the tree is a view (see
+// AddTrack) the values are read from the source tracks through trackIndex,
+// the array getters copy them over first.
+#define GTreeParticle_VIEW_GETTER(TYPE, COLUMN_TYPE, GETTER, COLUMN)                                                                            \
+            TYPE            GETTER(const Int_t index)   const   {return source ? TYPE(source->COLUMN[trackIndex[index]]) : TYPE(COLUMN[index]);}  \
+    const   COLUMN_TYPE*    GETTER()                    const   {Materialise(); return COLUMN;}
+
 class   GTreeMeson;
 
 class  GTreeParticle    : public GTreeTrack
 {
 private:
     Int_t               nParticles;
-    Double_t            mass[GTreeTrack_MAX];
-    Int_t               trackIndex[GTreeTrack_MAX];  // index of the corresponding tack in the track list, -1 => No track
+    GTreeParticle_COLUMNS(GTREE_DECLARE_COLUMN, )
+    const GTreeTrack*   source;         // tracks the particles refer to, 0 if the columns hold the values
 
+            void    Materialise()   const;
 
 protected:
     virtual void    SetBranchAdresses();
     virtual void    SetBranches();
+    virtual void    ConvertInput();
+    virtual void    ReserveColumns(const Int_t n);
+    virtual void    SetOutputAddresses();
             void    PrintParticle(const Int_t i) const;
 
 public:
@@ -26,18 +42,43 @@ public:
     virtual ~GTreeParticle();
 
             void            AddParticle(const Double_t _clusterEnergy = 0, const Double_t _theta = 0, const Double_t _phi = 0, const Double_t _mass = 0, const Double_t _time = 0, const Int_t _clusterSize = 0, const Int_t _centralCrystal = -1, const Int_t _centralVeto = -1, const Int_t _detectors = 0, const Double_t _vetoEnergy = 0, const Double_t _MWPC0Energy = 0, const Double_t _MWPC1Energy = 0, const Int_t _trackIndex = -1);
-    virtual void            Clear() {nParticles = 0;}
+            void            AddTrack(const GTreeTrack* tracks, const Int_t track, const Double_t _mass);
+    virtual void            Clear() {nParticles = 0; source = 0; Modified();}
+    virtual void            Fill()  {Materialise(); GTree::Fill();}
             Int_t           GetNParticles()                     const	{return nParticles;}
-            Double_t        GetKineticEnergy(const Int_t index) const   {return clusterEnergy[index];}
-    const   Double_t*       GetKineticEnergy()                  const   {return clusterEnergy; }
-            Double_t        GetTotalEnergy(const Int_t index)   const   {return (clusterEnergy[index]+mass[index]);}
+            Bool_t          IsView()                            const   {return source != 0;}
+
+    GTreeParticle_VIEW_GETTER(Double_t, GTreeReal,  GetClusterEnergy,   clusterEnergy)
+    GTreeParticle_VIEW_GETTER(Double_t, GTreeReal,  GetTheta,           theta)
+    GTreeParticle_VIEW_GETTER(Double_t, GTreeReal,  GetPhi,             phi)
+    GTreeParticle_VIEW_GETTER(Double_t, GTreeReal,  GetTime,            time)
+    GTreeParticle_VIEW_GETTER(Int_t,    Int_t,      GetClusterSize,     clusterSize)
+    GTreeParticle_VIEW_GETTER(Int_t,    Int_t,      GetCentralCrystal,  centralCrystal)
+    GTreeParticle_VIEW_GETTER(Int_t,    Int_t,      GetCentralVeto,     centralVeto)
+    GTreeParticle_VIEW_GETTER(Int_t,    Int_t,      GetDetectors,       detectors)
+    GTreeParticle_VIEW_GETTER(Double_t, GTreeReal,  GetVetoEnergy,      vetoEnergy)
+    GTreeParticle_VIEW_GETTER(Double_t, GTreeReal,  GetMWPC0Energy,     MWPC0Energy)
+    GTreeParticle_VIEW_GETTER(Double_t, GTreeReal,  GetMWPC1Energy,     MWPC1Energy)
+    GTreeParticle_VIEW_GETTER(Double_t, GTreeReal,  GetKineticEnergy,   clusterEnergy)
+            Double_t        GetThetaRad(const Int_t index)      const   {return GetTheta(index) * TMath::DegToRad();}
+            Double_t        GetPhiRad(const Int_t index)        const   {return GetPhi(index) * TMath::DegToRad();}
+            Bool_t          HasCB(const Int_t index)            const   {return GetDetectors(index) & DETECTOR_CB;}
+            Bool_t          HasTAPS(const Int_t index)          const   {return GetDetectors(index) & DETECTOR_TAPS;}
+            TLorentzVector  GetVector(const Int_t index)        const   {return source ? source->GetVector(trackIndex[index]) : GTreeTrack::GetVector(index);}
+            TLorentzVector  GetVector(const Int_t index, const Double_t _mass)  const   {return source ? source->GetVector(trackIndex[index], _mass) : GTreeTrack::GetVector(index, _mass);}
+            Int_t           GetCrystal(const Int_t index)       const   {return source ? source->GetCrystal(trackIndex[index]) : GTreeTrack::GetCrystal(index);}
+            GP4             GetDirection(const Int_t index)     const   {return source ? source->GetDirection(trackIndex[index]) : GTreeTrack::GetDirection(index);}
+            GP4             GetP4(const Int_t index)            const   {return GetP4(index, mass[index]);}
+            GP4             GetP4(const Int_t index, const Double_t _mass)      const   {return source ? source->GetP4(trackIndex[index], _mass) : GTreeTrack::GetP4(index, _mass);}
+            Double_t        GetTotalEnergy(const Int_t index)   const   {return (GetClusterEnergy(index)+mass[index]);}
             Double_t        GetMass(const Int_t index)          const   {return mass[index];}
-    const   Double_t*       GetMass()                           const   {return mass; }
+    const   GTreeReal*      GetMass()                           const   {return mass; }
             Int_t           GetTrackIndex(const Int_t index)    const   {return trackIndex[index];}
     const   Int_t*          GetTrackIndex()                     const   {return trackIndex; }
 
     inline          TLorentzVector Particle(const Int_t particle);
     inline  const   TLorentzVector Particle(const Int_t particle) const;
+    inline          GP4     ParticleP4(const Int_t particle)    const;
     virtual void            Print() const;
             void            RemoveParticles(const Int_t nIndices, const Int_t* indices);
             void            RemoveAllParticles();
@@ -71,5 +112,15 @@ const   TLorentzVector GTreeParticle::Particle(const Int_t particle) const
     return GetVector(particle,GetMass(particle));
 }
 
+GP4     GTreeParticle::ParticleP4(const Int_t particle) const
+{
+    if(particle>=nParticles)
+    {
+        std::cout << "ERROR: Try to access particle " << particle << " in " << GetName() << ". Only " << nParticles << " in tree." << std::endl;
+        return GP4();
+    }
+    return GetP4(particle);
+}
+
 
 #endif
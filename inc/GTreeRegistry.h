@@ -0,0 +1,76 @@
+#ifndef __GTreeRegistry_h__
+#define __GTreeRegistry_h__
+
+
+#include <Rtypes.h>
+
+
+#define GTreeRegistry_MAX   64
+
+class   GTree;
+
+/**
+ * @brief Dense, ordered snapshot of the trees selected by a bitmask.
+ */
+class  GTreeSet
+{
+private:
+    GTree*  trees[GTreeRegistry_MAX];
+    Int_t   nTrees;
+
+public:
+    GTreeSet() : nTrees(0)   {}
+
+            Int_t   GetEntries()                const   {return nTrees;}
+            GTree*  operator[](const Int_t i)   const   {return trees[i];}
+            void    Set(GTree* const* slots, ULong64_t mask);
+};
+
+/**
+ * @brief Fixed table of the trees of a GTreeManager.
+ *
+ *   Every tree owns one slot. The kind of a tree and whether it is open
+ *   for input or output are bitmasks over the slots. The sets iterated in
+ *   the event loops are rebuilt only when a mask changes, i.e. when files
+ *   are opened or closed, never per event.
+ */
+class  GTreeRegistry
+{
+public:
+    enum
+    {
+        KIND_EVENT      = 0,
+        KIND_SCALER     = 1,    // correlated to scaler reads
+        KIND_SINGLE     = 2,    // one entry per file
+        KIND_COUNT      = 3
+    };
+
+private:
+    GTree*      slots[GTreeRegistry_MAX];
+    ULong64_t   usedMask;
+    ULong64_t   kindMask[KIND_COUNT];
+    ULong64_t   readMask;
+    ULong64_t   writeMask;
+    GTreeSet    trees[KIND_COUNT];
+    GTreeSet    read[KIND_COUNT];
+    GTreeSet    write;
+
+            void    Update();
+
+public:
+    GTreeRegistry();
+
+            Int_t       Add(GTree* tree, const Int_t kind);
+            void        Remove(const Int_t slot);
+            void        SetRead(const Int_t slot, const Bool_t on);
+            void        SetWrite(const Int_t slot, const Bool_t on);
+
+            Int_t       GetNTrees()                 const   {return __builtin_popcountll(usedMask);}
+    const   GTreeSet&   GetTrees(const Int_t kind)  const   {return trees[kind];}
+    const   GTreeSet&   GetRead(const Int_t kind)   const   {return read[kind];}
+    const   GTreeSet&   GetWrite()                  const   {return write;}
+            GTree*      GetAny()                    const   {return usedMask ? slots[__builtin_ctzll(usedMask)] : 0;}
+};
+
+
+#endif
@@ -4,16 +4,15 @@
 
 #include "Rtypes.h"
 #include "GTree.h"
+#include "GTreeColumn.h"
 
 
-#define GTreeScaler_MAX 16384
-
 class  GTreeScaler : public GTree
 {
 private:
     Int_t		eventNumber;
     Int_t		eventID;
-    UInt_t		scalers[GTreeScaler_MAX];
+    GTreeColumn<UInt_t> scalers;
 
     Int_t		nScalers;
 
@@ -33,6 +32,7 @@ public:
     const	UInt_t*		GetScaler()                 const	{return	scalers;}
             UInt_t		GetScaler(const Int_t index)const	{return	scalers[index];}
             UInt_t		GetScalerEntry(const Int_t event_number);
+            void        SetEventNumber(const Int_t number)  {eventNumber = number;}
             void 		SetNScalers(const Int_t num);
     virtual void        Print() const;
 };
@@ -5,24 +5,32 @@
 #include <TLorentzVector.h>
 #include "Rtypes.h"
 #include "GTree.h"
+#include "GTreeColumn.h"
 
 
-#define GTreeTagger_MAX 4096
+#define GTreeTagger_INITIAL 64
+
+// taggedEnergy is optional and bound separately
+#define GTreeTagger_COLUMNS(COLUMN, ARG)            \
+    COLUMN(ARG, Int_t,      taggedChannel)          \
+    COLUMN(ARG, GTreeReal,  taggedTime)
 
 
 class  GTreeTagger : public GTree
 {
 private:
     Int_t           nTagged;
-    Int_t           taggedChannel[GTreeTagger_MAX];
-    Double_t        taggedTime[GTreeTagger_MAX];
-    Double_t        taggedEnergy[GTreeTagger_MAX];
+    GTreeTagger_COLUMNS(GTREE_DECLARE_COLUMN, )
+    GTreeColumn<GTreeReal>  taggedEnergy;
     Bool_t          hasEnergy;
     Double_t        calibration[352];
 
 protected:
     virtual void    SetBranchAdresses();
     virtual void    SetBranches();
+    virtual void    ConvertInput();
+    virtual void    ReserveColumns(const Int_t n);
+    virtual void    SetOutputAddresses();
 
 public:
     GTreeTagger(GTreeManager *Manager);
@@ -33,9 +41,9 @@ public:
             Int_t           GetNTagged()                        const	{return nTagged;}
     const	Int_t*          GetTaggedChannel()                  const	{return taggedChannel;}
             Int_t           GetTaggedChannel(const Int_t index) const	{return taggedChannel[index];}
-    const	Double_t*       GetTaggedTime()                     const	{return taggedTime;}
+    const	GTreeReal*      GetTaggedTime()                     const	{return taggedTime;}
             Double_t        GetTaggedTime(const Int_t index)    const	{return taggedTime[index];}
-    const	Double_t*       GetTaggedEnergy()                   const	{return taggedEnergy;}
+    const	GTreeReal*      GetTaggedEnergy()                   const	{return taggedEnergy;}
             Double_t        GetTaggedEnergy(const Int_t index)	const	{if(hasEnergy) return taggedEnergy[index]; return calibration[taggedChannel[index]];}
             Bool_t          HasEnergy()                         const   {return hasEnergy;}
             void            SetCalibration(const Int_t nChan, const Double_t *energy);
@@ -5,9 +5,32 @@
 #include <TLorentzVector.h>
 #include "Rtypes.h"
 #include "GTree.h"
-
-
-#define GTreeTrack_MAX 128
+#include "GTreeColumn.h"
+#include "GKinematics.h"
+#include "GDetectorGeometry.h"
+
+
+#define GTreeTrack_INITIAL  8      // initial column capacity, grows with the input
+
+// Per track columns, shared with GTreeParticle
+#define GTreeTrack_COLUMNS(COLUMN, ARG)             \
+    COLUMN(ARG, GTreeReal,  clusterEnergy)          \
+    COLUMN(ARG, GTreeReal,  theta)                  \
+    COLUMN(ARG, GTreeReal,  phi)                    \
+    COLUMN(ARG, GTreeReal,  time)                   \
+    COLUMN(ARG, Int_t,      clusterSize)            \
+    COLUMN(ARG, Int_t,      centralCrystal)         \
+    COLUMN(ARG, Int_t,      centralVeto)            \
+    COLUMN(ARG, Int_t,      detectors)              \
+    COLUMN(ARG, GTreeReal,  vetoEnergy)             \
+    COLUMN(ARG, GTreeReal,  MWPC0Energy)            \
+    COLUMN(ARG, GTreeReal,  MWPC1Energy)
+
+// Pseudo vertex information, tracks only
+#define GTreeTrack_VERTEX_COLUMNS(COLUMN, ARG)      \
+    COLUMN(ARG, GTreeReal,  pseudoVertexX)          \
+    COLUMN(ARG, GTreeReal,  pseudoVertexY)          \
+    COLUMN(ARG, GTreeReal,  pseudoVertexZ)
 
 class   GTreeParticle;
 class   GTreeMeson;
@@ -24,35 +47,48 @@ public:
         DETECTOR_BaF2 = 8,
         DETECTOR_PbWO4 = 16,
         DETECTOR_Veto = 32,
+        DETECTOR_CB = DETECTOR_NaI | DETECTOR_PID | DETECTOR_MWPC,
+        DETECTOR_TAPS = DETECTOR_BaF2 | DETECTOR_PbWO4 | DETECTOR_Veto
     };
 private:
     Int_t		nTracks;
-    Double_t	clusterEnergy[GTreeTrack_MAX];
-    Double_t 	theta[GTreeTrack_MAX];
-    Double_t 	phi[GTreeTrack_MAX];
-    Double_t	time[GTreeTrack_MAX];
-    Int_t       clusterSize[GTreeTrack_MAX];
-    Int_t       centralCrystal[GTreeTrack_MAX];
-    Int_t       centralVeto[GTreeTrack_MAX];
-    Int_t       detectors[GTreeTrack_MAX];
-    //Charged detector energies
-    Double_t	vetoEnergy[GTreeTrack_MAX];
-    Double_t	MWPC0Energy[GTreeTrack_MAX];
-    Double_t	MWPC1Energy[GTreeTrack_MAX];
-    //Pseudo vertex information
-    Double_t    pseudoVertexX[GTreeTrack_MAX];
-    Double_t    pseudoVertexY[GTreeTrack_MAX];
-    Double_t    pseudoVertexZ[GTreeTrack_MAX];
+    GTreeTrack_COLUMNS(GTREE_DECLARE_COLUMN, )
+    GTreeTrack_VERTEX_COLUMNS(GTREE_DECLARE_COLUMN, )
+
+    // Kinematics derived from the columns, computed on first use. An entry
+    // is valid while its generation matches the one of the tree.
+    struct  Kinematics
+    {
+        Double_t    sinTheta;
+        Double_t    cosTheta;
+        Double_t    sinPhi;
+        Double_t    cosPhi;
+        GP4         direction;              // unit vector in px, py, pz
+        GP4         p4;
+        Double_t    mass;
+        UInt_t      directionGeneration;
+        UInt_t      p4Generation;
+    };
+    mutable Kinematics* kinematics;
+
+    inline  const Kinematics&   GetKinematics(const Int_t index, const Double_t mass)   const;
 
 protected:
     virtual void    SetBranchAdresses();
     virtual void    SetBranches();
+    virtual void    ConvertInput();
+    virtual void    ReserveColumns(const Int_t n);
+    virtual void    SetOutputAddresses();
+            void    ReserveKinematics(const Int_t n);
 
 public:
-    GTreeTrack(GTreeManager *Manager, const TString& _Name);
+    GTreeTrack(GTreeManager *Manager, const TString& _Name, const Bool_t reserve = kTRUE);
     virtual ~GTreeTrack();
 
-    virtual void    Clear()     {nTracks = 0;}
+    virtual void    Clear()     {nTracks = 0; Modified();}
+            void    MergeTrack(const Int_t into, const Int_t from);
+            Int_t   CopyTrack(const Int_t index);
+            void    SetCluster(const Int_t index, const Double_t energy, const Double_t _Theta, const Double_t _Phi, const Int_t crystal, const Int_t size);
 
     const	Int_t*          GetDetectors()                      const	{return detectors;}
             Int_t           GetDetectors(const Int_t index)     const	{return detectors[index];}
@@ -60,36 +96,39 @@ public:
             Int_t           GetClusterSize(const Int_t index)   const 	{return clusterSize[index];}
     const	Int_t*          GetCentralCrystal()                   const	{return centralCrystal;}
             Int_t           GetCentralCrystal(const Int_t index)  const {return centralCrystal[index];}
+            Int_t           GetCrystal(const Int_t index)       const   {return GDetectorGeometry::GetCrystal(centralCrystal[index], detectors[index] & (DETECTOR_BaF2 | DETECTOR_PbWO4));}
     const	Int_t*          GetCentralVeto()                      const	{return centralVeto;}
             Int_t           GetCentralVeto(const Int_t index)   const 	{return centralVeto[index];}
-    const	Double_t*       GetVetoEnergy()                     const	{return vetoEnergy;}
+    const	GTreeReal*      GetVetoEnergy()                     const	{return vetoEnergy;}
             Double_t        GetVetoEnergy(const Int_t index)    const	{return vetoEnergy[index];}
-    const	Double_t*       GetClusterEnergy()                  const	{return clusterEnergy;}
+    const	GTreeReal*      GetClusterEnergy()                  const	{return clusterEnergy;}
             Double_t        GetClusterEnergy(const Int_t index) const	{return clusterEnergy[index];}
             Int_t           GetNTracks()                        const	{return nTracks;}
     inline  Int_t           GetNCB()                            const;
     inline  Int_t           GetNTAPS()                          const;
     inline  Bool_t          HasCB(const Int_t index)            const;
     inline  Bool_t          HasTAPS(const Int_t index)          const;
-    const	Double_t*       GetPhi()                            const	{return phi;}
+    const	GTreeReal*      GetPhi()                            const	{return phi;}
             Double_t        GetPhi(const Int_t index)           const	{return phi[index];}
             Double_t        GetPhiRad(const Int_t index)        const	{return phi[index] * TMath::DegToRad();}
-    const	Double_t*       GetTheta()                          const	{return theta;}
+    const	GTreeReal*      GetTheta()                          const	{return theta;}
             Double_t        GetTheta(const Int_t index)         const	{return theta[index];}
             Double_t        GetThetaRad(const Int_t index)      const	{return theta[index] * TMath::DegToRad();}
-    const	Double_t*       GetTime()                           const	{return time;}
+    const	GTreeReal*      GetTime()                           const	{return time;}
             Double_t        GetTime(const Int_t index)          const	{return time[index];}
     inline  TLorentzVector	GetVector(const Int_t index)        const;
     inline  TLorentzVector	GetVector(const Int_t index, const Double_t mass)   const;
-    const	Double_t*       GetMWPC0Energy()                          const	{return MWPC0Energy;}
+            GP4             GetDirection(const Int_t index)                     const   {return GetKinematics(index, -1).direction;}
+            GP4             GetP4(const Int_t index, const Double_t mass)       const   {return GetKinematics(index, mass).p4;}
+    const	GTreeReal*      GetMWPC0Energy()                          const	{return MWPC0Energy;}
             Double_t        GetMWPC0Energy(const Int_t index)         const	{return MWPC0Energy[index];}
-    const	Double_t*       GetMWPC1Energy()                          const	{return MWPC1Energy;}
+    const	GTreeReal*      GetMWPC1Energy()                          const	{return MWPC1Energy;}
             Double_t        GetMWPC1Energy(const Int_t index)         const	{return MWPC1Energy[index];}
-    const	Double_t*       GetPseudoVertexX()                        const	{return pseudoVertexX;}
+    const	GTreeReal*      GetPseudoVertexX()                        const	{return pseudoVertexX;}
             Double_t        GetPseudoVertexX(const Int_t index)       const	{return pseudoVertexX[index];}
-    const	Double_t*       GetPseudoVertexY()                        const	{return pseudoVertexY;}
+    const	GTreeReal*      GetPseudoVertexY()                        const	{return pseudoVertexY;}
             Double_t        GetPseudoVertexY(const Int_t index)       const	{return pseudoVertexY[index];}
-    const	Double_t*       GetPseudoVertexZ()                        const	{return pseudoVertexZ;}
+    const	GTreeReal*      GetPseudoVertexZ()                        const	{return pseudoVertexZ;}
             Double_t        GetPseudoVertexZ(const Int_t index)       const	{return pseudoVertexZ[index];}
     virtual void            Print(const Bool_t All = kFALSE)    const;
 
@@ -97,30 +136,39 @@ public:
     friend  class GTreeMeson;
 };
 
-TLorentzVector	GTreeTrack::GetVector(const Int_t index) const
+const GTreeTrack::Kinematics&  GTreeTrack::GetKinematics(const Int_t index, const Double_t mass)    const
 {
-    Double_t th = theta[index] * TMath::DegToRad();
-    Double_t ph = phi[index]   * TMath::DegToRad();
-
-    Double_t Px = clusterEnergy[index]* sin(th)*cos(ph);
-    Double_t Py = clusterEnergy[index]* sin(th)*sin(ph);
-    Double_t Pz = clusterEnergy[index]* cos(th);
+    Kinematics& k   = kinematics[index];
+    if(k.directionGeneration != generation)
+    {
+        Double_t th = theta[index] * TMath::DegToRad();
+        Double_t ph = phi[index]   * TMath::DegToRad();
+        k.sinTheta  = sin(th);
+        k.cosTheta  = cos(th);
+        k.sinPhi    = sin(ph);
+        k.cosPhi    = cos(ph);
+        k.direction = GKinematics::FromAngles(1.0, 0.0, k.sinTheta, k.cosTheta, k.sinPhi, k.cosPhi);
+        k.directionGeneration   = generation;
+    }
+    if(mass >= 0 && (k.p4Generation != generation || k.mass != mass))
+    {
+        Double_t E  = clusterEnergy[index] + mass;
+        Double_t P  = TMath::Sqrt(E*E - mass*mass);
+        k.p4    = GKinematics::FromAngles(P, E, k.sinTheta, k.cosTheta, k.sinPhi, k.cosPhi);
+        k.mass  = mass;
+        k.p4Generation  = generation;
+    }
+    return k;
+}
 
-    return TLorentzVector(Px, Py, Pz, clusterEnergy[index]);
+TLorentzVector	GTreeTrack::GetVector(const Int_t index) const
+{
+    return GetP4(index, 0).ToTLorentzVector();
 }
 
 TLorentzVector	GTreeTrack::GetVector(const Int_t index, const Double_t mass) const
 {
-    Double_t th = theta[index] * TMath::DegToRad();
-    Double_t ph = phi[index]   * TMath::DegToRad();
-
-    Double_t E 	= clusterEnergy[index] + mass;
-    Double_t P 	= TMath::Sqrt(E*E - mass*mass);
-    Double_t Px = P* sin(th)*cos(ph);
-    Double_t Py = P* sin(th)*sin(ph);
-    Double_t Pz = P* cos(th);
-
-    return TLorentzVector(Px, Py, Pz, E);
+    return GetP4(index, mass).ToTLorentzVector();
 }
 
 Int_t		GTreeTrack::GetNCB()	const
@@ -148,6 +196,7 @@ Bool_t      GTreeTrack::HasCB(const Int_t index) const
     if (detectors[index] & DETECTOR_NaI) return true;
     if (detectors[index] & DETECTOR_PID) return true;
     if (detectors[index] & DETECTOR_MWPC) return true;
+    return false;
 }
 
 Bool_t      GTreeTrack::HasTAPS(const Int_t index) const
@@ -155,5 +204,6 @@ Bool_t      GTreeTrack::HasTAPS(const Int_t index) const
     if (detectors[index] & DETECTOR_BaF2) return true;
     if (detectors[index] & DETECTOR_PbWO4) return true;
     if (detectors[index] & DETECTOR_Veto) return true;
+    return false;
 }
 #endif
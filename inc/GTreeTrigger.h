@@ -4,31 +4,51 @@
 
 #include "Rtypes.h"
 #include "GTree.h"
+#include "GTreeColumn.h"
 
 
 #define GTreeTrigger_MAX 256
 
+#define GTreeTrigger_SCALARS(SCALAR, ARG)           \
+    SCALAR(ARG, Double_t,   energySum)              \
+    SCALAR(ARG, Int_t,      multiplicity)           \
+    SCALAR(ARG, Int_t,      nTriggerPattern)        \
+    SCALAR(ARG, Int_t,      nErrors)
+
+// [nTriggerPattern]
+#define GTreeTrigger_PATTERN_COLUMNS(COLUMN, ARG)   \
+    COLUMN(ARG, Int_t,      triggerPattern)
+
+// [nErrors]
+#define GTreeTrigger_ERROR_COLUMNS(COLUMN, ARG)     \
+    COLUMN(ARG, Int_t,      errorModuleID)          \
+    COLUMN(ARG, Int_t,      errorModuleIndex)       \
+    COLUMN(ARG, Int_t,      errorCode)
+
+// only bound and written if the input has them
+#define GTreeTrigger_HELICITY_SCALARS(SCALAR, ARG)  \
+    SCALAR(ARG, Bool_t,     helicity)
+
+#define GTreeTrigger_MCID_SCALARS(SCALAR, ARG)      \
+    SCALAR(ARG, Long64_t,   mc_evt_id)              \
+    SCALAR(ARG, Long64_t,   mc_rnd_id)
+
 
 class  GTreeTrigger : public GTree
 {
 private:
-    Double_t 	energySum;
-    Int_t 		multiplicity;
-    Int_t 		nTriggerPattern;
-    Int_t 		triggerPattern[GTreeTrigger_MAX];
-    Int_t 		nErrors;
-    Int_t 		errorModuleID[GTreeTrigger_MAX];
-    Int_t 		errorModuleIndex[GTreeTrigger_MAX];
-    Int_t 		errorCode[GTreeTrigger_MAX];
-    Bool_t      helicity;
-    Long64_t    MC_evt_id;
-    Long64_t    MC_rnd_id;
+    GTreeTrigger_SCALARS(GTREE_DECLARE_SCALAR, )
+    GTreeTrigger_PATTERN_COLUMNS(GTREE_DECLARE_COLUMN, )
+    GTreeTrigger_ERROR_COLUMNS(GTREE_DECLARE_COLUMN, )
+    GTreeTrigger_HELICITY_SCALARS(GTREE_DECLARE_SCALAR, )
+    GTreeTrigger_MCID_SCALARS(GTREE_DECLARE_SCALAR, )
     Bool_t      hasHelicity;
     Bool_t      hasMCID;
 
    protected:
     virtual void    SetBranchAdresses();
     virtual void    SetBranches();
+    virtual void    ConvertInput();
 
 public:
     GTreeTrigger(GTreeManager *Manager);
@@ -0,0 +1,61 @@
+#ifndef __GWorkerPool_h__
+#define __GWorkerPool_h__
+
+
+#include <string>
+#include <vector>
+#include <deque>
+
+#include "GChunkPlanner.h"
+
+
+/**
+ * @brief Runs the chunks of a GChunkPlanner on a pool of local worker processes.
+ *
+ *   Chunks are dealt largest-first to per-worker queues, balancing the queued
+ *   number of events. A worker takes the next chunk from the front of its own
+ *   queue; an idle worker steals the smallest chunk of the most loaded queue.
+ *   Failed chunks are retried, and the parts of a split file are merged with
+ *   goat-merge at the end.
+ */
+class  GWorkerPool
+{
+private:
+    struct  Task
+    {
+        GChunk      chunk;
+        Int_t       attempts;
+        Bool_t      success;
+    };
+
+    struct  Worker
+    {
+        std::deque<Int_t>   queue;
+        Double_t            load;
+        Int_t               pid;
+        Int_t               task;
+    };
+
+    GChunkPlanner*      planner;
+    std::string         executable;
+    std::string         merger;
+    Int_t               nWorkers;
+    Int_t               maxRetries;
+    std::vector<Task>   tasks;
+    std::vector<Worker> workers;
+
+            void    Distribute();
+            Int_t   Execute(const std::string& program, const std::vector<std::string>& args, const std::string& logFile);
+            Bool_t  Merge();
+            Int_t   NextTask(const Int_t worker);
+            Bool_t  Verify(const std::string& fileName);
+
+public:
+    GWorkerPool(GChunkPlanner* Planner, const std::string& Executable, const Int_t NWorkers, const Int_t MaxRetries = 2);
+    virtual ~GWorkerPool();
+
+            Bool_t  Run();
+            void    SetMerger(const std::string& program)   {merger = program;}
+};
+
+#endif
@@ -10,6 +10,7 @@
 #include "GSort.h"
 #include "GParticleReconstruction.h"
 #include "GMesonReconstruction.h"
+#include "GReclustering.h"
 
 
 class	GoAT : public GSort, public GParticleReconstruction, public GMesonReconstruction
@@ -22,8 +23,15 @@ private:
     Bool_t 	useMesonReconstruction;
 
     Int_t 	nEventsWritten;
+
+    GEventBlock block;
+    GReclustering*  reclustering;   // 0 => tracks as read
+
+    void    ProcessSortedEvent(const Int_t* trackFlags);
+
 protected:
     virtual void 	ProcessEvent();
+    virtual void    ProcessBlock(const UInt_t min, const UInt_t max);
     virtual Bool_t	Start();
 
 
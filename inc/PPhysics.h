@@ -25,9 +25,7 @@ private:
 	
 	Double_t PvR_ratio;
 		
-	TLorentzVector beam;
 	TLorentzVector target;
-	TLorentzVector particle;
 	TLorentzVector missingp4;
 	
 	Double_t time;
@@ -42,7 +40,8 @@ private:
 	
 	
 protected:
-
+    // missing mass of one particle for every tagged photon, valid until the next event
+    const Double_t* CalcMissingMasses(const GTreeParticle& tree, Int_t particle_index);
 
 public:
     PPhysics();
@@ -0,0 +1,61 @@
+#!/bin/bash
+# Generates src/GDetectorGeometry.cc from the crystal position tables
+# macros/NaI.dat and macros/BaF2-PbWO4.dat (columns: channel x y z in cm).
+# Rerun after changing one of the tables.
+
+PROG=$(readlink -f ${0})
+GOATDIR=$(dirname "${PROG}")/..
+
+NAI=$GOATDIR/macros/NaI.dat
+TAPS=$GOATDIR/macros/BaF2-PbWO4.dat
+OUT=$GOATDIR/src/GDetectorGeometry.cc
+
+# prints one table, COLUMN selects the value computed from x y z
+table()
+{
+    echo "const Double_t  GDetectorGeometry::${1}[GDetectorGeometry::N_CRYSTALS] ="
+    echo "{"
+    cat $NAI $TAPS | awk -v column=$2 '
+        BEGIN { rad2deg = 45/atan2(1, 1) }
+        {
+            x = $2; y = $3; z = $4
+            r = sqrt(x*x + y*y + z*z)
+            if(column == "x")       v = x
+            if(column == "y")       v = y
+            if(column == "z")       v = z
+            if(column == "theta")   v = atan2(sqrt(x*x + y*y), z) * rad2deg
+            if(column == "phi")     v = atan2(y, x) * rad2deg
+            if(column == "ux")      v = x/r
+            if(column == "uy")      v = y/r
+            if(column == "uz")      v = z/r
+            printf("%s%.9g,", (NR%8 == 1 ? "    " : " "), v)
+            if(NR%8 == 0)   printf("\n")
+        }
+        END { if(NR%8 != 0) printf("\n") }'
+    echo "};"
+    echo
+}
+
+nNaI=$(grep -c . $NAI)
+nTAPS=$(grep -c . $TAPS)
+if [ "$nNaI" != "720" ] || [ "$nTAPS" != "438" ]
+then
+    echo "#ERROR: expected 720 NaI and 438 TAPS crystals, found $nNaI and $nTAPS. Update GDetectorGeometry.h first."
+    exit 1
+fi
+
+{
+    echo "// Generated by scripts/MakeGeometry.sh from macros/NaI.dat and macros/BaF2-PbWO4.dat, do not edit."
+    echo
+    echo "#include \"GDetectorGeometry.h\""
+    echo
+    echo
+    table X         x
+    table Y         y
+    table Z         z
+    table Theta     theta
+    table Phi       phi
+    table UnitX     ux
+    table UnitY     uy
+    table UnitZ     uz
+} > $OUT
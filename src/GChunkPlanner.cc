@@ -0,0 +1,235 @@
+#include "GChunkPlanner.h"
+
+#include <TFile.h>
+#include <TTree.h>
+#include <TMath.h>
+
+using namespace std;
+
+
+GChunkPlanner::GChunkPlanner()  :
+    GConfigFile(),
+    nChunks(0),
+    eventsPerChunk(0)
+{
+}
+
+GChunkPlanner::~GChunkPlanner()
+{
+}
+
+void    GChunkPlanner::SplitPath(const std::string& path, std::string& directory, std::string& name)
+{
+    std::string::size_type  pos = path.find_last_of("/");
+    if(pos == std::string::npos)
+    {
+        directory   = "./";
+        name        = path;
+        return;
+    }
+    directory   = path.substr(0, pos+1);
+    name        = path.substr(pos+1);
+}
+
+// boundaries[i] is the first event after block i. Block 0 is empty for Acqu files,
+// since events before the first scaler read are never processed.
+Bool_t  GChunkPlanner::ReadBoundaries(const char* fileName, std::vector<Int_t>& boundaries, Bool_t& isMC)
+{
+    boundaries.clear();
+
+    TFile*  file    = TFile::Open(fileName);
+    if(!file)
+    {
+        cout << "#ERROR: Can not open input file " << fileName << "!" << endl;
+        return kFALSE;
+    }
+
+    TTree*  scalers = 0;
+    file->GetObject("scalers", scalers);
+    if(scalers && scalers->GetEntries()>=2)
+    {
+        isMC    = kFALSE;
+
+        Int_t   eventNumber = 0;
+        scalers->SetBranchStatus("*", 0);
+        scalers->SetBranchStatus("eventNumber", 1);
+        scalers->SetBranchAddress("eventNumber", &eventNumber);
+        for(Long64_t i=0; i<scalers->GetEntries(); i++)
+        {
+            scalers->GetEntry(i);
+            boundaries.push_back(eventNumber);
+        }
+        file->Close();
+        return kTRUE;
+    }
+
+    isMC    = kTRUE;
+    TTree*  tracks  = 0;
+    file->GetObject("tracks", tracks);
+    if(!tracks)
+    {
+        cout << "#ERROR: Neither scaler tree nor tracks tree found in " << fileName << "!" << endl;
+        file->Close();
+        return kFALSE;
+    }
+    boundaries.push_back(0);
+    boundaries.push_back(tracks->GetEntries());
+    file->Close();
+    return kTRUE;
+}
+
+Bool_t  GChunkPlanner::MakeChunks(std::vector<GChunk>& chunks)
+{
+    chunks.clear();
+    if(nChunks<=0 && eventsPerChunk<=0)
+    {
+        cout << "#ERROR: Neither number of chunks nor events per chunk set!" << endl;
+        return kFALSE;
+    }
+
+    Int_t   nFiles  = GetNFiles();
+    std::vector< std::vector<Int_t> >   boundaries(nFiles);
+    std::vector<Bool_t>                 isMC(nFiles, kFALSE);
+    std::vector<Double_t>               nEvents(nFiles, 0);
+    Double_t                            nEventsTotal = 0;
+
+    for(Int_t i=0; i<nFiles; i++)
+    {
+        Bool_t  mc;
+        if(!ReadBoundaries(GetInputFile(i).c_str(), boundaries[i], mc))
+            return kFALSE;
+        isMC[i]     = mc;
+        nEvents[i]  = boundaries[i].back() - boundaries[i].front();
+        nEventsTotal += nEvents[i];
+        cout << GetInputFile(i) << ": " << nEvents[i] << " events in " << boundaries[i].size()-1 << " blocks." << endl;
+    }
+
+    Double_t    target  = eventsPerChunk;
+    if(nChunks>0)
+        target  = nEventsTotal/nChunks;
+    if(target<1)
+        target  = 1;
+    cout << endl << "Planning chunks of about " << target << " events." << endl;
+
+    for(Int_t i=0; i<nFiles; i++)
+    {
+        std::string outputBase  = GetOutputFile(i);
+        if(outputBase.size()>5 && outputBase.compare(outputBase.size()-5, 5, ".root") == 0)
+            outputBase.erase(outputBase.size()-5);
+
+        Int_t   nFileChunks = TMath::Nint(nEvents[i]/target);
+        if(nFileChunks<1)
+            nFileChunks = 1;
+
+        // MC files are cut at event numbers, Acqu files at scaler reads
+        Int_t   first   = 1;
+        Int_t   last    = boundaries[i].size()-1;
+        if(isMC[i])
+        {
+            first   = 0;
+            last    = boundaries[i].back()-1;
+        }
+
+        Int_t   begin   = first;
+        for(Int_t c=0; c<nFileChunks; c++)
+        {
+            Int_t   end;
+            if(c == nFileChunks-1)
+                end = last;
+            else if(isMC[i])
+                end = first + Int_t(Double_t(c+1)*(last-first+1)/nFileChunks) - 1;
+            else
+            {
+                Double_t    cut = boundaries[i].front() + Double_t(c+1)*nEvents[i]/nFileChunks;
+                end = begin;
+                while(end<last && boundaries[i][end]<cut)
+                    end++;
+            }
+            if(end<begin)
+                continue;
+
+            GChunk  chunk;
+            chunk.inputFile         = GetInputFile(i);
+            chunk.finalOutputFile   = GetOutputFile(i);
+            chunk.outputFile        = GetOutputFile(i);
+            if(nFileChunks>1)
+                chunk.outputFile    = outputBase + "_part" + std::to_string((long long)c) + ".root";
+            chunk.first             = begin;
+            chunk.last              = end;
+            chunk.isMC              = isMC[i];
+            if(isMC[i])
+                chunk.nEvents       = end-begin+1;
+            else
+                chunk.nEvents       = boundaries[i][end] - boundaries[i][begin-1];
+            chunks.push_back(chunk);
+
+            begin   = end+1;
+            if(begin>last)
+                break;
+        }
+    }
+    cout << chunks.size() << " chunks planned." << endl;
+
+    return kTRUE;
+}
+
+void    GChunkPlanner::SetArguments(const int argc, char* argv[])
+{
+    arguments.clear();
+    for(Int_t i=1; i<argc; i++)
+    {
+        if((strcmp(argv[i], "--first-scaler") == 0 || strcmp(argv[i], "--last-scaler") == 0 ||
+            strcmp(argv[i], "--first-event") == 0 || strcmp(argv[i], "--last-event") == 0) && i+1<argc)
+        {
+            i++;
+            continue;
+        }
+        arguments.push_back(argv[i]);
+    }
+}
+
+void    GChunkPlanner::GetArguments(const GChunk& chunk, std::vector<std::string>& args)   const
+{
+    std::string inputDirectory, inputName, outputDirectory, outputName;
+    SplitPath(chunk.inputFile, inputDirectory, inputName);
+    SplitPath(chunk.outputFile, outputDirectory, outputName);
+
+    args    = arguments;
+    if(args.empty())
+    {
+        args.push_back(GetConfigFile());
+        if(GetStagingDirectory().length() > 0)
+        {
+            args.push_back("--staging");
+            args.push_back(GetStagingDirectory());
+        }
+    }
+    args.push_back("-d");   args.push_back(inputDirectory);
+    args.push_back("-f");   args.push_back(inputName);
+    args.push_back("-D");   args.push_back(outputDirectory);
+    args.push_back("-F");   args.push_back(outputName);
+    args.push_back(chunk.isMC ? "--first-event" : "--first-scaler");
+    args.push_back(std::to_string((long long)chunk.first));
+    args.push_back(chunk.isMC ? "--last-event" : "--last-scaler");
+    args.push_back(std::to_string((long long)chunk.last));
+}
+
+Bool_t  GChunkPlanner::Plan(std::ostream& out)
+{
+    std::vector<GChunk> chunks;
+    if(!MakeChunks(chunks))
+        return kFALSE;
+
+    out << "# goat chunk plan: " << chunks.size() << " chunks" << endl;
+    std::vector<std::string>    args;
+    for(size_t c=0; c<chunks.size(); c++)
+    {
+        GetArguments(chunks[c], args);
+        out << "goat";
+        for(size_t a=0; a<args.size(); a++)
+            out << " " << args[a];
+        out << endl;
+    }
+
+    return kTRUE;
+}
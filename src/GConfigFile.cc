@@ -8,12 +8,22 @@
 
 
 GConfigFile::GConfigFile()  :
-    globalConfigFile()
+    globalConfigFile(),
+    firstScaler(-1),
+    lastScaler(-1),
+    firstEvent(-1),
+    lastEvent(-1),
+    stagingDirectory()
 {
 }
 
 GConfigFile::GConfigFile(const Char_t* configFile)  :
-    globalConfigFile(configFile)
+    globalConfigFile(configFile),
+    firstScaler(-1),
+    lastScaler(-1),
+    firstEvent(-1),
+    lastEvent(-1),
+    stagingDirectory()
 {
 }
 
@@ -72,6 +82,11 @@ Bool_t	GConfigFile::BaseConfig(const int argc, char* argv[], const std::string&
                 else if(strcmp(flag.c_str(), "F") == 0) outputFile = argv[i];
                 else if(strcmp(flag.c_str(), "p") == 0) inputPrefix = argv[i];
                 else if(strcmp(flag.c_str(), "P") == 0) outputPrefix = argv[i];
+                else if(strcmp(flag.c_str(), "-first-scaler") == 0) firstScaler = atoi(argv[i]);
+                else if(strcmp(flag.c_str(), "-last-scaler") == 0) lastScaler = atoi(argv[i]);
+                else if(strcmp(flag.c_str(), "-first-event") == 0) firstEvent = atoi(argv[i]);
+                else if(strcmp(flag.c_str(), "-last-event") == 0) lastEvent = atoi(argv[i]);
+                else if(strcmp(flag.c_str(), "-staging") == 0) stagingDirectory = argv[i];
                 else if(strcmp(flag.c_str(), "n") == 0)
                 {
                         overwrite = kFALSE;
@@ -152,6 +167,12 @@ Bool_t	GConfigFile::BaseConfig(const int argc, char* argv[], const std::string&
         flag.erase(0,flag.find_first_not_of(" "));
         if(strcmp(flag.c_str(),"nokey") != 0) outputPrefix = flag;
     }
+    if(stagingDirectory.length() == 0)
+    {
+        flag = ReadConfig("Staging-Directory",0,(Char_t*)serverFile.c_str());
+        flag.erase(0,flag.find_first_not_of(" "));
+        if(strcmp(flag.c_str(),"nokey") != 0) stagingDirectory = flag;
+    }
     // Finished scanning for file settings
 
     // Fix directories to include final slash if not there
@@ -167,6 +188,9 @@ Bool_t	GConfigFile::BaseConfig(const int argc, char* argv[], const std::string&
     if(outputFile.length() != 0) 	  std::cout << "Output file:      '" << outputFile      << "' chosen" << std::endl;
     if(inputPrefix.length() != 0)  	  std::cout << "Input prefix:     '" << inputPrefix     << "' chosen" << std::endl;
     if(outputPrefix.length() != 0)    std::cout << "Output prefix:    '" << outputPrefix    << "' chosen" << std::endl;
+    if(HasScalerRange())              std::cout << "Scaler reads:     " << firstScaler << " to " << lastScaler << " chosen" << std::endl;
+    if(HasEventRange())               std::cout << "Events (MC):      " << firstEvent  << " to " << lastEvent  << " chosen" << std::endl;
+    if(stagingDirectory.length() != 0) std::cout << "Staging directory: '" << stagingDirectory << "' chosen" << std::endl;
     std::cout << std::endl;
 
     std::string file;
@@ -0,0 +1,20 @@
+#include "GCrystalAngleTable.h"
+#include "GTreeColumn.h"
+
+
+GCrystalAngleTable::GCrystalAngleTable()    :
+    cosAngle(0)
+{
+    const Int_t n   = GDetectorGeometry::N_CRYSTALS;
+    cosAngle    = GTreeColumnAlloc<Float_t>(n*n);
+    for(Int_t i=0; i<n; i++)
+    {
+        for(Int_t j=0; j<n; j++)
+            cosAngle[i*n + j]   = GDetectorGeometry::GetCosAngle(i, j);
+    }
+}
+
+GCrystalAngleTable::~GCrystalAngleTable()
+{
+    free(cosAngle);
+}
@@ -0,0 +1,126 @@
+#include "GCutRaster.h"
+
+#include <cstring>
+#include <TMath.h>
+
+
+GCutRaster::GCutRaster(TCutG* _Cut)  :
+    cut(_Cut),
+    exact(kFALSE),
+    xMin(0),
+    xMax(0),
+    yMin(0),
+    yMax(0),
+    xScale(0),
+    yScale(0),
+    nBoundary(0)
+{
+    memset(inside, 0, sizeof(inside));
+    memset(boundary, 0, sizeof(boundary));
+
+    Int_t       n   = cut->GetN();
+    Double_t*   x   = cut->GetX();
+    Double_t*   y   = cut->GetY();
+    if(n < 3)
+    {
+        exact   = kTRUE;
+        return;
+    }
+
+    xMin    = xMax  = x[0];
+    yMin    = yMax  = y[0];
+    for(Int_t i=1; i<n; i++)
+    {
+        if(x[i] < xMin) xMin    = x[i];
+        if(x[i] > xMax) xMax    = x[i];
+        if(y[i] < yMin) yMin    = y[i];
+        if(y[i] > yMax) yMax    = y[i];
+    }
+    if(!(xMax > xMin) || !(yMax > yMin))
+    {
+        exact   = kTRUE;
+        return;
+    }
+    xScale  = GCutRaster_CELLS / (xMax - xMin);
+    yScale  = GCutRaster_CELLS / (yMax - yMin);
+
+    // TCutG::IsInside closes the polygon from the last to the first point
+    for(Int_t i=0, j=n-1; i<n; j=i++)
+        MarkEdge(x[j], y[j], x[i], y[i]);
+
+    // no edge crosses the other cells, so their centre decides for all points
+    for(Int_t iy=0; iy<GCutRaster_CELLS; iy++)
+    {
+        for(Int_t ix=0; ix<GCutRaster_CELLS; ix++)
+        {
+            Int_t       cell    = iy*GCutRaster_CELLS + ix;
+            ULong64_t   bit     = 1ULL << (cell & 63);
+            if(boundary[cell >> 6] & bit)
+            {
+                nBoundary++;
+                continue;
+            }
+            if(cut->IsInside(xMin + (ix + 0.5)/xScale, yMin + (iy + 0.5)/yScale))
+                inside[cell >> 6]   |= bit;
+        }
+    }
+}
+
+void    GCutRaster::MarkEdge(const Double_t x0, const Double_t y0, const Double_t x1, const Double_t y1)
+{
+    // cells are widened by a margin, so points that round into a
+    // neighbouring cell still find a boundary cell next to an edge
+    const Double_t  margin  = 0.01;
+
+    // edge in cell units
+    Double_t    u0  = (x0 - xMin) * xScale;
+    Double_t    v0  = (y0 - yMin) * yScale;
+    Double_t    du  = (x1 - xMin) * xScale - u0;
+    Double_t    dv  = (y1 - yMin) * yScale - v0;
+
+    Int_t   ixMin   = Int_t(TMath::Floor(TMath::Min(u0, u0+du) - margin));
+    Int_t   ixMax   = Int_t(TMath::Floor(TMath::Max(u0, u0+du) + margin));
+    Int_t   iyMin   = Int_t(TMath::Floor(TMath::Min(v0, v0+dv) - margin));
+    Int_t   iyMax   = Int_t(TMath::Floor(TMath::Max(v0, v0+dv) + margin));
+    ixMin   = TMath::Max(ixMin, 0);
+    iyMin   = TMath::Max(iyMin, 0);
+    ixMax   = TMath::Min(ixMax, GCutRaster_CELLS - 1);
+    iyMax   = TMath::Min(iyMax, GCutRaster_CELLS - 1);
+
+    for(Int_t iy=iyMin; iy<=iyMax; iy++)
+    {
+        for(Int_t ix=ixMin; ix<=ixMax; ix++)
+        {
+            // clip the edge against the widened cell (Liang-Barsky)
+            Double_t    t0  = 0;
+            Double_t    t1  = 1;
+            Double_t    p[4]    = {-du, du, -dv, dv};
+            Double_t    q[4]    = {u0 - (ix - margin), (ix + 1 + margin) - u0, v0 - (iy - margin), (iy + 1 + margin) - v0};
+            Bool_t      hit = kTRUE;
+            for(Int_t k=0; k<4 && hit; k++)
+            {
+                if(p[k] == 0)
+                {
+                    if(q[k] < 0)    hit = kFALSE;
+                    continue;
+                }
+                Double_t    t   = q[k] / p[k];
+                if(p[k] < 0)
+                {
+                    if(t > t1)      hit = kFALSE;
+                    else if(t > t0) t0  = t;
+                }
+                else
+                {
+                    if(t < t0)      hit = kFALSE;
+                    else if(t < t1) t1  = t;
+                }
+            }
+            if(hit)
+            {
+                Int_t   cell    = iy*GCutRaster_CELLS + ix;
+                boundary[cell >> 6] |= 1ULL << (cell & 63);
+            }
+        }
+    }
+}
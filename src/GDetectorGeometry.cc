@@ -0,0 +1,1197 @@
+// Generated by scripts/MakeGeometry.sh from macros/NaI.dat and macros/BaF2-PbWO4.dat, do not edit.
+
+#include "GDetectorGeometry.h"
+
+
+const Double_t  GDetectorGeometry::X[GDetectorGeometry::N_CRYSTALS] =
+{
+    3.619, 7.322, 6.266, 11.996, 15.678, 9.929, 14.668, 18.449,
+    8.702, 12.374, 11.018, 17.383, 21.037, 14.607, 19.617, 22.927,
+    12.987, 16.35, 14.498, 21.279, 23.567, 16.733, 20.874, 21.983,
+    13.115, 13.553, 9.01, 18.281, 18.526, 9.225, 14.014, 13.99,
+    4.574, 4.518, -0.057, 9.143, 8.814, -0.13, 4.115, 4.03,
+    -4.432, -4.503, -8.643, -0.286, -1.16, -9.497, -6.231, -7.868,
+    19.987, 23.697, 23.17, 27.482, 30.814, 26.824, 30.685, 33.386,
+    25.758, 28.762, 27.35, 32.528, 34.786, 29.608, 33.278, 34.9,
+    27.473, 28.681, 25.884, 32.438, 33.301, 26.488, 30.148, 30.235,
+    22.835, 22.839, 18.507, 26.582, 26.095, 18.178, 22.023, 20.953,
+    13.331, 12.711, 8.109, 16.488, 15.625, 7.246, 10.986, 9.839,
+    2.293, 0.653, -4.437, 4.459, 3.063, -5.967, -2.271, -3.651,
+    33.745, 36.539, 36.308, 38.824, 41.059, 38.596, 41.062, 42.742,
+    37.932, 39.749, 38.225, 42.092, 42.952, 39.088, 41.471, 41.521,
+    36.626, 36.69, 33.452, 39.201, 38.588, 32.858, 35.482, 34.335,
+    29.155, 28.162, 24.031, 30.718, 29.864, 23.157, 26.434, 25.719,
+    19.216, 18.561, 13.823, 21.787, 20.672, 12.427, 16.05, 14.609,
+    7.047, 5.603, 0.24, 9.541, 8.123, -1.148, 2.797, 1.382,
+    3.619, 7.322, 11.996, 6.266, 9.929, 15.678, 14.668, 18.449,
+    19.987, 23.697, 27.482, 23.17, 26.824, 30.814, 30.685, 33.386,
+    33.745, 36.539, 38.824, 36.308, 38.596, 41.059, 41.062, 42.742,
+    42.441, 43.859, 44.156, 44.156, 44.903, 44.903, 45.351, 45.272,
+    44.348, 44.264, 42.917, 44.739, 43.673, 42.012, 42.292, 40.423,
+    40.003, 38.279, 35.718, 38.419, 35.591, 32.954, 32.687, 28.882,
+    8.702, 12.374, 17.383, 11.018, 14.607, 21.037, 19.617, 22.927,
+    25.758, 28.762, 32.528, 27.35, 29.608, 34.786, 33.278, 34.9,
+    37.932, 39.749, 42.092, 38.225, 39.088, 42.952, 41.471, 41.521,
+    44.348, 44.264, 44.739, 42.917, 42.012, 43.673, 42.292, 40.423,
+    43.139, 41.134, 39.798, 39.798, 37.006, 37.006, 35.551, 31.839,
+    34.803, 31.088, 28.071, 29.579, 25.063, 23.794, 22.293, 17.73,
+    12.987, 16.35, 21.279, 14.498, 16.733, 23.567, 20.874, 21.983,
+    27.473, 28.681, 32.438, 25.884, 26.488, 33.301, 30.148, 30.235,
+    36.626, 36.69, 39.201, 33.452, 32.858, 38.588, 35.482, 34.335,
+    40.003, 38.279, 38.419, 35.718, 32.954, 35.591, 32.687, 28.882,
+    34.803, 31.088, 29.579, 28.071, 23.794, 25.063, 22.293, 17.73,
+    22.803, 18.13, 15.826, 15.826, 11.286, 11.286, 9.051, 4.473,
+    -1.382, -2.797, 1.148, -8.123, -9.541, -0.24, -5.603, -7.047,
+    3.651, 2.271, 5.967, -3.063, -4.459, 4.437, -0.653, -2.293,
+    7.868, 6.231, 9.497, 1.16, 0.286, 8.643, 4.503, 4.432,
+    13.115, 13.553, 18.281, 9.01, 9.225, 18.526, 14.014, 13.99,
+    22.835, 22.839, 26.582, 18.507, 18.178, 26.095, 22.023, 20.953,
+    29.155, 28.162, 30.718, 24.031, 23.157, 29.864, 26.434, 25.719,
+    -14.609, -16.05, -12.427, -20.672, -21.787, -13.823, -18.561, -19.216,
+    -9.839, -10.986, -7.246, -15.625, -16.488, -8.109, -12.711, -13.331,
+    -4.03, -4.115, 0.13, -8.814, -9.143, 0.057, -4.518, -4.574,
+    4.574, 4.518, 9.143, -0.057, -0.13, 8.814, 4.115, 4.03,
+    13.331, 12.711, 16.488, 8.109, 7.246, 15.625, 10.986, 9.839,
+    19.216, 18.561, 21.787, 13.823, 12.427, 20.672, 16.05, 14.609,
+    -25.719, -26.434, -23.157, -29.864, -30.718, -24.031, -28.162, -29.155,
+    -20.953, -22.023, -18.178, -26.095, -26.582, -18.507, -22.839, -22.835,
+    -13.99, -14.014, -9.225, -18.526, -18.281, -9.01, -13.553, -13.115,
+    -4.432, -4.503, -0.286, -8.643, -9.497, -1.16, -6.231, -7.868,
+    2.293, 0.653, 4.459, -4.437, -5.967, 3.063, -2.271, -3.651,
+    7.047, 5.603, 9.541, 0.24, -1.148, 8.123, 2.797, 1.382,
+    -4.473, -9.051, -11.286, -11.286, -15.826, -15.826, -18.13, -22.803,
+    -17.73, -22.293, -23.794, -25.063, -29.579, -28.071, -31.088, -34.803,
+    -28.882, -32.687, -32.954, -35.591, -38.419, -35.718, -38.279, -40.003,
+    -34.335, -35.482, -32.858, -38.588, -39.201, -33.452, -36.69, -36.626,
+    -30.235, -30.148, -26.488, -33.301, -32.438, -25.884, -28.681, -27.473,
+    -21.983, -20.874, -16.733, -23.567, -21.279, -14.498, -16.35, -12.987,
+    -17.73, -22.293, -25.063, -23.794, -28.071, -29.579, -31.088, -34.803,
+    -31.839, -35.551, -37.006, -37.006, -39.798, -39.798, -41.134, -43.139,
+    -40.423, -42.292, -42.012, -43.673, -44.739, -42.917, -44.264, -44.348,
+    -41.521, -41.471, -39.088, -42.952, -42.092, -38.225, -39.749, -37.932,
+    -34.9, -33.278, -29.608, -34.786, -32.528, -27.35, -28.762, -25.758,
+    -22.927, -19.617, -14.607, -21.037, -17.383, -11.018, -12.374, -8.702,
+    -28.882, -32.687, -35.591, -32.954, -35.718, -38.419, -38.279, -40.003,
+    -40.423, -42.292, -43.673, -42.012, -42.917, -44.739, -44.264, -44.348,
+    -45.272, -45.351, -44.903, -44.903, -44.156, -44.156, -43.859, -42.441,
+    -42.742, -41.062, -38.596, -41.059, -38.824, -36.308, -36.539, -33.745,
+    -33.386, -30.685, -26.824, -30.814, -27.482, -23.17, -23.697, -19.987,
+    -18.449, -14.668, -9.929, -15.678, -11.996, -6.266, -7.322, -3.619,
+    -1.382, -2.797, -8.123, 1.148, -0.24, -9.541, -5.603, -7.047,
+    -14.609, -16.05, -20.672, -12.427, -13.823, -21.787, -18.561, -19.216,
+    -25.719, -26.434, -29.864, -23.157, -24.031, -30.718, -28.162, -29.155,
+    -34.335, -35.482, -38.588, -32.858, -33.452, -39.201, -36.69, -36.626,
+    -41.521, -41.471, -42.952, -39.088, -38.225, -42.092, -39.749, -37.932,
+    -42.742, -41.062, -41.059, -38.596, -36.308, -38.824, -36.539, -33.745,
+    3.651, 2.271, -3.063, 5.967, 4.437, -4.459, -0.653, -2.293,
+    -9.839, -10.986, -15.625, -7.246, -8.109, -16.488, -12.711, -13.331,
+    -20.953, -22.023, -26.095, -18.178, -18.507, -26.582, -22.839, -22.835,
+    -30.235, -30.148, -33.301, -26.488, -25.884, -32.438, -28.681, -27.473,
+    -34.9, -33.278, -34.786, -29.608, -27.35, -32.528, -28.762, -25.758,
+    -33.386, -30.685, -30.814, -26.824, -23.17, -27.482, -23.697, -19.987,
+    7.868, 6.231, 1.16, 9.497, 8.643, 0.286, 4.503, 4.432,
+    -4.03, -4.115, -8.814, 0.13, 0.057, -9.143, -4.518, -4.574,
+    -13.99, -14.014, -18.526, -9.225, -9.01, -18.281, -13.553, -13.115,
+    -21.983, -20.874, -23.567, -16.733, -14.498, -21.279, -16.35, -12.987,
+    -22.927, -19.617, -21.037, -14.607, -11.018, -17.383, -12.374, -8.702,
+    -18.449, -14.668, -15.678, -9.929, -6.266, -11.996, -7.322, -3.619,
+    -3.849, -6.543, -3.849, -6.543, -9.045, -11.739, -9.045, -11.739,
+    -9.045, -11.739, -9.045, -11.739, -15.588, -15.588, -15.588, -20.785,
+    -20.785, -20.785, -20.785, -25.981, -25.981, -25.981, -25.981, -25.981,
+    -31.177, -31.177, -31.177, -31.177, -31.177, -31.177, -36.373, -36.373,
+    -36.373, -36.373, -36.373, -36.373, -36.373, -41.569, -41.569, -41.569,
+    -41.569, -41.569, -41.569, -41.569, -41.569, -46.765, -46.765, -46.765,
+    -46.765, -46.765, -46.765, -46.765, -46.765, -46.765, -51.962, -51.962,
+    -51.962, -51.962, -51.962, -51.962, -51.962, -51.962, -51.962, -51.962,
+    -57.158, -57.158, -57.158, -57.158, -57.158, -57.158, -57.158, -57.158,
+    -57.158, -3.849, -6.543, -3.849, -6.543, -9.045, -11.739, -9.045,
+    -11.739, -3.849, -6.543, -3.849, -6.543, -15.588, -10.392, -5.196,
+    -20.785, -15.588, -10.392, -5.196, -25.981, -20.785, -15.588, -10.392,
+    -5.196, -31.177, -25.981, -20.785, -15.588, -10.392, -5.196, -36.373,
+    -31.177, -25.981, -20.785, -15.588, -10.392, -5.196, -41.569, -36.373,
+    -31.177, -25.981, -20.785, -15.588, -10.392, -5.196, -46.765, -41.569,
+    -36.373, -31.177, -25.981, -20.785, -15.588, -10.392, -5.196, -51.962,
+    -46.765, -41.569, -36.373, -31.177, -25.981, -20.785, -15.588, -10.392,
+    -5.196, -51.962, -46.765, -41.569, -36.373, -31.177, -25.981, -20.785,
+    -15.588, -10.392, 1.347, -1.347, 1.347, -1.347, 1.347, -1.347,
+    1.347, -1.347, 6.543, 3.849, 6.543, 3.849, 0, 5.196,
+    10.392, 0, 5.196, 10.392, 15.588, 0, 5.196, 10.392,
+    15.588, 20.785, 0, 5.196, 10.392, 15.588, 20.785, 25.981,
+    0, 5.196, 10.392, 15.588, 20.785, 25.981, 31.177, 0,
+    5.196, 10.392, 15.588, 20.785, 25.981, 31.177, 36.373, 0,
+    5.196, 10.392, 15.588, 20.785, 25.981, 31.177, 36.373, 41.569,
+    0, 5.196, 10.392, 15.588, 20.785, 25.981, 31.177, 36.373,
+    41.569, 46.765, 10.392, 15.588, 20.785, 25.981, 31.177, 36.373,
+    41.569, 46.765, 51.962, 6.543, 3.849, 6.543, 3.849, 11.739,
+    9.045, 11.739, 9.045, 11.739, 9.045, 11.739, 9.045, 15.588,
+    15.588, 15.588, 20.785, 20.785, 20.785, 20.785, 25.981, 25.981,
+    25.981, 25.981, 25.981, 31.177, 31.177, 31.177, 31.177, 31.177,
+    31.177, 36.373, 36.373, 36.373, 36.373, 36.373, 36.373, 36.373,
+    41.569, 41.569, 41.569, 41.569, 41.569, 41.569, 41.569, 41.569,
+    46.765, 46.765, 46.765, 46.765, 46.765, 46.765, 46.765, 46.765,
+    46.765, 51.962, 51.962, 51.962, 51.962, 51.962, 51.962, 51.962,
+    51.962, 51.962, 51.962, 57.158, 57.158, 57.158, 57.158, 57.158,
+    57.158, 57.158, 57.158, 57.158, 6.543, 3.849, 6.543, 3.849,
+    11.739, 9.045, 11.739, 9.045, 6.543, 3.849, 6.543, 3.849,
+    15.588, 10.392, 5.196, 20.785, 15.588, 10.392, 5.196, 25.981,
+    20.785, 15.588, 10.392, 5.196, 31.177, 25.981, 20.785, 15.588,
+    10.392, 5.196, 36.373, 31.177, 25.981, 20.785, 15.588, 10.392,
+    5.196, 41.569, 36.373, 31.177, 25.981, 20.785, 15.588, 10.392,
+    5.196, 46.765, 41.569, 36.373, 31.177, 25.981, 20.785, 15.588,
+    10.392, 5.196, 51.962, 46.765, 41.569, 36.373, 31.177, 25.981,
+    20.785, 15.588, 10.392, 5.196, 51.962, 46.765, 41.569, 36.373,
+    31.177, 25.981, 20.785, 15.588, 10.392, 1.347, -1.347, 1.347,
+    -1.347, 1.347, -1.347, 1.347, -1.347, -3.849, -6.543, -3.849,
+    -6.543, 0, -5.196, -10.392, 0, -5.196, -10.392, -15.588,
+    0, -5.196, -10.392, -15.588, -20.785, 0, -5.196, -10.392,
+    -15.588, -20.785, -25.981, 0, -5.196, -10.392, -15.588, -20.785,
+    -25.981, -31.177, 0, -5.196, -10.392, -15.588, -20.785, -25.981,
+    -31.177, -36.373, 0, -5.196, -10.392, -15.588, -20.785, -25.981,
+    -31.177, -36.373, -41.569, 0, -5.196, -10.392, -15.588, -20.785,
+    -25.981, -31.177, -36.373, -41.569, -46.765, -10.392, -15.588, -20.785,
+    -25.981, -31.177, -36.373, -41.569, -46.765, -51.962,
+};
+
+const Double_t  GDetectorGeometry::Y[GDetectorGeometry::N_CRYSTALS] =
+{
+    45.214, 44.51, 43.725, 43.725, 42.29, 42.29, 41.639, 39.214,
+    40.717, 38.342, 36.086, 37.488, 34.038, 32.935, 31.74, 27.792,
+    30.283, 26.454, 23.456, 25.158, 20.582, 18.985, 17.405, 12.29,
+    16.22, 11.811, 9.46, 9.46, 4.758, 4.758, 2.406, -2.859,
+    2.351, -2.793, -5.144, -5.651, -11.234, -10.379, -13.612, -18.699,
+    -12.29, -17.405, -18.985, -20.582, -25.158, -23.456, -26.454, -30.283,
+    40.717, 38.342, 37.488, 36.086, 32.935, 34.038, 31.74, 27.792,
+    32.312, 28.214, 25.992, 25.992, 21.475, 21.475, 19.18, 14.027,
+    18.699, 13.612, 10.379, 11.234, 5.651, 5.144, 2.793, -2.351,
+    2.351, -2.793, -5.651, -5.144, -10.379, -11.234, -13.612, -18.699,
+    -14.027, -19.18, -21.475, -21.475, -25.992, -25.992, -28.214, -32.312,
+    -27.792, -31.74, -32.935, -34.038, -37.488, -36.086, -38.342, -40.717,
+    30.283, 26.454, 25.158, 23.456, 18.985, 20.582, 17.405, 12.29,
+    18.699, 13.612, 11.234, 10.379, 5.144, 5.651, 2.793, -2.351,
+    2.859, -2.406, -4.758, -4.758, -9.46, -9.46, -11.811, -16.22,
+    -12.29, -17.405, -20.582, -18.985, -23.456, -25.158, -26.454, -30.283,
+    -27.792, -31.74, -34.038, -32.935, -36.086, -37.488, -38.342, -40.717,
+    -39.214, -41.639, -42.29, -42.29, -43.725, -43.725, -44.51, -45.214,
+    45.214, 44.51, 43.725, 43.725, 42.29, 42.29, 41.639, 39.214,
+    40.717, 38.342, 36.086, 37.488, 34.038, 32.935, 31.74, 27.792,
+    30.283, 26.454, 23.456, 25.158, 20.582, 18.985, 17.405, 12.29,
+    16.22, 11.811, 9.46, 9.46, 4.758, 4.758, 2.406, -2.859,
+    2.351, -2.793, -5.144, -5.651, -11.234, -10.379, -13.612, -18.699,
+    -12.29, -17.405, -18.985, -20.582, -25.158, -23.456, -26.454, -30.283,
+    40.717, 38.342, 37.488, 36.086, 32.935, 34.038, 31.74, 27.792,
+    32.312, 28.214, 25.992, 25.992, 21.475, 21.475, 19.18, 14.027,
+    18.699, 13.612, 10.379, 11.234, 5.651, 5.144, 2.793, -2.351,
+    2.351, -2.793, -5.651, -5.144, -10.379, -11.234, -13.612, -18.699,
+    -14.027, -19.18, -21.475, -21.475, -25.992, -25.992, -28.214, -32.312,
+    -27.792, -31.74, -32.935, -34.038, -37.488, -36.086, -38.342, -40.717,
+    30.283, 26.454, 25.158, 23.456, 18.985, 20.582, 17.405, 12.29,
+    18.699, 13.612, 11.234, 10.379, 5.144, 5.651, 2.793, -2.351,
+    2.859, -2.406, -4.758, -4.758, -9.46, -9.46, -11.811, -16.22,
+    -12.29, -17.405, -20.582, -18.985, -23.456, -25.158, -26.454, -30.283,
+    -27.792, -31.74, -34.038, -32.935, -36.086, -37.488, -38.342, -40.717,
+    -39.214, -41.639, -42.29, -42.29, -43.725, -43.725, -44.51, -45.214,
+    45.214, 44.51, 43.725, 43.725, 42.29, 42.29, 41.639, 39.214,
+    40.717, 38.342, 36.086, 37.488, 34.038, 32.935, 31.74, 27.792,
+    30.283, 26.454, 23.456, 25.158, 20.582, 18.985, 17.405, 12.29,
+    16.22, 11.811, 9.46, 9.46, 4.758, 4.758, 2.406, -2.859,
+    2.351, -2.793, -5.144, -5.651, -11.234, -10.379, -13.612, -18.699,
+    -12.29, -17.405, -18.985, -20.582, -25.158, -23.456, -26.454, -30.283,
+    40.717, 38.342, 37.488, 36.086, 32.935, 34.038, 31.74, 27.792,
+    32.312, 28.214, 25.992, 25.992, 21.475, 21.475, 19.18, 14.027,
+    18.699, 13.612, 10.379, 11.234, 5.651, 5.144, 2.793, -2.351,
+    2.351, -2.793, -5.651, -5.144, -10.379, -11.234, -13.612, -18.699,
+    -14.027, -19.18, -21.475, -21.475, -25.992, -25.992, -28.214, -32.312,
+    -27.792, -31.74, -32.935, -34.038, -37.488, -36.086, -38.342, -40.717,
+    30.283, 26.454, 25.158, 23.456, 18.985, 20.582, 17.405, 12.29,
+    18.699, 13.612, 11.234, 10.379, 5.144, 5.651, 2.793, -2.351,
+    2.859, -2.406, -4.758, -4.758, -9.46, -9.46, -11.811, -16.22,
+    -12.29, -17.405, -20.582, -18.985, -23.456, -25.158, -26.454, -30.283,
+    -27.792, -31.74, -34.038, -32.935, -36.086, -37.488, -38.342, -40.717,
+    -39.214, -41.639, -42.29, -42.29, -43.725, -43.725, -44.51, -45.214,
+    45.214, 44.51, 43.725, 43.725, 42.29, 42.29, 41.639, 39.214,
+    40.717, 38.342, 36.086, 37.488, 34.038, 32.935, 31.74, 27.792,
+    30.283, 26.454, 23.456, 25.158, 20.582, 18.985, 17.405, 12.29,
+    16.22, 11.811, 9.46, 9.46, 4.758, 4.758, 2.406, -2.859,
+    2.351, -2.793, -5.144, -5.651, -11.234, -10.379, -13.612, -18.699,
+    -12.29, -17.405, -18.985, -20.582, -25.158, -23.456, -26.454, -30.283,
+    40.717, 38.342, 37.488, 36.086, 32.935, 34.038, 31.74, 27.792,
+    32.312, 28.214, 25.992, 25.992, 21.475, 21.475, 19.18, 14.027,
+    18.699, 13.612, 10.379, 11.234, 5.651, 5.144, 2.793, -2.351,
+    2.351, -2.793, -5.651, -5.144, -10.379, -11.234, -13.612, -18.699,
+    -14.027, -19.18, -21.475, -21.475, -25.992, -25.992, -28.214, -32.312,
+    -27.792, -31.74, -32.935, -34.038, -37.488, -36.086, -38.342, -40.717,
+    30.283, 26.454, 25.158, 23.456, 18.985, 20.582, 17.405, 12.29,
+    18.699, 13.612, 11.234, 10.379, 5.144, 5.651, 2.793, -2.351,
+    2.859, -2.406, -4.758, -4.758, -9.46, -9.46, -11.811, -16.22,
+    -12.29, -17.405, -20.582, -18.985, -23.456, -25.158, -26.454, -30.283,
+    -27.792, -31.74, -34.038, -32.935, -36.086, -37.488, -38.342, -40.717,
+    -39.214, -41.639, -42.29, -42.29, -43.725, -43.725, -44.51, -45.214,
+    45.214, 44.51, 43.725, 43.725, 42.29, 42.29, 41.639, 39.214,
+    40.717, 38.342, 36.086, 37.488, 34.038, 32.935, 31.74, 27.792,
+    30.283, 26.454, 23.456, 25.158, 20.582, 18.985, 17.405, 12.29,
+    16.22, 11.811, 9.46, 9.46, 4.758, 4.758, 2.406, -2.859,
+    2.351, -2.793, -5.144, -5.651, -11.234, -10.379, -13.612, -18.699,
+    -12.29, -17.405, -18.985, -20.582, -25.158, -23.456, -26.454, -30.283,
+    40.717, 38.342, 37.488, 36.086, 32.935, 34.038, 31.74, 27.792,
+    32.312, 28.214, 25.992, 25.992, 21.475, 21.475, 19.18, 14.027,
+    18.699, 13.612, 10.379, 11.234, 5.651, 5.144, 2.793, -2.351,
+    2.351, -2.793, -5.651, -5.144, -10.379, -11.234, -13.612, -18.699,
+    -14.027, -19.18, -21.475, -21.475, -25.992, -25.992, -28.214, -32.312,
+    -27.792, -31.74, -32.935, -34.038, -37.488, -36.086, -38.342, -40.717,
+    30.283, 26.454, 25.158, 23.456, 18.985, 20.582, 17.405, 12.29,
+    18.699, 13.612, 11.234, 10.379, 5.144, 5.651, 2.793, -2.351,
+    2.859, -2.406, -4.758, -4.758, -9.46, -9.46, -11.811, -16.22,
+    -12.29, -17.405, -20.582, -18.985, -23.456, -25.158, -26.454, -30.283,
+    -27.792, -31.74, -34.038, -32.935, -36.086, -37.488, -38.342, -40.717,
+    -39.214, -41.639, -42.29, -42.29, -43.725, -43.725, -44.51, -45.214,
+    4.333, 4.333, 1.667, 1.667, 7.333, 7.333, 4.667, 4.667,
+    1.333, 1.333, -1.333, -1.333, 9, 3, -3, 12,
+    6, 0, -6, 15, 9, 3, -3, -9,
+    18, 12, 6, 0, -6, -12, 21, 15,
+    9, 3, -3, -9, -15, 24, 18, 12,
+    6, 0, -6, -12, -18, 27, 21, 15,
+    9, 3, -3, -9, -15, -21, 30, 24,
+    18, 12, 6, 0, -6, -12, -18, -24,
+    27, 21, 15, 9, 3, -3, -9, -15,
+    -21, -1.667, -1.667, -4.333, -4.333, -4.667, -4.667, -7.333,
+    -7.333, -7.667, -7.667, -10.333, -10.333, -9, -12, -15,
+    -12, -15, -18, -21, -15, -18, -21, -24,
+    -27, -18, -21, -24, -27, -30, -33, -21,
+    -24, -27, -30, -33, -36, -39, -24, -27,
+    -30, -33, -36, -39, -42, -45, -27, -30,
+    -33, -36, -39, -42, -45, -48, -51, -30,
+    -33, -36, -39, -42, -45, -48, -51, -54,
+    -57, -36, -39, -42, -45, -48, -51, -54,
+    -57, -60, -4.667, -4.667, -7.333, -7.333, -10.667, -10.667,
+    -13.333, -13.333, -7.667, -7.667, -10.333, -10.333, -18, -15,
+    -12, -24, -21, -18, -15, -30, -27, -24,
+    -21, -18, -36, -33, -30, -27, -24, -21,
+    -42, -39, -36, -33, -30, -27, -24, -48,
+    -45, -42, -39, -36, -33, -30, -27, -54,
+    -51, -48, -45, -42, -39, -36, -33, -30,
+    -60, -57, -54, -51, -48, -45, -42, -39,
+    -36, -33, -60, -57, -54, -51, -48, -45,
+    -42, -39, -36, -1.667, -1.667, -4.333, -4.333, -4.667,
+    -4.667, -7.333, -7.333, 1.333, 1.333, -1.333, -1.333, -9,
+    -3, 3, -12, -6, 0, 6, -15, -9,
+    -3, 3, 9, -18, -12, -6, 0, 6,
+    12, -21, -15, -9, -3, 3, 9, 15,
+    -24, -18, -12, -6, 0, 6, 12, 18,
+    -27, -21, -15, -9, -3, 3, 9, 15,
+    21, -30, -24, -18, -12, -6, 0, 6,
+    12, 18, 24, -27, -21, -15, -9, -3,
+    3, 9, 15, 21, 4.333, 4.333, 1.667, 1.667,
+    7.333, 7.333, 4.667, 4.667, 10.333, 10.333, 7.667, 7.667,
+    9, 12, 15, 12, 15, 18, 21, 15,
+    18, 21, 24, 27, 18, 21, 24, 27,
+    30, 33, 21, 24, 27, 30, 33, 36,
+    39, 24, 27, 30, 33, 36, 39, 42,
+    45, 27, 30, 33, 36, 39, 42, 45,
+    48, 51, 30, 33, 36, 39, 42, 45,
+    48, 51, 54, 57, 36, 39, 42, 45,
+    48, 51, 54, 57, 60, 7.333, 7.333, 4.667,
+    4.667, 13.333, 13.333, 10.667, 10.667, 10.333, 10.333, 7.667,
+    7.667, 18, 15, 12, 24, 21, 18, 15,
+    30, 27, 24, 21, 18, 36, 33, 30,
+    27, 24, 21, 42, 39, 36, 33, 30,
+    27, 24, 48, 45, 42, 39, 36, 33,
+    30, 27, 54, 51, 48, 45, 42, 39,
+    36, 33, 30, 60, 57, 54, 51, 48,
+    45, 42, 39, 36, 33, 60, 57, 54,
+    51, 48, 45, 42, 39, 36,
+};
+
+const Double_t  GDetectorGeometry::Z[GDetectorGeometry::N_CRYSTALS] =
+{
+    2.629, 5.32, 10.577, 2.69, 5.346, 13.258, 10.656, 13.403,
+    18.188, 20.896, 25.316, 18.714, 21.369, 27.654, 25.89, 27.654,
+    31.262, 33.106, 36.111, 31.262, 32.925, 37.736, 36.394, 37.799,
+    40.364, 41.713, 43.502, 40.489, 41.194, 44.216, 43.132, 43.057,
+    45.145, 45.074, 45.145, 44.071, 43.057, 44.216, 43.132, 41.194,
+    43.502, 41.713, 40.364, 40.49, 37.799, 37.736, 36.394, 32.925,
+    2.655, 5.311, 10.749, 2.655, 5.346, 13.403, 10.656, 13.259,
+    18.714, 20.896, 25.315, 18.188, 19.829, 26.957, 24.178, 25.357,
+    30.958, 32.476, 35.848, 29.653, 30.28, 36.557, 33.81, 33.834,
+    39.211, 39.121, 41.028, 36.489, 35.696, 40.014, 37.313, 35.695,
+    41.028, 39.121, 39.212, 36.489, 33.834, 36.556, 33.811, 30.28,
+    35.849, 32.476, 30.958, 29.653, 25.357, 26.957, 24.178, 19.829,
+    2.691, 5.319, 10.577, 2.629, 4.254, 12.24, 8.607, 9.228,
+    16.562, 17.242, 21.688, 13.54, 13.896, 22.314, 18.226, 18.301,
+    26.611, 26.657, 30.349, 22.437, 22.012, 29.898, 25.78, 24.947,
+    32.589, 31.1, 32.589, 27.575, 24.947, 29.898, 25.78, 22.012,
+    30.35, 26.657, 26.61, 22.437, 18.301, 22.315, 18.226, 13.896,
+    21.687, 17.243, 16.562, 13.54, 9.227, 12.24, 8.608, 4.254,
+    -2.629, -5.32, -2.69, -10.577, -13.258, -5.346, -10.656, -13.403,
+    -2.655, -5.311, -2.655, -10.749, -13.403, -5.346, -10.656, -13.259,
+    -2.691, -5.319, -2.629, -10.577, -12.24, -4.254, -8.607, -9.228,
+    0, 0, 4.874, -4.874, -4.89, 4.89, 0, 0,
+    9.6, 9.632, 14.005, 4.923, 4.923, 13.787, 9.415, 8.897,
+    17.658, 17.173, 20.693, 12.784, 12.784, 20.693, 17.173, 17.658,
+    -18.188, -20.896, -18.714, -25.316, -27.654, -21.369, -25.89, -27.654,
+    -18.714, -20.896, -18.188, -25.315, -26.957, -19.829, -24.178, -25.357,
+    -16.562, -17.242, -13.54, -21.688, -22.314, -13.896, -18.226, -18.301,
+    -9.6, -9.632, -4.923, -14.005, -13.787, -4.923, -9.415, -8.897,
+    0, 0, 4.405, -4.405, -4.405, 4.405, 0, 0,
+    8.897, 9.415, 13.787, 4.923, 4.923, 14.005, 9.632, 9.6,
+    -31.262, -33.106, -31.262, -36.111, -37.736, -32.925, -36.394, -37.799,
+    -30.958, -32.476, -29.653, -35.848, -36.557, -30.28, -33.81, -33.834,
+    -26.611, -26.657, -22.437, -30.349, -29.898, -22.012, -25.78, -24.947,
+    -17.658, -17.173, -12.784, -20.693, -20.693, -12.784, -17.173, -17.658,
+    -8.897, -9.415, -4.923, -13.787, -14.005, -4.923, -9.632, -9.6,
+    0, 0, 4.89, -4.89, -4.874, 4.874, 0, 0,
+    -4.254, -8.608, -12.24, -9.227, -13.54, -16.562, -17.243, -21.687,
+    -19.829, -24.178, -26.957, -25.357, -29.653, -30.958, -32.476, -35.849,
+    -32.925, -36.394, -37.736, -37.799, -40.49, -40.364, -41.713, -43.502,
+    -40.364, -41.713, -40.489, -43.502, -44.216, -41.194, -43.132, -43.057,
+    -39.211, -39.121, -36.489, -41.028, -40.014, -35.696, -37.313, -35.695,
+    -32.589, -31.1, -27.575, -32.589, -29.898, -24.947, -25.78, -22.012,
+    -13.896, -18.226, -22.315, -18.301, -22.437, -26.61, -26.657, -30.35,
+    -30.28, -33.811, -36.556, -33.834, -36.489, -39.212, -39.121, -41.028,
+    -41.194, -43.132, -44.216, -43.057, -44.071, -45.145, -45.074, -45.145,
+    -45.145, -45.074, -44.071, -45.145, -44.216, -43.057, -43.132, -41.194,
+    -41.028, -39.121, -36.489, -39.212, -36.556, -33.834, -33.811, -30.28,
+    -30.35, -26.657, -22.437, -26.61, -22.315, -18.301, -18.226, -13.896,
+    -22.012, -25.78, -29.898, -24.947, -27.575, -32.589, -31.1, -32.589,
+    -35.695, -37.313, -40.014, -35.696, -36.489, -41.028, -39.121, -39.211,
+    -43.057, -43.132, -44.216, -41.194, -40.489, -43.502, -41.713, -40.364,
+    -43.502, -41.713, -40.49, -40.364, -37.736, -37.799, -36.394, -32.925,
+    -35.849, -32.476, -29.653, -30.958, -26.957, -25.357, -24.178, -19.829,
+    -21.687, -17.243, -13.54, -16.562, -12.24, -9.227, -8.608, -4.254,
+    0, 0, -4.874, 4.874, 4.89, -4.89, 0, 0,
+    -9.6, -9.632, -14.005, -4.923, -4.923, -13.787, -9.415, -8.897,
+    -17.658, -17.173, -20.693, -12.784, -12.784, -20.693, -17.173, -17.658,
+    -24.947, -25.78, -29.898, -22.012, -22.437, -30.349, -26.657, -26.611,
+    -33.834, -33.81, -36.557, -30.28, -29.653, -35.848, -32.476, -30.958,
+    -37.799, -36.394, -37.736, -32.925, -31.262, -36.111, -33.106, -31.262,
+    9.6, 9.632, 4.923, 14.005, 13.787, 4.923, 9.415, 8.897,
+    0, 0, -4.405, 4.405, 4.405, -4.405, 0, 0,
+    -8.897, -9.415, -13.787, -4.923, -4.923, -14.005, -9.632, -9.6,
+    -18.301, -18.226, -22.314, -13.896, -13.54, -21.688, -17.242, -16.562,
+    -25.357, -24.178, -26.957, -19.829, -18.188, -25.315, -20.896, -18.714,
+    -27.654, -25.89, -27.654, -21.369, -18.714, -25.316, -20.896, -18.188,
+    17.658, 17.173, 12.784, 20.693, 20.693, 12.784, 17.173, 17.658,
+    8.897, 9.415, 4.923, 13.787, 14.005, 4.923, 9.632, 9.6,
+    0, 0, -4.89, 4.89, 4.874, -4.874, 0, 0,
+    -9.228, -8.607, -12.24, -4.254, -2.629, -10.577, -5.319, -2.691,
+    -13.259, -10.656, -13.403, -5.346, -2.655, -10.749, -5.311, -2.655,
+    -13.403, -10.656, -13.258, -5.346, -2.69, -10.577, -5.32, -2.629,
+    4.254, 8.608, 9.227, 12.24, 16.562, 13.54, 17.243, 21.687,
+    13.896, 18.226, 18.301, 22.315, 26.61, 22.437, 26.657, 30.35,
+    22.012, 25.78, 24.947, 29.898, 32.589, 27.575, 31.1, 32.589,
+    24.947, 25.78, 22.012, 29.898, 30.349, 22.437, 26.657, 26.611,
+    18.301, 18.226, 13.896, 22.314, 21.688, 13.54, 17.242, 16.562,
+    9.228, 8.607, 4.254, 12.24, 10.577, 2.629, 5.319, 2.691,
+    19.829, 24.178, 25.357, 26.957, 30.958, 29.653, 32.476, 35.849,
+    30.28, 33.811, 33.834, 36.556, 39.212, 36.489, 39.121, 41.028,
+    35.695, 37.313, 35.696, 40.014, 41.028, 36.489, 39.121, 39.211,
+    33.834, 33.81, 30.28, 36.557, 35.848, 29.653, 32.476, 30.958,
+    25.357, 24.178, 19.829, 26.957, 25.315, 18.188, 20.896, 18.714,
+    13.259, 10.656, 5.346, 13.403, 10.749, 2.655, 5.311, 2.655,
+    32.925, 36.394, 37.799, 37.736, 40.364, 40.49, 41.713, 43.502,
+    41.194, 43.132, 43.057, 44.216, 45.145, 44.071, 45.074, 45.145,
+    43.057, 43.132, 41.194, 44.216, 43.502, 40.489, 41.713, 40.364,
+    37.799, 36.394, 32.925, 37.736, 36.111, 31.262, 33.106, 31.262,
+    27.654, 25.89, 21.369, 27.654, 25.316, 18.714, 20.896, 18.188,
+    13.403, 10.656, 5.346, 13.258, 10.577, 2.69, 5.32, 2.629,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+    145.7, 145.7, 145.7, 145.7, 145.7, 145.7,
+};
+
+const Double_t  GDetectorGeometry::Theta[GDetectorGeometry::N_CRYSTALS] =
+{
+    86.6828285, 83.2736886, 76.5339585, 86.6047024, 83.2402829, 73.0276568, 76.4297735, 72.8145639,
+    66.4029392, 62.5865181, 56.1396565, 65.6351424, 61.8962383, 52.4919091, 55.2447096, 52.4915245,
+    46.5061004, 43.2093947, 37.36591, 46.5060813, 43.5408757, 33.8466732, 36.7515896, 33.675277,
+    27.3285034, 23.3148873, 16.7156012, 26.9477046, 24.9064307, 13.2110289, 18.2454915, 18.3472518,
+    6.49900356, 6.72084972, 6.50086795, 13.7062032, 18.3470575, 13.2111089, 18.2471235, 24.9076947,
+    16.7162958, 23.3157734, 27.3295789, 26.9475142, 33.6747388, 33.8457095, 36.751247, 43.5400472,
+    86.6500575, 83.2798975, 76.2928856, 86.6501432, 83.2402385, 72.8146028, 76.4299085, 73.0264126,
+    65.6352753, 62.5869336, 56.1408047, 66.4032784, 64.1245697, 53.6093463, 57.8104887, 56.0141871,
+    47.0295956, 44.3498624, 37.8805468, 49.1792742, 48.124848, 36.4311778, 41.8446752, 41.8706729,
+    30.3464323, 30.4620547, 25.250531, 36.5757256, 38.193392, 28.1041308, 34.7553752, 38.1943158,
+    25.2514, 30.4625548, 30.345015, 36.5750955, 41.8713272, 36.4321842, 41.8441318, 48.1246091,
+    37.8788442, 44.3494036, 47.0293739, 49.1797736, 56.0138622, 53.6092972, 57.8102148, 64.1243171,
+    86.6034476, 83.2752047, 76.5341495, 86.6828961, 84.6276648, 74.3668196, 79.0768469, 78.2778771,
+    68.6134825, 67.6879223, 61.4380899, 72.6552847, 72.191503, 60.5339048, 66.3228133, 66.2476229,
+    54.0820485, 54.0582791, 48.0698103, 60.3952839, 61.0122072, 48.8336313, 55.4185612, 56.6967059,
+    44.1530515, 46.7898471, 44.1537604, 52.6342319, 56.6972694, 48.834018, 55.4195034, 61.0122203,
+    48.0685605, 54.0582125, 54.0833035, 60.3955255, 66.247686, 60.5326079, 66.3232205, 72.1913333,
+    61.4395375, 67.6863584, 68.6135503, 72.6553484, 78.2789281, 74.3665227, 79.0754513, 84.6275918,
+    93.3171715, 96.7263114, 93.3952976, 103.466042, 106.972343, 96.7597171, 103.570227, 107.185436,
+    93.3499425, 96.7201025, 93.3498568, 103.707114, 107.185397, 96.7597615, 103.570091, 106.973587,
+    93.3965524, 96.7247953, 93.3171039, 103.465851, 105.63318, 95.3723352, 100.923153, 101.722123,
+    90, 90, 83.8397888, 96.1602112, 96.1807674, 83.8192326, 90, 90,
+    77.8022688, 77.7472485, 72.0472365, 83.7696477, 83.7696807, 72.3286471, 78.0352794, 78.7032857,
+    67.1225822, 67.7852283, 62.9071074, 73.6529014, 73.6529257, 62.906712, 67.785445, 67.1222652,
+    113.597061, 117.413482, 114.364858, 123.860343, 127.508091, 118.103762, 124.75529, 127.508476,
+    114.364725, 117.413066, 113.596722, 123.859195, 126.390654, 115.87543, 122.189511, 123.985813,
+    111.386518, 112.312078, 107.344715, 118.56191, 119.466095, 107.808497, 113.677187, 113.752377,
+    102.197731, 102.252752, 96.2303523, 107.952763, 107.671353, 96.2303193, 101.964721, 101.296714,
+    90, 90, 84.4365019, 95.5634981, 95.5635364, 84.4364636, 90, 90,
+    78.7032095, 78.0352545, 72.3284856, 83.7696336, 83.7696358, 72.0473454, 77.7472009, 77.8021329,
+    133.4939, 136.790605, 133.493919, 142.63409, 146.153327, 136.459124, 143.24841, 146.324723,
+    132.970404, 135.650138, 130.820726, 142.119453, 143.568822, 131.875152, 138.155325, 138.129327,
+    125.917951, 125.941721, 119.604716, 131.93019, 131.166369, 118.987793, 124.581439, 123.303294,
+    112.877418, 112.214772, 106.347099, 117.092893, 117.093288, 106.347074, 112.214555, 112.877735,
+    101.296791, 101.964745, 96.2303664, 107.671514, 107.952655, 96.2303642, 102.252799, 102.197867,
+    90, 90, 83.8192151, 96.1807849, 96.160203, 83.839797, 90, 90,
+    95.3724082, 100.924549, 105.633477, 101.721072, 107.344652, 111.38645, 112.313642, 118.560463,
+    115.875683, 122.189785, 126.390703, 123.986138, 130.820226, 132.970626, 135.650596, 142.121156,
+    136.459953, 143.248753, 146.15429, 146.325261, 153.052486, 152.670421, 156.684227, 163.283704,
+    152.671497, 156.685113, 153.052295, 163.284399, 166.788971, 155.093569, 161.754509, 161.652748,
+    149.653568, 149.537945, 143.424274, 154.749469, 151.895869, 141.806608, 145.244625, 141.805684,
+    135.846948, 133.210153, 127.365768, 135.84624, 131.165982, 123.302731, 124.580497, 118.98778,
+    107.808667, 113.676779, 119.467392, 113.752314, 119.604474, 125.916696, 125.941788, 131.931439,
+    131.875391, 138.155868, 143.567816, 138.128673, 143.424904, 149.654985, 149.537445, 154.7486,
+    155.092305, 161.752877, 166.788891, 161.652942, 166.293797, 173.499132, 173.27915, 173.500996,
+    173.500996, 173.27915, 166.293797, 173.499132, 166.788891, 161.652942, 161.752877, 155.092305,
+    154.7486, 149.537445, 143.424904, 149.654985, 143.567816, 138.128673, 138.155868, 131.875391,
+    131.931439, 125.941788, 119.604474, 125.916696, 119.467392, 113.752314, 113.676779, 107.808667,
+    118.98778, 124.580497, 131.165982, 123.302731, 127.365768, 135.84624, 133.210153, 135.846948,
+    141.805684, 145.244625, 151.895869, 141.806608, 143.424274, 154.749469, 149.537945, 149.653568,
+    161.652748, 161.754509, 166.788971, 155.093569, 153.052295, 163.284399, 156.685113, 152.671497,
+    163.283704, 156.684227, 153.052486, 152.670421, 146.15429, 146.325261, 143.248753, 136.459953,
+    142.121156, 135.650596, 130.820226, 132.970626, 126.390703, 123.986138, 122.189785, 115.875683,
+    118.560463, 112.313642, 107.344652, 111.38645, 105.633477, 101.721072, 100.924549, 95.3724082,
+    90, 90, 96.160203, 83.839797, 83.8192151, 96.1807849, 90, 90,
+    102.197867, 102.252799, 107.952655, 96.2303642, 96.2303664, 107.671514, 101.964745, 101.296791,
+    112.877735, 112.214555, 117.093288, 106.347074, 106.347099, 117.092893, 112.214772, 112.877418,
+    123.303294, 124.581439, 131.166369, 118.987793, 119.604716, 131.93019, 125.941721, 125.917951,
+    138.129327, 138.155325, 143.568822, 131.875152, 130.820726, 142.119453, 135.650138, 132.970404,
+    146.324723, 143.24841, 146.153327, 136.459124, 133.493919, 142.63409, 136.790605, 133.4939,
+    77.8021329, 77.7472009, 83.7696358, 72.0473454, 72.3284856, 83.7696336, 78.0352545, 78.7032095,
+    90, 90, 95.5635364, 84.4364636, 84.4365019, 95.5634981, 90, 90,
+    101.296714, 101.964721, 107.671353, 96.2303193, 96.2303523, 107.952763, 102.252752, 102.197731,
+    113.752377, 113.677187, 119.466095, 107.808497, 107.344715, 118.56191, 112.312078, 111.386518,
+    123.985813, 122.189511, 126.390654, 115.87543, 113.596722, 123.859195, 117.413066, 114.364725,
+    127.508476, 124.75529, 127.508091, 118.103762, 114.364858, 123.860343, 117.413482, 113.597061,
+    67.1222652, 67.785445, 73.6529257, 62.906712, 62.9071074, 73.6529014, 67.7852283, 67.1225822,
+    78.7032857, 78.0352794, 83.7696807, 72.3286471, 72.0472365, 83.7696477, 77.7472485, 77.8022688,
+    90, 90, 96.1807674, 83.8192326, 83.8397888, 96.1602112, 90, 90,
+    101.722123, 100.923153, 105.63318, 95.3723352, 93.3171039, 103.465851, 96.7247953, 93.3965524,
+    106.973587, 103.570091, 107.185397, 96.7597615, 93.3498568, 103.707114, 96.7201025, 93.3499425,
+    107.185436, 103.570227, 106.972343, 96.7597171, 93.3952976, 103.466042, 96.7263114, 93.3171715,
+    84.6275918, 79.0754513, 78.2789281, 74.3665227, 68.6135503, 72.6553484, 67.6863584, 61.4395375,
+    72.1913333, 66.3232205, 66.247686, 60.5326079, 54.0833035, 60.3955255, 54.0582125, 48.0685605,
+    61.0122203, 55.4195034, 56.6972694, 48.834018, 44.1537604, 52.6342319, 46.7898471, 44.1530515,
+    56.6967059, 55.4185612, 61.0122072, 48.8336313, 48.0698103, 60.3952839, 54.0582791, 54.0820485,
+    66.2476229, 66.3228133, 72.191503, 60.5339048, 61.4380899, 72.6552847, 67.6879223, 68.6134825,
+    78.2778771, 79.0768469, 84.6276648, 74.3668196, 76.5341495, 86.6828961, 83.2752047, 86.6034476,
+    64.1243171, 57.8102148, 56.0138622, 53.6092972, 47.0293739, 49.1797736, 44.3494036, 37.8788442,
+    48.1246091, 41.8441318, 41.8713272, 36.4321842, 30.345015, 36.5750955, 30.4625548, 25.2514,
+    38.1943158, 34.7553752, 38.193392, 28.1041308, 25.250531, 36.5757256, 30.4620547, 30.3464323,
+    41.8706729, 41.8446752, 48.124848, 36.4311778, 37.8805468, 49.1792742, 44.3498624, 47.0295956,
+    56.0141871, 57.8104887, 64.1245697, 53.6093463, 56.1408047, 66.4032784, 62.5869336, 65.6352753,
+    73.0264126, 76.4299085, 83.2402385, 72.8146028, 76.2928856, 86.6501432, 83.2798975, 86.6500575,
+    43.5400472, 36.751247, 33.6747388, 33.8457095, 27.3295789, 26.9475142, 23.3157734, 16.7162958,
+    24.9076947, 18.2471235, 18.3470575, 13.2111089, 6.50086795, 13.7062032, 6.72084972, 6.49900356,
+    18.3472518, 18.2454915, 24.9064307, 13.2110289, 16.7156012, 26.9477046, 23.3148873, 27.3285034,
+    33.675277, 36.7515896, 43.5408757, 33.8466732, 37.36591, 46.5060813, 43.2093947, 46.5061004,
+    52.4915245, 55.2447096, 61.8962383, 52.4919091, 56.1396565, 65.6351424, 62.5865181, 66.4029392,
+    72.8145639, 76.4297735, 83.2402829, 73.0276568, 76.5339585, 86.6047024, 83.2736886, 86.6828285,
+    2.27791322, 3.08307228, 1.64900364, 2.65329797, 4.56926884, 5.42667013, 3.99597863, 4.95535062,
+    3.5906111, 4.63582567, 3.5906111, 4.63582567, 7.04256932, 6.21786744, 6.21786744, 9.3540095,
+    8.44562991, 8.11881591, 8.44562991, 11.6348213, 10.6868539, 10.1764053, 10.1764053, 10.6868539,
+    13.8788653, 12.913791, 12.2930032, 12.0780518, 12.2930032, 12.913791, 16.0803225, 15.1116164,
+    14.4223255, 14.0627066, 14.0627066, 14.4223255, 15.1116164, 18.2340931, 17.2707115, 16.5390722,
+    16.0802648, 15.9237354, 16.0802648, 16.5390722, 17.2707115, 20.3358322, 19.3841197, 18.6276524,
+    18.1003759, 17.8292189, 17.8292189, 18.1003759, 18.6276524, 19.3841197, 22.3822514, 21.4468841,
+    20.6779447, 20.1038153, 19.7484724, 19.6281113, 19.7484724, 20.1038153, 20.6779447, 21.4468841,
+    23.4543622, 22.6819324, 22.0766437, 21.6596418, 21.4468469, 21.4468469, 21.6596418, 22.0766437,
+    22.6819324, 1.64900364, 2.65329797, 2.27791322, 3.08307228, 3.99597863, 4.95535062, 4.56926884,
+    5.42667013, 3.3697217, 3.95735652, 4.32790008, 4.79827812, 7.04256932, 6.21796438, 6.21802255,
+    9.3540095, 8.44535885, 8.11860674, 8.44547154, 11.6348213, 10.6868806, 10.1762115, 10.1762692,
+    10.6867576, 13.8788653, 12.9138303, 12.2930676, 12.0779336, 12.2929342, 12.9137523, 16.0803225,
+    15.1116639, 14.4224103, 14.0628135, 14.062659, 14.4223183, 15.1116317, 18.2340931, 17.2707644,
+    16.5391706, 16.080397, 15.9238862, 16.080282, 16.5391219, 17.2707774, 20.3358322, 19.3841762,
+    18.6277599, 18.1005255, 17.8293981, 17.8294128, 18.1004524, 18.6277546, 19.384233, 22.3822514,
+    21.4466334, 20.6777329, 20.1036387, 19.7483255, 19.6279868, 19.7483618, 20.1036082, 20.6777701,
+    21.4467322, 23.4543949, 22.6817352, 22.076486, 21.659519, 21.4467528, 21.4467737, 21.6595809,
+    22.0764973, 22.6818134, 1.90947944, 1.90947944, 2.92935646, 2.92935646, 4.22040588, 4.22040588,
+    5.25503816, 5.25503816, 3.95735652, 3.3697217, 4.79827812, 4.32790008, 7.0427227, 6.21802255,
+    6.21796438, 9.35388009, 8.44547154, 8.11860674, 8.44535885, 11.6347436, 10.6867576, 10.1762692,
+    10.1762115, 10.6868806, 13.8788379, 12.9137523, 12.2929342, 12.0779336, 12.2930676, 12.9138303,
+    16.0803436, 15.1116317, 14.4223183, 14.062659, 14.0628135, 14.4224103, 15.1116639, 18.2341605,
+    17.2707774, 16.5391219, 16.080282, 15.9238862, 16.080397, 16.5391706, 17.2707644, 20.3359435,
+    19.384233, 18.6277546, 18.1004524, 17.8294128, 17.8293981, 18.1005255, 18.6277599, 19.3841762,
+    22.3821129, 21.4467322, 20.6777701, 20.1036082, 19.7483618, 19.6279868, 19.7483255, 20.1036387,
+    20.6777329, 21.4466334, 22.6818134, 22.0764973, 21.6595809, 21.4467737, 21.4467528, 21.659519,
+    22.076486, 22.6817352, 23.4543949, 2.65329797, 1.64900364, 3.08307228, 2.27791322, 4.95535062,
+    3.99597863, 5.42667013, 4.56926884, 4.63582567, 3.5906111, 4.63582567, 3.5906111, 7.04256932,
+    6.21786744, 6.21786744, 9.3540095, 8.44562991, 8.11881591, 8.44562991, 11.6348213, 10.6868539,
+    10.1764053, 10.1764053, 10.6868539, 13.8788653, 12.913791, 12.2930032, 12.0780518, 12.2930032,
+    12.913791, 16.0803225, 15.1116164, 14.4223255, 14.0627066, 14.0627066, 14.4223255, 15.1116164,
+    18.2340931, 17.2707115, 16.5390722, 16.0802648, 15.9237354, 16.0802648, 16.5390722, 17.2707115,
+    20.3358322, 19.3841197, 18.6276524, 18.1003759, 17.8292189, 17.8292189, 18.1003759, 18.6276524,
+    19.3841197, 22.3822514, 21.4468841, 20.6779447, 20.1038153, 19.7484724, 19.6281113, 19.7484724,
+    20.1038153, 20.6779447, 21.4468841, 23.4543622, 22.6819324, 22.0766437, 21.6596418, 21.4468469,
+    21.4468469, 21.6596418, 22.0766437, 22.6819324, 3.08307228, 2.27791322, 2.65329797, 1.64900364,
+    5.42667013, 4.56926884, 4.95535062, 3.99597863, 4.79827812, 4.32790008, 3.95735652, 3.3697217,
+    7.04256932, 6.21796438, 6.21802255, 9.3540095, 8.44535885, 8.11860674, 8.44547154, 11.6348213,
+    10.6868806, 10.1762115, 10.1762692, 10.6867576, 13.8788653, 12.9138303, 12.2930676, 12.0779336,
+    12.2929342, 12.9137523, 16.0803225, 15.1116639, 14.4224103, 14.0628135, 14.062659, 14.4223183,
+    15.1116317, 18.2340931, 17.2707644, 16.5391706, 16.080397, 15.9238862, 16.080282, 16.5391219,
+    17.2707774, 20.3358322, 19.3841762, 18.6277599, 18.1005255, 17.8293981, 17.8294128, 18.1004524,
+    18.6277546, 19.384233, 22.3822514, 21.4466334, 20.6777329, 20.1036387, 19.7483255, 19.6279868,
+    19.7483618, 20.1036082, 20.6777701, 21.4467322, 23.4543949, 22.6817352, 22.076486, 21.659519,
+    21.4467528, 21.4467737, 21.6595809, 22.0764973, 22.6818134, 2.92935646, 2.92935646, 1.90947944,
+    1.90947944, 5.25503816, 5.25503816, 4.22040588, 4.22040588, 4.32790008, 4.79827812, 3.3697217,
+    3.95735652, 7.0427227, 6.21802255, 6.21796438, 9.35388009, 8.44547154, 8.11860674, 8.44535885,
+    11.6347436, 10.6867576, 10.1762692, 10.1762115, 10.6868806, 13.8788379, 12.9137523, 12.2929342,
+    12.0779336, 12.2930676, 12.9138303, 16.0803436, 15.1116317, 14.4223183, 14.062659, 14.0628135,
+    14.4224103, 15.1116639, 18.2341605, 17.2707774, 16.5391219, 16.080282, 15.9238862, 16.080397,
+    16.5391706, 17.2707644, 20.3359435, 19.384233, 18.6277546, 18.1004524, 17.8294128, 17.8293981,
+    18.1005255, 18.6277599, 19.3841762, 22.3821129, 21.4467322, 20.6777701, 20.1036082, 19.7483618,
+    19.6279868, 19.7483255, 20.1036387, 20.6777329, 21.4466334, 22.6818134, 22.0764973, 21.6595809,
+    21.4467737, 21.4467528, 21.659519, 22.076486, 22.6817352, 23.4543949,
+};
+
+const Double_t  GDetectorGeometry::Phi[GDetectorGeometry::N_CRYSTALS] =
+{
+    85.4237115, 80.6583742, 81.8447664, 74.658322, 69.6589501, 76.7871973, 70.594377, 64.8044354,
+    77.9362867, 72.1137067, 73.0211983, 65.1230786, 58.2820882, 66.0822376, 58.2817403, 50.4790861,
+    66.7877101, 58.2816967, 58.2800603, 49.7749758, 41.1320074, 48.6076916, 39.8217663, 29.208175,
+    51.042047, 41.0710945, 46.3956687, 27.3605327, 14.4038637, 27.2834327, 9.74187623, -11.5499455,
+    27.2028072, -31.7241034, -90.6348612, -31.7189039, -51.8828892, -90.7176088, -73.1795767, -77.8376703,
+    -109.830236, -104.505433, -114.477598, -90.7961101, -92.639958, -112.042323, -103.253919, -104.564327,
+    63.8546844, 58.2821571, 58.2812628, 52.7082045, 46.9055913, 51.759755, 45.9682226, 39.7755111,
+    51.4393687, 44.4489413, 43.5416583, 38.6271425, 31.6889443, 35.9537797, 29.9572884, 21.8961697,
+    34.240452, 25.3890117, 21.8498624, 19.1021061, 9.63103803, 10.9901082, 5.29294258, -4.44623375,
+    5.87823238, -6.97212913, -16.9797325, -10.9521861, -21.6896466, -31.7160561, -31.7194275, -41.7465486,
+    -46.4573164, -56.4667044, -69.3133702, -52.4837936, -58.9879664, -74.4226949, -68.7249988, -73.064514,
+    -85.2834511, -88.8213968, -97.672686, -82.5367151, -85.3289587, -99.3891841, -93.3896738, -95.123878,
+    41.9050256, 35.9042956, 34.7182876, 31.1387922, 24.8150376, 28.0695589, 22.97069, 16.0420172,
+    26.2415037, 18.9037099, 16.3776104, 13.8516124, 6.8293073, 8.22632459, 3.85295312, -3.24073842,
+    4.46341767, -3.75188201, -8.09509016, -6.92039329, -13.7746207, -16.0614024, -18.4112082, -25.2862495,
+    -22.8573713, -31.7173667, -40.5792963, -31.7177874, -38.1470574, -47.37159, -45.0216668, -49.6591425,
+    -55.3391656, -59.6816466, -67.8976859, -56.514762, -60.1936004, -71.6600157, -67.2857651, -70.2623372,
+    -79.8123308, -82.3362367, -89.6748442, -77.286415, -79.4758681, -91.5039553, -86.404272, -88.2492564,
+    85.4237115, 80.6583742, 74.658322, 81.8447664, 76.7871973, 69.6589501, 70.594377, 64.8044354,
+    63.8546844, 58.2821571, 52.7082045, 58.2812628, 51.759755, 46.9055913, 45.9682226, 39.7755111,
+    41.9050256, 35.9042956, 31.1387922, 34.7182876, 28.0695589, 24.8150376, 22.97069, 16.0420172,
+    20.9157369, 15.0719081, 12.0922758, 12.0922758, 6.04859023, 6.04859023, 3.0368576, -3.61352249,
+    3.03455407, -3.6105015, -6.83482413, -7.19892845, -14.4254492, -13.8769703, -17.8411638, -24.8244674,
+    -17.0783692, -24.4507207, -27.9917488, -28.1790453, -35.2551187, -35.4425027, -38.9836817, -46.3564842,
+    77.9362867, 72.1137067, 65.1230786, 73.0211983, 66.0822376, 58.2820882, 58.2817403, 50.4790861,
+    51.4393687, 44.4489413, 38.6271425, 43.5416583, 35.9537797, 31.6889443, 29.9572884, 21.8961697,
+    26.2415037, 18.9037099, 13.8516124, 16.3776104, 8.22632459, 6.8293073, 3.85295312, -3.24073842,
+    3.03455407, -3.6105015, -7.19892845, -6.83482413, -13.8769703, -14.4254492, -17.8411638, -24.8244674,
+    -18.01236, -24.9987424, -28.3512983, -28.3512983, -35.083153, -35.083153, -38.4362342, -45.4224472,
+    -38.6091792, -45.5945678, -49.5585416, -49.0093801, -56.2348725, -56.6003684, -59.8252073, -66.4695402,
+    66.7877101, 58.2816967, 49.7749758, 58.2800603, 48.6076916, 41.1320074, 39.8217663, 29.208175,
+    34.240452, 25.3890117, 19.1021061, 21.8498624, 10.9901082, 9.63103803, 5.29294258, -4.44623375,
+    4.46341767, -3.75188201, -6.92039329, -8.09509016, -16.0614024, -13.7746207, -18.4112082, -25.2862495,
+    -17.0783692, -24.4507207, -28.1790453, -27.9917488, -35.4425027, -35.2551187, -38.9836817, -46.3564842,
+    -38.6091792, -45.5945678, -49.0093801, -49.5585416, -56.6003684, -56.2348725, -59.8252073, -66.4695402,
+    -59.8219345, -66.4712521, -69.482865, -69.482865, -75.5270903, -75.5270903, -78.5057626, -84.3501391,
+    91.7507436, 93.595728, 88.4960447, 100.524132, 102.713585, 90.3251558, 97.6637633, 100.187669,
+    84.876122, 86.6103262, 80.6108159, 94.6710413, 97.4632849, 82.327314, 91.1786032, 94.7165489,
+    75.4356732, 76.7460809, 67.9576767, 87.360042, 89.2038899, 65.522402, 75.4945667, 70.1697638,
+    51.042047, 41.0710945, 27.3605327, 46.3956687, 27.2834327, 14.4038637, 9.74187623, -11.5499455,
+    5.87823238, -6.97212913, -10.9521861, -16.9797325, -31.7160561, -21.6896466, -31.7194275, -41.7465486,
+    -22.8573713, -31.7173667, -31.7177874, -40.5792963, -47.37159, -38.1470574, -45.0216668, -49.6591425,
+    109.737663, 112.714235, 108.339984, 119.8064, 123.485238, 112.102314, 120.318353, 124.660834,
+    106.935486, 111.275001, 105.577305, 121.012034, 127.516206, 110.68663, 123.533296, 133.542684,
+    102.16233, 106.820423, 89.2823912, 128.117111, 148.281096, 89.3651388, 148.275897, -152.797193,
+    27.2028072, -31.7241034, -31.7189039, -90.6348612, -90.7176088, -51.8828892, -73.1795767, -77.8376703,
+    -46.4573164, -56.4667044, -52.4837936, -69.3133702, -74.4226949, -58.9879664, -68.7249988, -73.064514,
+    -55.3391656, -59.6816466, -56.514762, -67.8976859, -71.6600157, -60.1936004, -67.2857651, -70.2623372,
+    130.340858, 134.978333, 132.62841, 141.852943, 148.282213, 139.420704, 148.282633, 157.142629,
+    138.253451, 148.280573, 148.283944, 158.310353, 169.047814, 163.020268, 173.027871, -174.121768,
+    168.450054, -170.258124, -152.716567, -165.596136, -152.639467, -133.604331, -138.928905, -128.957953,
+    -109.830236, -104.505433, -90.7961101, -114.477598, -112.042323, -92.639958, -103.253919, -104.564327,
+    -85.2834511, -88.8213968, -82.5367151, -97.672686, -99.3891841, -85.3289587, -93.3896738, -95.123878,
+    -79.8123308, -82.3362367, -77.286415, -89.6748442, -91.5039553, -79.4758681, -86.404272, -88.2492564,
+    95.6498609, 101.494237, 104.47291, 104.47291, 110.517135, 110.517135, 113.528748, 120.178066,
+    113.53046, 120.174793, 123.399632, 123.765127, 130.99062, 130.441458, 134.405432, 141.390821,
+    133.643516, 141.016318, 144.557497, 144.744881, 151.820955, 152.008251, 155.549279, 162.921631,
+    154.71375, 161.588792, 163.938598, 166.225379, 173.079607, 171.90491, 176.248118, -175.536582,
+    175.553766, -174.707057, -169.009892, -170.368962, -160.897894, -158.150138, -154.610988, -145.759548,
+    -150.791825, -140.178234, -131.392308, -138.867993, -130.225024, -121.71994, -121.718303, -113.21229,
+    113.53046, 120.174793, 123.765127, 123.399632, 130.441458, 130.99062, 134.405432, 141.390821,
+    134.577553, 141.563766, 144.916847, 144.916847, 151.648702, 151.648702, 155.001258, 161.98764,
+    155.175533, 162.158836, 166.12303, 165.574551, 172.801072, 173.165176, 176.389498, -176.965446,
+    176.759262, -176.147047, -171.773675, -173.170693, -166.148388, -163.62239, -161.09629, -153.758496,
+    -158.10383, -150.042712, -144.04622, -148.311056, -141.372858, -136.458342, -135.551059, -128.560631,
+    -129.520914, -121.71826, -113.917762, -121.717912, -114.876921, -106.978802, -107.886293, -102.063713,
+    133.643516, 141.016318, 144.744881, 144.557497, 152.008251, 151.820955, 155.549279, 162.921631,
+    155.175533, 162.158836, 165.574551, 166.12303, 173.165176, 172.801072, 176.389498, -176.965446,
+    176.386478, -176.963142, -173.95141, -173.95141, -167.907724, -167.907724, -164.928092, -159.084263,
+    -163.957983, -157.02931, -151.930441, -155.184962, -148.861208, -145.281712, -144.095704, -138.094974,
+    -140.224489, -134.031777, -128.240245, -133.094409, -127.291796, -121.718737, -121.717843, -116.145316,
+    -115.195565, -109.405623, -103.212803, -110.34105, -105.341678, -98.1552336, -99.3416258, -94.5762885,
+    91.7507436, 93.595728, 100.524132, 88.4960447, 90.3251558, 102.713585, 97.6637633, 100.187669,
+    109.737663, 112.714235, 119.8064, 108.339984, 112.102314, 123.485238, 120.318353, 124.660834,
+    130.340858, 134.978333, 141.852943, 132.62841, 139.420704, 148.282213, 148.282633, 157.142629,
+    154.71375, 161.588792, 166.225379, 163.938598, 171.90491, 173.079607, 176.248118, -175.536582,
+    176.759262, -176.147047, -173.170693, -171.773675, -163.62239, -166.148388, -161.09629, -153.758496,
+    -163.957983, -157.02931, -155.184962, -151.930441, -145.281712, -148.861208, -144.095704, -138.094974,
+    84.876122, 86.6103262, 94.6710413, 80.6108159, 82.327314, 97.4632849, 91.1786032, 94.7165489,
+    106.935486, 111.275001, 121.012034, 105.577305, 110.68663, 127.516206, 123.533296, 133.542684,
+    138.253451, 148.280573, 158.310353, 148.283944, 163.020268, 169.047814, 173.027871, -174.121768,
+    175.553766, -174.707057, -170.368962, -169.009892, -158.150138, -160.897894, -154.610988, -145.759548,
+    -158.10383, -150.042712, -148.311056, -144.04622, -136.458342, -141.372858, -135.551059, -128.560631,
+    -140.224489, -134.031777, -133.094409, -128.240245, -121.718737, -127.291796, -121.717843, -116.145316,
+    75.4356732, 76.7460809, 87.360042, 67.9576767, 65.522402, 89.2038899, 75.4945667, 70.1697638,
+    102.16233, 106.820423, 128.117111, 89.2823912, 89.3651388, 148.281096, 148.275897, -152.797193,
+    168.450054, -170.258124, -165.596136, -152.716567, -133.604331, -152.639467, -138.928905, -128.957953,
+    -150.791825, -140.178234, -138.867993, -131.392308, -121.71994, -130.225024, -121.718303, -113.21229,
+    -129.520914, -121.71826, -121.717912, -113.917762, -106.978802, -114.876921, -107.886293, -102.063713,
+    -115.195565, -109.405623, -110.34105, -103.212803, -98.1552336, -105.341678, -99.3416258, -94.5762885,
+    131.614657, 146.486102, 156.582587, 165.706494, 140.967483, 148.008219, 152.707367, 158.319029,
+    171.616425, 173.521635, -171.616425, -173.521635, 149.999272, 169.106293, -169.106293, 150.000466,
+    163.898173, 180, -163.898173, 150.000227, 160.893557, 173.413284, -173.413284, -160.893557,
+    150.000068, 158.948328, 169.106634, 180, -169.106634, -158.948328, 149.999954, 157.589052,
+    166.102089, 175.284987, -175.284987, -166.102089, -157.589052, 149.999869, 156.586665, 163.897806,
+    171.786747, 180, -171.786747, -163.897806, -156.586665, 149.999803, 155.817355, 162.216216,
+    169.106521, 176.329474, -176.329474, -169.106521, -162.216216, -155.817355, 150.000227, 155.208919,
+    160.893557, 166.996203, 173.413284, 180, -173.413284, -166.996203, -160.893557, -155.208919,
+    154.715129, 159.826535, 165.295424, 171.051774, 176.995525, -176.995525, -171.051774, -165.295424,
+    -159.826535, -156.582587, -165.706494, -131.614657, -146.486102, -152.707367, -158.319029, -140.967483,
+    -148.008219, -116.657642, -130.477365, -110.430155, -122.342562, -149.999272, -130.892563, -109.106086,
+    -150.000466, -136.101274, -119.999272, -103.897494, -150.000227, -139.107138, -126.585971, -113.412612,
+    -100.893083, -150.000068, -141.051981, -130.893927, -119.999272, -109.106086, -98.9480173, -149.999954,
+    -142.410986, -133.898148, -124.715508, -115.284347, -106.101666, -97.5888694, -149.999869, -143.413174,
+    -136.102192, -128.213466, -120.000466, -111.78621, -103.897494, -96.586584, -149.999803, -144.182331,
+    -137.783599, -130.893472, -123.670739, -116.329931, -109.106086, -102.216001, -95.8173562, -150.000227,
+    -144.791066, -139.106456, -133.003859, -126.586851, -120.000227, -113.413617, -106.995618, -100.893083,
+    -95.2085672, -145.285242, -140.173346, -134.704505, -128.948224, -123.004563, -116.995721, -111.052085,
+    -105.294917, -99.8261472, -73.9006837, -106.099316, -79.5913632, -100.408637, -82.8029368, -97.1970632,
+    -84.2311228, -95.7688772, -49.5226353, -63.3423581, -57.6574377, -69.5698446, -90, -70.8939145,
+    -49.1074371, -90, -76.1025056, -60.0007278, -43.898726, -90, -79.1069173, -66.5873884,
+    -53.4140288, -40.8928622, -90, -81.0519827, -70.8939145, -60.0007278, -49.1060729, -38.9480191,
+    -90, -82.4111306, -73.8983341, -64.715653, -55.2844924, -46.1018516, -37.5890136, -90,
+    -83.413416, -76.1025056, -68.2137899, -59.9995341, -51.7865343, -43.8978078, -36.586826, -90,
+    -84.1826438, -77.7839987, -70.8939145, -63.6700688, -56.3292614, -49.1065276, -42.2164013, -35.8176691,
+    -90, -84.7914328, -79.1069173, -73.0043818, -66.5863832, -59.9997728, -53.4131493, -46.9961407,
+    -40.8935443, -35.2089337, -80.1738528, -74.7050834, -68.9479149, -63.0042794, -56.9954367, -51.051776,
+    -45.2954955, -39.8266539, -34.7147584, -14.2935057, -23.4174125, -33.513898, -48.3853433, -21.6809714,
+    -27.2926335, -31.9917807, -39.0325172, 6.47836458, 8.38357479, -6.47836458, -8.38357479, -30.0007278,
+    -10.8937066, 10.8937066, -29.9995341, -16.1018271, 0, 16.1018271, -29.9997728, -19.1064431,
+    -6.58671577, 6.58671577, 19.1064431, -29.999932, -21.0516718, -10.8933655, 0, 10.8933655,
+    21.0516718, -30.0000457, -22.4109477, -13.8979108, -4.71501259, 4.71501259, 13.8979108, 22.4109477,
+    -30.0001309, -23.4133347, -16.1021943, -8.21325346, 0, 8.21325346, 16.1021943, 23.4133347,
+    -30.0001972, -24.1826446, -17.7837836, -10.8934792, -3.67052561, 3.67052561, 10.8934792, 17.7837836,
+    24.1826446, -29.9997728, -24.7910812, -19.1064431, -13.0037969, -6.58671577, 0, 6.58671577,
+    13.0037969, 19.1064431, 24.7910812, -25.2848709, -20.1734653, -14.7045761, -8.94822576, -3.00447463,
+    3.00447463, 8.94822576, 14.7045761, 20.1734653, 33.513898, 48.3853433, 14.2935057, 23.4174125,
+    31.9917807, 39.0325172, 21.6809714, 27.2926335, 57.6574377, 69.5698446, 49.5226353, 63.3423581,
+    30.0007278, 49.1074371, 70.8939145, 29.9995341, 43.898726, 60.0007278, 76.1025056, 29.9997728,
+    40.8928622, 53.4140288, 66.5873884, 79.1069173, 29.999932, 38.9480191, 49.1060729, 60.0007278,
+    70.8939145, 81.0519827, 30.0000457, 37.5890136, 46.1018516, 55.2844924, 64.715653, 73.8983341,
+    82.4111306, 30.0001309, 36.586826, 43.8978078, 51.7865343, 59.9995341, 68.2137899, 76.1025056,
+    83.413416, 30.0001972, 35.8176691, 42.2164013, 49.1065276, 56.3292614, 63.6700688, 70.8939145,
+    77.7839987, 84.1826438, 29.9997728, 35.2089337, 40.8935443, 46.9961407, 53.4131493, 59.9997728,
+    66.5863832, 73.0043818, 79.1069173, 84.7914328, 34.7147584, 39.8266539, 45.2954955, 51.051776,
+    56.9954367, 63.0042794, 68.9479149, 74.7050834, 80.1738528, 79.5913632, 100.408637, 73.9006837,
+    106.099316, 84.2311228, 95.7688772, 82.8029368, 97.1970632, 110.430155, 122.342562, 116.657642,
+    130.477365, 90, 109.106086, 130.892563, 90, 103.897494, 119.999272, 136.101274,
+    90, 100.893083, 113.412612, 126.585971, 139.107138, 90, 98.9480173, 109.106086,
+    119.999272, 130.893927, 141.051981, 90, 97.5888694, 106.101666, 115.284347, 124.715508,
+    133.898148, 142.410986, 90, 96.586584, 103.897494, 111.78621, 120.000466, 128.213466,
+    136.102192, 143.413174, 90, 95.8173562, 102.216001, 109.106086, 116.329931, 123.670739,
+    130.893472, 137.783599, 144.182331, 90, 95.2085672, 100.893083, 106.995618, 113.413617,
+    120.000227, 126.586851, 133.003859, 139.106456, 144.791066, 99.8261472, 105.294917, 111.052085,
+    116.995721, 123.004563, 128.948224, 134.704505, 140.173346, 145.285242,
+};
+
+const Double_t  GDetectorGeometry::UnitX[GDetectorGeometry::N_CRYSTALS] =
+{
+    0.0796527256, 0.161203478, 0.13795568, 0.264110207, 0.345191128, 0.21861329, 0.322978191, 0.406702816,
+    0.191523433, 0.272640552, 0.242491092, 0.383204198, 0.463751008, 0.32161042, 0.431947266, 0.504800889,
+    0.285927254, 0.359958971, 0.319090039, 0.468487578, 0.518855584, 0.368276336, 0.459554475, 0.483983936,
+    0.288653779, 0.298379653, 0.198365026, 0.402481132, 0.407899739, 0.203113346, 0.30857435, 0.30840131,
+    0.100666888, 0.0995463656, -0.00125447997, 0.201552928, 0.194299657, -0.00286230096, 0.0906073587, 0.0887303848,
+    -0.0975749827, -0.0991363257, -0.190225727, -0.00629653495, -0.0255390474, -0.209021682, -0.137180067, -0.173225775,
+    0.439896333, 0.522124591, 0.510776349, 0.604839258, 0.678453178, 0.591325948, 0.675653738, 0.735078264,
+    0.56782622, 0.633714072, 0.601941848, 0.715903219, 0.765604262, 0.651632552, 0.73322448, 0.769360236,
+    0.6048892, 0.631523065, 0.569907658, 0.715089153, 0.734106359, 0.582965518, 0.66426901, 0.665442808,
+    0.502570565, 0.503218755, 0.407981823, 0.585031293, 0.57454047, 0.400726867, 0.484923559, 0.461334778,
+    0.293876197, 0.280063959, 0.178467256, 0.362879944, 0.343887463, 0.159477081, 0.24205604, 0.216897572,
+    0.0504864788, 0.0143784314, -0.0976924445, 0.0982967619, 0.0675235021, -0.131325857, -0.0500380262, -0.0803555042,
+    0.742945607, 0.804424946, 0.799365638, 0.854483154, 0.903680238, 0.849734927, 0.90402349, 0.94101587,
+    0.835176626, 0.875232269, 0.842663276, 0.926769801, 0.945328834, 0.861688497, 0.913752613, 0.91383105,
+    0.807401767, 0.807879262, 0.73654654, 0.863119876, 0.849565809, 0.723416376, 0.781178011, 0.755696009,
+    0.641878451, 0.619995277, 0.529061766, 0.676075722, 0.657281717, 0.5098309, 0.581961755, 0.566237535,
+    0.423094453, 0.408696403, 0.304723326, 0.479698302, 0.454966599, 0.273949858, 0.35363246, 0.321531856,
+    0.155349805, 0.123373372, 0.0052842398, 0.210070303, 0.178841058, -0.0252749964, 0.0615795392, 0.0304172782,
+    0.0796527256, 0.161203478, 0.264110207, 0.13795568, 0.21861329, 0.345191128, 0.322978191, 0.406702816,
+    0.439896333, 0.522124591, 0.604839258, 0.510776349, 0.591325948, 0.678453178, 0.675653738, 0.735078264,
+    0.742945607, 0.804424946, 0.854483154, 0.799365638, 0.849734927, 0.903680238, 0.90402349, 0.94101587,
+    0.934106457, 0.965600239, 0.972165333, 0.972165333, 0.988652412, 0.988652412, 0.998595661, 0.998011881,
+    0.976053708, 0.975281331, 0.944550332, 0.986257217, 0.96275249, 0.925003574, 0.931229702, 0.890014369,
+    0.880711308, 0.842747589, 0.786121324, 0.845841883, 0.783578828, 0.725297933, 0.719627872, 0.635878247,
+    0.191523433, 0.272640552, 0.383204198, 0.242491092, 0.32161042, 0.463751008, 0.431947266, 0.504800889,
+    0.56782622, 0.633714072, 0.715903219, 0.601941848, 0.651632552, 0.765604262, 0.73322448, 0.769360236,
+    0.835176626, 0.875232269, 0.926769801, 0.842663276, 0.861688497, 0.945328834, 0.913752613, 0.91383105,
+    0.976053708, 0.975281331, 0.986257217, 0.944550332, 0.925003574, 0.96275249, 0.931229702, 0.890014369,
+    0.950989832, 0.906317063, 0.875906932, 0.875906932, 0.814463901, 0.814463901, 0.783300483, 0.701874043,
+    0.766280984, 0.68452966, 0.618061629, 0.652061237, 0.552507019, 0.523673575, 0.4911899, 0.390223284,
+    0.285927254, 0.359958971, 0.468487578, 0.319090039, 0.368276336, 0.518855584, 0.459554475, 0.483983936,
+    0.6048892, 0.631523065, 0.715089153, 0.569907658, 0.582965518, 0.734106359, 0.66426901, 0.665442808,
+    0.807401767, 0.807879262, 0.863119876, 0.73654654, 0.723416376, 0.849565809, 0.781178011, 0.755696009,
+    0.880711308, 0.842747589, 0.845841883, 0.786121324, 0.725297933, 0.783578828, 0.719627872, 0.635878247,
+    0.766280984, 0.68452966, 0.652061237, 0.618061629, 0.523673575, 0.552507019, 0.4911899, 0.390223284,
+    0.502689041, 0.39920915, 0.348450149, 0.348450149, 0.248479105, 0.248479105, 0.199269376, 0.0984489456,
+    -0.0304172782, -0.0615795392, 0.0252749964, -0.178841058, -0.210070303, -0.0052842398, -0.123373372, -0.155349805,
+    0.0803555042, 0.0500380262, 0.131325857, -0.0675235021, -0.0982967619, 0.0976924445, -0.0143784314, -0.0504864788,
+    0.173225775, 0.137180067, 0.209021682, 0.0255390474, 0.00629653495, 0.190225727, 0.0991363257, 0.0975749827,
+    0.288653779, 0.298379653, 0.402481132, 0.198365026, 0.203113346, 0.407899739, 0.30857435, 0.30840131,
+    0.502570565, 0.503218755, 0.585031293, 0.407981823, 0.400726867, 0.57454047, 0.484923559, 0.461334778,
+    0.641878451, 0.619995277, 0.676075722, 0.529061766, 0.5098309, 0.657281717, 0.581961755, 0.566237535,
+    -0.321531856, -0.35363246, -0.273949858, -0.454966599, -0.479698302, -0.304723326, -0.408696403, -0.423094453,
+    -0.216897572, -0.24205604, -0.159477081, -0.343887463, -0.362879944, -0.178467256, -0.280063959, -0.293876197,
+    -0.0887303848, -0.0906073587, 0.00286230096, -0.194299657, -0.201552928, 0.00125447997, -0.0995463656, -0.100666888,
+    0.100666888, 0.0995463656, 0.201552928, -0.00125447997, -0.00286230096, 0.194299657, 0.0906073587, 0.0887303848,
+    0.293876197, 0.280063959, 0.362879944, 0.178467256, 0.159477081, 0.343887463, 0.24205604, 0.216897572,
+    0.423094453, 0.408696403, 0.479698302, 0.304723326, 0.273949858, 0.454966599, 0.35363246, 0.321531856,
+    -0.566237535, -0.581961755, -0.5098309, -0.657281717, -0.676075722, -0.529061766, -0.619995277, -0.641878451,
+    -0.461334778, -0.484923559, -0.400726867, -0.57454047, -0.585031293, -0.407981823, -0.503218755, -0.502570565,
+    -0.30840131, -0.30857435, -0.203113346, -0.407899739, -0.402481132, -0.198365026, -0.298379653, -0.288653779,
+    -0.0975749827, -0.0991363257, -0.00629653495, -0.190225727, -0.209021682, -0.0255390474, -0.137180067, -0.173225775,
+    0.0504864788, 0.0143784314, 0.0982967619, -0.0976924445, -0.131325857, 0.0675235021, -0.0500380262, -0.0803555042,
+    0.155349805, 0.123373372, 0.210070303, 0.0052842398, -0.0252749964, 0.178841058, 0.0615795392, 0.0304172782,
+    -0.0984489456, -0.199269376, -0.248479105, -0.248479105, -0.348450149, -0.348450149, -0.39920915, -0.502689041,
+    -0.390223284, -0.4911899, -0.523673575, -0.552507019, -0.652061237, -0.618061629, -0.68452966, -0.766280984,
+    -0.635878247, -0.719627872, -0.725297933, -0.783578828, -0.845841883, -0.786121324, -0.842747589, -0.880711308,
+    -0.755696009, -0.781178011, -0.723416376, -0.849565809, -0.863119876, -0.73654654, -0.807879262, -0.807401767,
+    -0.665442808, -0.66426901, -0.582965518, -0.734106359, -0.715089153, -0.569907658, -0.631523065, -0.6048892,
+    -0.483983936, -0.459554475, -0.368276336, -0.518855584, -0.468487578, -0.319090039, -0.359958971, -0.285927254,
+    -0.390223284, -0.4911899, -0.552507019, -0.523673575, -0.618061629, -0.652061237, -0.68452966, -0.766280984,
+    -0.701874043, -0.783300483, -0.814463901, -0.814463901, -0.875906932, -0.875906932, -0.906317063, -0.950989832,
+    -0.890014369, -0.931229702, -0.925003574, -0.96275249, -0.986257217, -0.944550332, -0.975281331, -0.976053708,
+    -0.91383105, -0.913752613, -0.861688497, -0.945328834, -0.926769801, -0.842663276, -0.875232269, -0.835176626,
+    -0.769360236, -0.73322448, -0.651632552, -0.765604262, -0.715903219, -0.601941848, -0.633714072, -0.56782622,
+    -0.504800889, -0.431947266, -0.32161042, -0.463751008, -0.383204198, -0.242491092, -0.272640552, -0.191523433,
+    -0.635878247, -0.719627872, -0.783578828, -0.725297933, -0.786121324, -0.845841883, -0.842747589, -0.880711308,
+    -0.890014369, -0.931229702, -0.96275249, -0.925003574, -0.944550332, -0.986257217, -0.975281331, -0.976053708,
+    -0.998011881, -0.998595661, -0.988652412, -0.988652412, -0.972165333, -0.972165333, -0.965600239, -0.934106457,
+    -0.94101587, -0.90402349, -0.849734927, -0.903680238, -0.854483154, -0.799365638, -0.804424946, -0.742945607,
+    -0.735078264, -0.675653738, -0.591325948, -0.678453178, -0.604839258, -0.510776349, -0.522124591, -0.439896333,
+    -0.406702816, -0.322978191, -0.21861329, -0.345191128, -0.264110207, -0.13795568, -0.161203478, -0.0796527256,
+    -0.0304172782, -0.0615795392, -0.178841058, 0.0252749964, -0.0052842398, -0.210070303, -0.123373372, -0.155349805,
+    -0.321531856, -0.35363246, -0.454966599, -0.273949858, -0.304723326, -0.479698302, -0.408696403, -0.423094453,
+    -0.566237535, -0.581961755, -0.657281717, -0.5098309, -0.529061766, -0.676075722, -0.619995277, -0.641878451,
+    -0.755696009, -0.781178011, -0.849565809, -0.723416376, -0.73654654, -0.863119876, -0.807879262, -0.807401767,
+    -0.91383105, -0.913752613, -0.945328834, -0.861688497, -0.842663276, -0.926769801, -0.875232269, -0.835176626,
+    -0.94101587, -0.90402349, -0.903680238, -0.849734927, -0.799365638, -0.854483154, -0.804424946, -0.742945607,
+    0.0803555042, 0.0500380262, -0.0675235021, 0.131325857, 0.0976924445, -0.0982967619, -0.0143784314, -0.0504864788,
+    -0.216897572, -0.24205604, -0.343887463, -0.159477081, -0.178467256, -0.362879944, -0.280063959, -0.293876197,
+    -0.461334778, -0.484923559, -0.57454047, -0.400726867, -0.407981823, -0.585031293, -0.503218755, -0.502570565,
+    -0.665442808, -0.66426901, -0.734106359, -0.582965518, -0.569907658, -0.715089153, -0.631523065, -0.6048892,
+    -0.769360236, -0.73322448, -0.765604262, -0.651632552, -0.601941848, -0.715903219, -0.633714072, -0.56782622,
+    -0.735078264, -0.675653738, -0.678453178, -0.591325948, -0.510776349, -0.604839258, -0.522124591, -0.439896333,
+    0.173225775, 0.137180067, 0.0255390474, 0.209021682, 0.190225727, 0.00629653495, 0.0991363257, 0.0975749827,
+    -0.0887303848, -0.0906073587, -0.194299657, 0.00286230096, 0.00125447997, -0.201552928, -0.0995463656, -0.100666888,
+    -0.30840131, -0.30857435, -0.407899739, -0.203113346, -0.198365026, -0.402481132, -0.298379653, -0.288653779,
+    -0.483983936, -0.459554475, -0.518855584, -0.368276336, -0.319090039, -0.468487578, -0.359958971, -0.285927254,
+    -0.504800889, -0.431947266, -0.463751008, -0.32161042, -0.242491092, -0.383204198, -0.272640552, -0.191523433,
+    -0.406702816, -0.322978191, -0.345191128, -0.21861329, -0.13795568, -0.264110207, -0.161203478, -0.0796527256,
+    -0.0263964206, -0.0448423451, -0.0264063556, -0.0448592005, -0.0618823111, -0.0802085546, -0.0619286966, -0.0802685196,
+    -0.0619577536, -0.080306083, -0.0619577536, -0.080306083, -0.106179778, -0.106357581, -0.106357581, -0.140759236,
+    -0.141109134, -0.141226348, -0.141109134, -0.174654529, -0.175225595, -0.175513237, -0.175513237, -0.175225595,
+    -0.20773362, -0.208568659, -0.209074542, -0.209243989, -0.209074542, -0.208568659, -0.23987565, -0.241010393,
+    -0.241775896, -0.242161393, -0.242161393, -0.241775896, -0.241010393, -0.270979105, -0.272441767, -0.273501147,
+    -0.274142738, -0.274357607, -0.274142738, -0.273501147, -0.272441767, -0.300962394, -0.302773584, -0.304153642,
+    -0.305084234, -0.305552745, -0.305552745, -0.305084234, -0.304153642, -0.302773584, -0.329769338, -0.33194229,
+    -0.333662384, -0.334907524, -0.335661333, -0.335913736, -0.335661333, -0.334907524, -0.333662384, -0.33194229,
+    -0.359886461, -0.361958717, -0.363536617, -0.364600088, -0.365135335, -0.365135335, -0.364600088, -0.363536617,
+    -0.361958717, -0.0264063556, -0.0448592005, -0.0263964206, -0.0448423451, -0.0619286966, -0.0802685196, -0.0618823111,
+    -0.0802085546, -0.0263716211, -0.0448002709, -0.026341967, -0.0447499604, -0.106179778, -0.0709050406, -0.0354525164,
+    -0.140759236, -0.105826833, -0.0706098133, -0.0352756007, -0.174654529, -0.140181813, -0.105303953, -0.0702026224,
+    -0.0350437812, -0.20773362, -0.173808303, -0.139385229, -0.104618685, -0.0696892968, -0.0347603335, -0.23987565,
+    -0.206581237, -0.172698902, -0.138380727, -0.103780622, -0.0690769304, -0.034429107, -0.270979105, -0.238387297,
+    -0.205127401, -0.17134157, -0.137182001, -0.102801045, -0.0683736243, -0.0340543895, -0.300962394, -0.269132701,
+    -0.236565239, -0.20339149, -0.169754258, -0.135804702, -0.101692526, -0.0675882123, -0.0336407666, -0.329769338,
+    -0.298743464, -0.266926427, -0.234432954, -0.201395693, -0.167956998, -0.134265918, -0.100468523, -0.0667299851,
+    -0.033192986, -0.327170574, -0.296144438, -0.264387671, -0.232016695, -0.199164276, -0.165971271, -0.132583646,
+    -0.0991429837, -0.0658084303, 0.00923989042, -0.00923989042, 0.00923294359, -0.00923294359, 0.00921995457, -0.00921995457,
+    0.00920616606, -0.00920616606, 0.0448002709, 0.0263716211, 0.0447499604, 0.026341967, 0, 0.0354525164,
+    0.0709050406, 0, 0.0352756007, 0.0706098133, 0.105826833, 0, 0.0350437812, 0.0702026224,
+    0.105303953, 0.140181813, 0, 0.0347603335, 0.0696892968, 0.104618685, 0.139385229, 0.173808303,
+    0, 0.034429107, 0.0690769304, 0.103780622, 0.138380727, 0.172698902, 0.206581237, 0,
+    0.0340543895, 0.0683736243, 0.102801045, 0.137182001, 0.17134157, 0.205127401, 0.238387297, 0,
+    0.0336407666, 0.0675882123, 0.101692526, 0.135804702, 0.169754258, 0.20339149, 0.236565239, 0.269132701,
+    0, 0.033192986, 0.0667299851, 0.100468523, 0.134265918, 0.167956998, 0.201395693, 0.234432954,
+    0.266926427, 0.298743464, 0.0658084303, 0.0991429837, 0.132583646, 0.165971271, 0.199164276, 0.232016695,
+    0.264387671, 0.296144438, 0.327170574, 0.0448592005, 0.0264063556, 0.0448423451, 0.0263964206, 0.0802685196,
+    0.0619286966, 0.0802085546, 0.0618823111, 0.080306083, 0.0619577536, 0.080306083, 0.0619577536, 0.106179778,
+    0.106357581, 0.106357581, 0.140759236, 0.141109134, 0.141226348, 0.141109134, 0.174654529, 0.175225595,
+    0.175513237, 0.175513237, 0.175225595, 0.20773362, 0.208568659, 0.209074542, 0.209243989, 0.209074542,
+    0.208568659, 0.23987565, 0.241010393, 0.241775896, 0.242161393, 0.242161393, 0.241775896, 0.241010393,
+    0.270979105, 0.272441767, 0.273501147, 0.274142738, 0.274357607, 0.274142738, 0.273501147, 0.272441767,
+    0.300962394, 0.302773584, 0.304153642, 0.305084234, 0.305552745, 0.305552745, 0.305084234, 0.304153642,
+    0.302773584, 0.329769338, 0.33194229, 0.333662384, 0.334907524, 0.335661333, 0.335913736, 0.335661333,
+    0.334907524, 0.333662384, 0.33194229, 0.359886461, 0.361958717, 0.363536617, 0.364600088, 0.365135335,
+    0.365135335, 0.364600088, 0.363536617, 0.361958717, 0.0448423451, 0.0263964206, 0.0448592005, 0.0264063556,
+    0.0802085546, 0.0618823111, 0.0802685196, 0.0619286966, 0.0447499604, 0.026341967, 0.0448002709, 0.0263716211,
+    0.106179778, 0.0709050406, 0.0354525164, 0.140759236, 0.105826833, 0.0706098133, 0.0352756007, 0.174654529,
+    0.140181813, 0.105303953, 0.0702026224, 0.0350437812, 0.20773362, 0.173808303, 0.139385229, 0.104618685,
+    0.0696892968, 0.0347603335, 0.23987565, 0.206581237, 0.172698902, 0.138380727, 0.103780622, 0.0690769304,
+    0.034429107, 0.270979105, 0.238387297, 0.205127401, 0.17134157, 0.137182001, 0.102801045, 0.0683736243,
+    0.0340543895, 0.300962394, 0.269132701, 0.236565239, 0.20339149, 0.169754258, 0.135804702, 0.101692526,
+    0.0675882123, 0.0336407666, 0.329769338, 0.298743464, 0.266926427, 0.234432954, 0.201395693, 0.167956998,
+    0.134265918, 0.100468523, 0.0667299851, 0.033192986, 0.327170574, 0.296144438, 0.264387671, 0.232016695,
+    0.199164276, 0.165971271, 0.132583646, 0.0991429837, 0.0658084303, 0.00923294359, -0.00923294359, 0.00923989042,
+    -0.00923989042, 0.00920616606, -0.00920616606, 0.00921995457, -0.00921995457, -0.026341967, -0.0447499604, -0.0263716211,
+    -0.0448002709, 0, -0.0354525164, -0.0709050406, 0, -0.0352756007, -0.0706098133, -0.105826833,
+    0, -0.0350437812, -0.0702026224, -0.105303953, -0.140181813, 0, -0.0347603335, -0.0696892968,
+    -0.104618685, -0.139385229, -0.173808303, 0, -0.034429107, -0.0690769304, -0.103780622, -0.138380727,
+    -0.172698902, -0.206581237, 0, -0.0340543895, -0.0683736243, -0.102801045, -0.137182001, -0.17134157,
+    -0.205127401, -0.238387297, 0, -0.0336407666, -0.0675882123, -0.101692526, -0.135804702, -0.169754258,
+    -0.20339149, -0.236565239, -0.269132701, 0, -0.033192986, -0.0667299851, -0.100468523, -0.134265918,
+    -0.167956998, -0.201395693, -0.234432954, -0.266926427, -0.298743464, -0.0658084303, -0.0991429837, -0.132583646,
+    -0.165971271, -0.199164276, -0.232016695, -0.264387671, -0.296144438, -0.327170574,
+};
+
+const Double_t  GDetectorGeometry::UnitY[GDetectorGeometry::N_CRYSTALS] =
+{
+    0.995141844, 0.979946299, 0.962673493, 0.962672459, 0.931122133, 0.9311266, 0.916859075, 0.864461175,
+    0.896145672, 0.844802331, 0.794203445, 0.826414254, 0.750352085, 0.72514816, 0.698883939, 0.611917229,
+    0.666723263, 0.582407011, 0.516248858, 0.553889303, 0.453137252, 0.417840569, 0.383182219, 0.270580111,
+    0.356993084, 0.260028192, 0.208272269, 0.208274794, 0.104760173, 0.10476025, 0.0529777284, -0.0630249711,
+    0.0517419883, -0.0615389551, -0.113211315, -0.12457351, -0.247647192, -0.228521705, -0.299719895, -0.411704582,
+    -0.270576836, -0.383181823, -0.417845127, -0.453130358, -0.5538891, -0.516248561, -0.582404349, -0.666725488,
+    0.896145445, 0.844803185, 0.826412765, 0.794200912, 0.725152704, 0.750356122, 0.698883808, 0.611912033,
+    0.712306888, 0.62163997, 0.57205384, 0.572053507, 0.472642773, 0.47263608, 0.42259888, 0.30922109,
+    0.411706881, 0.299720789, 0.228522314, 0.247651259, 0.124573888, 0.113212573, 0.0615398483, -0.0517432129,
+    0.0517426494, -0.0615390333, -0.124574771, -0.113211985, -0.22851717, -0.247649115, -0.299722085, -0.411707107,
+    -0.309219219, -0.422596706, -0.472633411, -0.472637482, -0.572052668, -0.572057452, -0.621642919, -0.712307587,
+    -0.611914617, -0.698884244, -0.725152279, -0.750353259, -0.826418886, -0.794205607, -0.844807574, -0.896147648,
+    0.666724606, 0.582398465, 0.553884563, 0.516246571, 0.417846741, 0.453136187, 0.383189539, 0.27057894,
+    0.411709578, 0.299722299, 0.247651517, 0.228521899, 0.113214088, 0.124575361, 0.0615396554, -0.0517428963,
+    0.0630252184, -0.0529778551, -0.104761701, -0.104760704, -0.2082744, -0.208275577, -0.260033073, -0.356994008,
+    -0.270577471, -0.383176543, -0.453129261, -0.41784288, -0.516246985, -0.553885468, -0.582402068, -0.666719985,
+    -0.611919289, -0.698886043, -0.750356114, -0.725150942, -0.794210753, -0.826412834, -0.844795998, -0.896147072,
+    -0.864465341, -0.916855941, -0.931127088, -0.931125996, -0.962676999, -0.962673535, -0.979944687, -0.995142414,
+    0.995141844, 0.979946299, 0.962672459, 0.962673493, 0.9311266, 0.931122133, 0.916859075, 0.864461175,
+    0.896145445, 0.844803185, 0.794200912, 0.826412765, 0.750356122, 0.725152704, 0.698883808, 0.611912033,
+    0.666724606, 0.582398465, 0.516246571, 0.553884563, 0.453136187, 0.417846741, 0.383189539, 0.27057894,
+    0.356994575, 0.260031109, 0.20827711, 0.20827711, 0.10475933, 0.10475933, 0.0529783502, -0.063026064,
+    0.0517430835, -0.0615389652, -0.113213107, -0.124574522, -0.247648695, -0.228520711, -0.299723321, -0.411705679,
+    -0.270578256, -0.383187173, -0.417842918, -0.453138229, -0.553883739, -0.516252604, -0.582403883, -0.666723251,
+    0.896145672, 0.844802331, 0.826414254, 0.794203445, 0.72514816, 0.750352085, 0.698883939, 0.611917229,
+    0.712306888, 0.62163997, 0.572053507, 0.57205384, 0.47263608, 0.472642773, 0.42259888, 0.30922109,
+    0.411709578, 0.299722299, 0.228521899, 0.247651517, 0.124575361, 0.113214088, 0.0615396554, -0.0517428963,
+    0.0517430835, -0.0615389652, -0.124574522, -0.113213107, -0.228520711, -0.247648695, -0.299723321, -0.411705679,
+    -0.309222151, -0.422598368, -0.472639363, -0.472639363, -0.572057118, -0.572057118, -0.621643268, -0.71230108,
+    -0.611915097, -0.698886111, -0.725156203, -0.750358714, -0.826412765, -0.794203776, -0.844803443, -0.896148981,
+    0.666723263, 0.582407011, 0.553889303, 0.516248858, 0.417840569, 0.453137252, 0.383182219, 0.270580111,
+    0.411706881, 0.299720789, 0.247651259, 0.228522314, 0.113212573, 0.124573888, 0.0615398483, -0.0517432129,
+    0.0630252184, -0.0529778551, -0.104760704, -0.104761701, -0.208275577, -0.2082744, -0.260033073, -0.356994008,
+    -0.270578256, -0.383187173, -0.453138229, -0.417842918, -0.516252604, -0.553883739, -0.582403883, -0.666723251,
+    -0.611915097, -0.698886111, -0.750358714, -0.725156203, -0.794203776, -0.826412765, -0.844803443, -0.896148981,
+    -0.864467309, -0.916859888, -0.931123267, -0.931123267, -0.962674896, -0.962674896, -0.979944751, -0.995142103,
+    0.995142414, 0.979944687, 0.962673535, 0.962676999, 0.931125996, 0.931127088, 0.916855941, 0.864465341,
+    0.896147648, 0.844807574, 0.794205607, 0.826418886, 0.750353259, 0.725152279, 0.698884244, 0.611914617,
+    0.666725488, 0.582404349, 0.516248561, 0.5538891, 0.453130358, 0.417845127, 0.383181823, 0.270576836,
+    0.356993084, 0.260028192, 0.208274794, 0.208272269, 0.10476025, 0.104760173, 0.0529777284, -0.0630249711,
+    0.0517426494, -0.0615390333, -0.113211985, -0.124574771, -0.247649115, -0.22851717, -0.299722085, -0.411707107,
+    -0.270577471, -0.383176543, -0.41784288, -0.453129261, -0.553885468, -0.516246985, -0.582402068, -0.666719985,
+    0.896147072, 0.844795998, 0.826412834, 0.794210753, 0.725150942, 0.750356114, 0.698886043, 0.611919289,
+    0.712307587, 0.621642919, 0.572057452, 0.572052668, 0.472637482, 0.472633411, 0.422596706, 0.309219219,
+    0.411704582, 0.299719895, 0.228521705, 0.247647192, 0.12457351, 0.113211315, 0.0615389551, -0.0517419883,
+    0.0517419883, -0.0615389551, -0.12457351, -0.113211315, -0.228521705, -0.247647192, -0.299719895, -0.411704582,
+    -0.309219219, -0.422596706, -0.472637482, -0.472633411, -0.572057452, -0.572052668, -0.621642919, -0.712307587,
+    -0.611919289, -0.698886043, -0.725150942, -0.750356114, -0.826412834, -0.794210753, -0.844795998, -0.896147072,
+    0.666719985, 0.582402068, 0.553885468, 0.516246985, 0.41784288, 0.453129261, 0.383176543, 0.270577471,
+    0.411707107, 0.299722085, 0.247649115, 0.22851717, 0.113211985, 0.124574771, 0.0615390333, -0.0517426494,
+    0.0630249711, -0.0529777284, -0.10476025, -0.104760173, -0.208274794, -0.208272269, -0.260028192, -0.356993084,
+    -0.270576836, -0.383181823, -0.453130358, -0.417845127, -0.516248561, -0.5538891, -0.582404349, -0.666725488,
+    -0.611914617, -0.698884244, -0.750353259, -0.725152279, -0.794205607, -0.826418886, -0.844807574, -0.896147648,
+    -0.864465341, -0.916855941, -0.931125996, -0.931127088, -0.962673535, -0.962676999, -0.979944687, -0.995142414,
+    0.995142103, 0.979944751, 0.962674896, 0.962674896, 0.931123267, 0.931123267, 0.916859888, 0.864467309,
+    0.896148981, 0.844803443, 0.794203776, 0.826412765, 0.750358714, 0.725156203, 0.698886111, 0.611915097,
+    0.666723251, 0.582403883, 0.516252604, 0.553883739, 0.453138229, 0.417842918, 0.383187173, 0.270578256,
+    0.356994008, 0.260033073, 0.208275577, 0.2082744, 0.104760704, 0.104761701, 0.0529778551, -0.0630252184,
+    0.0517432129, -0.0615398483, -0.113212573, -0.124573888, -0.247651259, -0.228522314, -0.299720789, -0.411706881,
+    -0.270580111, -0.383182219, -0.417840569, -0.453137252, -0.553889303, -0.516248858, -0.582407011, -0.666723263,
+    0.896148981, 0.844803443, 0.826412765, 0.794203776, 0.725156203, 0.750358714, 0.698886111, 0.611915097,
+    0.71230108, 0.621643268, 0.572057118, 0.572057118, 0.472639363, 0.472639363, 0.422598368, 0.309222151,
+    0.411705679, 0.299723321, 0.228520711, 0.247648695, 0.124574522, 0.113213107, 0.0615389652, -0.0517430835,
+    0.0517428963, -0.0615396554, -0.124575361, -0.113214088, -0.228521899, -0.247651517, -0.299722299, -0.411709578,
+    -0.30922109, -0.42259888, -0.47263608, -0.472642773, -0.572053507, -0.57205384, -0.62163997, -0.712306888,
+    -0.611917229, -0.698883939, -0.72514816, -0.750352085, -0.826414254, -0.794203445, -0.844802331, -0.896145672,
+    0.666723251, 0.582403883, 0.553883739, 0.516252604, 0.417842918, 0.453138229, 0.383187173, 0.270578256,
+    0.411705679, 0.299723321, 0.247648695, 0.228520711, 0.113213107, 0.124574522, 0.0615389652, -0.0517430835,
+    0.063026064, -0.0529783502, -0.10475933, -0.10475933, -0.20827711, -0.20827711, -0.260031109, -0.356994575,
+    -0.27057894, -0.383189539, -0.453136187, -0.417846741, -0.516246571, -0.553884563, -0.582398465, -0.666724606,
+    -0.611912033, -0.698883808, -0.750356122, -0.725152704, -0.794200912, -0.826412765, -0.844803185, -0.896145445,
+    -0.864461175, -0.916859075, -0.9311266, -0.931122133, -0.962672459, -0.962673493, -0.979946299, -0.995141844,
+    0.995142414, 0.979944687, 0.962676999, 0.962673535, 0.931127088, 0.931125996, 0.916855941, 0.864465341,
+    0.896147072, 0.844795998, 0.794210753, 0.826412834, 0.750356114, 0.725150942, 0.698886043, 0.611919289,
+    0.666719985, 0.582402068, 0.516246985, 0.553885468, 0.453129261, 0.41784288, 0.383176543, 0.270577471,
+    0.356994008, 0.260033073, 0.2082744, 0.208275577, 0.104761701, 0.104760704, 0.0529778551, -0.0630252184,
+    0.0517428963, -0.0615396554, -0.113214088, -0.124575361, -0.247651517, -0.228521899, -0.299722299, -0.411709578,
+    -0.27057894, -0.383189539, -0.417846741, -0.453136187, -0.553884563, -0.516246571, -0.582398465, -0.666724606,
+    0.896147648, 0.844807574, 0.826418886, 0.794205607, 0.725152279, 0.750353259, 0.698884244, 0.611914617,
+    0.712307587, 0.621642919, 0.572052668, 0.572057452, 0.472633411, 0.472637482, 0.422596706, 0.309219219,
+    0.411707107, 0.299722085, 0.22851717, 0.247649115, 0.124574771, 0.113211985, 0.0615390333, -0.0517426494,
+    0.0517432129, -0.0615398483, -0.124573888, -0.113212573, -0.228522314, -0.247651259, -0.299720789, -0.411706881,
+    -0.30922109, -0.42259888, -0.472642773, -0.47263608, -0.57205384, -0.572053507, -0.62163997, -0.712306888,
+    -0.611912033, -0.698883808, -0.725152704, -0.750356122, -0.826412765, -0.794200912, -0.844803185, -0.896145445,
+    0.666725488, 0.582404349, 0.5538891, 0.516248561, 0.417845127, 0.453130358, 0.383181823, 0.270576836,
+    0.411704582, 0.299719895, 0.247647192, 0.228521705, 0.113211315, 0.12457351, 0.0615389551, -0.0517419883,
+    0.0630249711, -0.0529777284, -0.104760173, -0.10476025, -0.208272269, -0.208274794, -0.260028192, -0.356993084,
+    -0.270580111, -0.383182219, -0.453137252, -0.417840569, -0.516248858, -0.553889303, -0.582407011, -0.666723263,
+    -0.611917229, -0.698883939, -0.750352085, -0.72514816, -0.794203445, -0.826414254, -0.844802331, -0.896145672,
+    -0.864461175, -0.916859075, -0.931122133, -0.9311266, -0.962673493, -0.962672459, -0.979946299, -0.995141844,
+    0.0297156899, 0.0296961457, 0.0114365796, 0.011429052, 0.0501694845, 0.0501038701, 0.0319537012, 0.0319118478,
+    0.00913097685, 0.00911900577, -0.00913097685, -0.00911900577, 0.0613047219, 0.0204691264, -0.0204691264, 0.0812658567,
+    0.0407339333, 0, -0.0407339333, 0.100835916, 0.0606993709, 0.0202663373, -0.0202663373, -0.0606993709,
+    0.119934732, 0.080277894, 0.040236304, 0, -0.040236304, -0.080277894, 0.138492526, 0.0993911938,
+    0.0598241295, 0.0199731718, -0.0199731718, -0.0598241295, -0.0993911938, 0.156450685, 0.117971368, 0.0789533972,
+    0.0395693047, 0, -0.0395693047, -0.0789533972, -0.117971368, 0.173762101, 0.135961622, 0.0975581018,
+    0.058713955, 0.0196013735, -0.0196013735, -0.058713955, -0.0975581018, -0.135961622, 0.190390673, 0.153316173,
+    0.115582982, 0.0773428716, 0.0387584773, 0, -0.0387584773, -0.0773428716, -0.115582982, -0.153316173,
+    0.170001303, 0.132984588, 0.0954030803, 0.0574093004, 0.0191645265, -0.0191645265, -0.0574093004, -0.0954030803,
+    -0.132984588, -0.0114365796, -0.011429052, -0.0297156899, -0.0296961457, -0.0319537012, -0.0319118478, -0.0501694845,
+    -0.0501038701, -0.0525308441, -0.052496359, -0.0707174708, -0.070671151, -0.0613047219, -0.0818764903, -0.102345602,
+    -0.0812658567, -0.101834905, -0.122303372, -0.142568825, -0.100835916, -0.121398731, -0.141864447, -0.162130768,
+    -0.18209817, -0.119934732, -0.140486292, -0.160945177, -0.181210193, -0.201181573, -0.220764243, -0.138492526,
+    -0.159025874, -0.17947232, -0.199731625, -0.219704935, -0.239296526, -0.258417085, -0.156450685, -0.176957002,
+    -0.197383392, -0.217631031, -0.237601733, -0.257200459, -0.276336819, -0.294928315, -0.173762101, -0.194230822,
+    -0.214627688, -0.23485562, -0.2548176, -0.274418931, -0.293569647, -0.312185738, -0.330192282, -0.190390673,
+    -0.2108101, -0.231166287, -0.251364616, -0.271309591, -0.290907391, -0.310068033, -0.328707639, -0.346749345,
+    -0.364126289, -0.226668347, -0.246971732, -0.267128923, -0.287046746, -0.306632622, -0.325797114, -0.344455947,
+    -0.362532081, -0.379956295, -0.0320137851, -0.0320137851, -0.0502636788, -0.0502636788, -0.0730135526, -0.0730135526,
+    -0.0911253244, -0.0911253244, -0.052496359, -0.0525308441, -0.070671151, -0.0707174708, -0.122609403, -0.102345602,
+    -0.0818764903, -0.162531774, -0.142568825, -0.122303372, -0.101834905, -0.201671888, -0.18209817, -0.162130768,
+    -0.141864447, -0.121398731, -0.239869493, -0.220764243, -0.201181573, -0.181210193, -0.160945177, -0.140486292,
+    -0.276985023, -0.258417085, -0.239296526, -0.219704935, -0.199731625, -0.17947232, -0.159025874, -0.312901248,
+    -0.294928315, -0.276336819, -0.257200459, -0.237601733, -0.217631031, -0.197383392, -0.176957002, -0.347523951,
+    -0.330192282, -0.312185738, -0.293569647, -0.274418931, -0.2548176, -0.23485562, -0.214627688, -0.194230822,
+    -0.380781725, -0.364126289, -0.346749345, -0.328707639, -0.310068033, -0.290907391, -0.271309591, -0.251364616,
+    -0.231166287, -0.2108101, -0.379956295, -0.362532081, -0.344455947, -0.325797114, -0.306632622, -0.287046746,
+    -0.267128923, -0.246971732, -0.226668347, -0.011429052, -0.0114365796, -0.0296961457, -0.0297156899, -0.0319118478,
+    -0.0319537012, -0.0501038701, -0.0501694845, 0.00911900577, 0.00913097685, -0.00911900577, -0.00913097685, -0.0613047219,
+    -0.0204691264, 0.0204691264, -0.0812658567, -0.0407339333, 0, 0.0407339333, -0.100835916, -0.0606993709,
+    -0.0202663373, 0.0202663373, 0.0606993709, -0.119934732, -0.080277894, -0.040236304, 0, 0.040236304,
+    0.080277894, -0.138492526, -0.0993911938, -0.0598241295, -0.0199731718, 0.0199731718, 0.0598241295, 0.0993911938,
+    -0.156450685, -0.117971368, -0.0789533972, -0.0395693047, 0, 0.0395693047, 0.0789533972, 0.117971368,
+    -0.173762101, -0.135961622, -0.0975581018, -0.058713955, -0.0196013735, 0.0196013735, 0.058713955, 0.0975581018,
+    0.135961622, -0.190390673, -0.153316173, -0.115582982, -0.0773428716, -0.0387584773, 0, 0.0387584773,
+    0.0773428716, 0.115582982, 0.153316173, -0.170001303, -0.132984588, -0.0954030803, -0.0574093004, -0.0191645265,
+    0.0191645265, 0.0574093004, 0.0954030803, 0.132984588, 0.0296961457, 0.0297156899, 0.011429052, 0.0114365796,
+    0.0501038701, 0.0501694845, 0.0319118478, 0.0319537012, 0.070671151, 0.0707174708, 0.052496359, 0.0525308441,
+    0.0613047219, 0.0818764903, 0.102345602, 0.0812658567, 0.101834905, 0.122303372, 0.142568825, 0.100835916,
+    0.121398731, 0.141864447, 0.162130768, 0.18209817, 0.119934732, 0.140486292, 0.160945177, 0.181210193,
+    0.201181573, 0.220764243, 0.138492526, 0.159025874, 0.17947232, 0.199731625, 0.219704935, 0.239296526,
+    0.258417085, 0.156450685, 0.176957002, 0.197383392, 0.217631031, 0.237601733, 0.257200459, 0.276336819,
+    0.294928315, 0.173762101, 0.194230822, 0.214627688, 0.23485562, 0.2548176, 0.274418931, 0.293569647,
+    0.312185738, 0.330192282, 0.190390673, 0.2108101, 0.231166287, 0.251364616, 0.271309591, 0.290907391,
+    0.310068033, 0.328707639, 0.346749345, 0.364126289, 0.226668347, 0.246971732, 0.267128923, 0.287046746,
+    0.306632622, 0.325797114, 0.344455947, 0.362532081, 0.379956295, 0.0502636788, 0.0502636788, 0.0320137851,
+    0.0320137851, 0.0911253244, 0.0911253244, 0.0730135526, 0.0730135526, 0.0707174708, 0.070671151, 0.0525308441,
+    0.052496359, 0.122609403, 0.102345602, 0.0818764903, 0.162531774, 0.142568825, 0.122303372, 0.101834905,
+    0.201671888, 0.18209817, 0.162130768, 0.141864447, 0.121398731, 0.239869493, 0.220764243, 0.201181573,
+    0.181210193, 0.160945177, 0.140486292, 0.276985023, 0.258417085, 0.239296526, 0.219704935, 0.199731625,
+    0.17947232, 0.159025874, 0.312901248, 0.294928315, 0.276336819, 0.257200459, 0.237601733, 0.217631031,
+    0.197383392, 0.176957002, 0.347523951, 0.330192282, 0.312185738, 0.293569647, 0.274418931, 0.2548176,
+    0.23485562, 0.214627688, 0.194230822, 0.380781725, 0.364126289, 0.346749345, 0.328707639, 0.310068033,
+    0.290907391, 0.271309591, 0.251364616, 0.231166287, 0.2108101, 0.379956295, 0.362532081, 0.344455947,
+    0.325797114, 0.306632622, 0.287046746, 0.267128923, 0.246971732, 0.226668347,
+};
+
+const Double_t  GDetectorGeometry::UnitZ[GDetectorGeometry::N_CRYSTALS] =
+{
+    0.0578632262, 0.11712681, 0.232869012, 0.0592244463, 0.117705815, 0.291910061, 0.234637006, 0.29546522,
+    0.400302023, 0.460408678, 0.557170493, 0.412545784, 0.471069795, 0.608873454, 0.570072627, 0.608878779,
+    0.688277339, 0.728856373, 0.794775858, 0.688277582, 0.724883103, 0.830531035, 0.801237213, 0.832193459,
+    0.888388954, 0.918343575, 0.957744213, 0.891420523, 0.906996753, 0.973534929, 0.949723766, 0.949166205,
+    0.993573824, 0.993128128, 0.993570141, 0.971523473, 0.949167273, 0.97353461, 0.949714847, 0.906987462,
+    0.957740726, 0.918337454, 0.888380337, 0.891422028, 0.832198668, 0.830540402, 0.80124079, 0.724893065,
+    0.0584342205, 0.117019188, 0.236958782, 0.058432728, 0.117706584, 0.295464572, 0.234634715, 0.29193083,
+    0.412543671, 0.460402241, 0.557153853, 0.400296598, 0.436415998, 0.593287581, 0.532721362, 0.558987607,
+    0.681620495, 0.715084657, 0.789292603, 0.653694391, 0.667509701, 0.804570766, 0.744956058, 0.744653281,
+    0.862986399, 0.861965099, 0.904451192, 0.803070005, 0.78592821, 0.882092906, 0.82159346, 0.785918241,
+    0.904444722, 0.861960674, 0.862998897, 0.803076557, 0.744645659, 0.804560335, 0.744962385, 0.667512805,
+    0.789310849, 0.715090256, 0.681623326, 0.653687795, 0.558992309, 0.593288271, 0.532725406, 0.436419965,
+    0.059246307, 0.117100531, 0.232865769, 0.0578620496, 0.0936276026, 0.26947755, 0.189492236, 0.203165375,
+    0.364657684, 0.379651181, 0.478108074, 0.298119906, 0.305836503, 0.49190844, 0.401583158, 0.402784664,
+    0.586626124, 0.586962047, 0.668224648, 0.494013435, 0.484623266, 0.658247697, 0.567577057, 0.54907087,
+    0.717481628, 0.68467627, 0.71747301, 0.606901101, 0.549062651, 0.658242616, 0.567563518, 0.484623066,
+    0.668240875, 0.586962988, 0.586608385, 0.494009767, 0.402783656, 0.491928148, 0.401576649, 0.305839323,
+    0.478085884, 0.379676433, 0.364656582, 0.298118846, 0.203147414, 0.26948254, 0.189516151, 0.0936288722,
+    -0.0578632262, -0.11712681, -0.0592244463, -0.232869012, -0.291910061, -0.117705815, -0.234637006, -0.29546522,
+    -0.0584342205, -0.117019188, -0.058432728, -0.236958782, -0.295464572, -0.117706584, -0.234634715, -0.29193083,
+    -0.059246307, -0.117100531, -0.0578620496, -0.232865769, -0.26947755, -0.0936276026, -0.189492236, -0.203165375,
+    0, 0, 0.107308946, -0.107308946, -0.107665641, 0.107665641, 0, 0,
+    0.211286092, 0.212224602, 0.308232807, 0.10852599, 0.108525416, 0.303556705, 0.207309365, 0.19588991,
+    0.38876085, 0.378079478, 0.455434474, 0.281455598, 0.281455192, 0.455440618, 0.378075976, 0.388765947,
+    -0.400302023, -0.460408678, -0.412545784, -0.557170493, -0.608873454, -0.471069795, -0.570072627, -0.608878779,
+    -0.412543671, -0.460402241, -0.400296598, -0.557153853, -0.593287581, -0.436415998, -0.532721362, -0.558987607,
+    -0.364657684, -0.379651181, -0.298119906, -0.478108074, -0.49190844, -0.305836503, -0.401583158, -0.402784664,
+    -0.211286092, -0.212224602, -0.10852599, -0.308232807, -0.303556705, -0.108525416, -0.207309365, -0.19588991,
+    0, 0, 0.0969488426, -0.0969488426, -0.0969495078, 0.0969495078, 0, 0,
+    0.195891214, 0.20730979, 0.303559392, 0.108526234, 0.108526196, 0.308231, 0.212225412, 0.211288411,
+    -0.688277339, -0.728856373, -0.688277582, -0.794775858, -0.830531035, -0.724883103, -0.801237213, -0.832193459,
+    -0.681620495, -0.715084657, -0.653694391, -0.789292603, -0.804570766, -0.667509701, -0.744956058, -0.744653281,
+    -0.586626124, -0.586962047, -0.494013435, -0.668224648, -0.658247697, -0.484623266, -0.567577057, -0.54907087,
+    -0.38876085, -0.378079478, -0.281455598, -0.455434474, -0.455440618, -0.281455192, -0.378075976, -0.388765947,
+    -0.195891214, -0.20730979, -0.108526234, -0.303559392, -0.308231, -0.108526196, -0.212225412, -0.211288411,
+    0, 0, 0.107665944, -0.107665944, -0.107308804, 0.107308804, 0, 0,
+    -0.0936288722, -0.189516151, -0.26948254, -0.203147414, -0.298118846, -0.364656582, -0.379676433, -0.478085884,
+    -0.436419965, -0.532725406, -0.593288271, -0.558992309, -0.653687795, -0.681623326, -0.715090256, -0.789310849,
+    -0.724893065, -0.80124079, -0.830540402, -0.832198668, -0.891422028, -0.888380337, -0.918337454, -0.957740726,
+    -0.888388954, -0.918343575, -0.891420523, -0.957744213, -0.973534929, -0.906996753, -0.949723766, -0.949166205,
+    -0.862986399, -0.861965099, -0.803070005, -0.904451192, -0.882092906, -0.78592821, -0.82159346, -0.785918241,
+    -0.717481628, -0.68467627, -0.606901101, -0.71747301, -0.658242616, -0.549062651, -0.567563518, -0.484623066,
+    -0.305839323, -0.401576649, -0.491928148, -0.402783656, -0.494009767, -0.586608385, -0.586962988, -0.668240875,
+    -0.667512805, -0.744962385, -0.804560335, -0.744645659, -0.803076557, -0.862998897, -0.861960674, -0.904444722,
+    -0.906987462, -0.949714847, -0.97353461, -0.949167273, -0.971523473, -0.993570141, -0.993128128, -0.993573824,
+    -0.993573824, -0.993128128, -0.971523473, -0.993570141, -0.97353461, -0.949167273, -0.949714847, -0.906987462,
+    -0.904444722, -0.861960674, -0.803076557, -0.862998897, -0.804560335, -0.744645659, -0.744962385, -0.667512805,
+    -0.668240875, -0.586962988, -0.494009767, -0.586608385, -0.491928148, -0.402783656, -0.401576649, -0.305839323,
+    -0.484623066, -0.567563518, -0.658242616, -0.549062651, -0.606901101, -0.71747301, -0.68467627, -0.717481628,
+    -0.785918241, -0.82159346, -0.882092906, -0.78592821, -0.803070005, -0.904451192, -0.861965099, -0.862986399,
+    -0.949166205, -0.949723766, -0.973534929, -0.906996753, -0.891420523, -0.957744213, -0.918343575, -0.888388954,
+    -0.957740726, -0.918337454, -0.891422028, -0.888380337, -0.830540402, -0.832198668, -0.80124079, -0.724893065,
+    -0.789310849, -0.715090256, -0.653687795, -0.681623326, -0.593288271, -0.558992309, -0.532725406, -0.436419965,
+    -0.478085884, -0.379676433, -0.298118846, -0.364656582, -0.26948254, -0.203147414, -0.189516151, -0.0936288722,
+    0, 0, -0.107308804, 0.107308804, 0.107665944, -0.107665944, 0, 0,
+    -0.211288411, -0.212225412, -0.308231, -0.108526196, -0.108526234, -0.303559392, -0.20730979, -0.195891214,
+    -0.388765947, -0.378075976, -0.455440618, -0.281455192, -0.281455598, -0.455434474, -0.378079478, -0.38876085,
+    -0.54907087, -0.567577057, -0.658247697, -0.484623266, -0.494013435, -0.668224648, -0.586962047, -0.586626124,
+    -0.744653281, -0.744956058, -0.804570766, -0.667509701, -0.653694391, -0.789292603, -0.715084657, -0.681620495,
+    -0.832193459, -0.801237213, -0.830531035, -0.724883103, -0.688277582, -0.794775858, -0.728856373, -0.688277339,
+    0.211288411, 0.212225412, 0.108526196, 0.308231, 0.303559392, 0.108526234, 0.20730979, 0.195891214,
+    0, 0, -0.0969495078, 0.0969495078, 0.0969488426, -0.0969488426, 0, 0,
+    -0.19588991, -0.207309365, -0.303556705, -0.108525416, -0.10852599, -0.308232807, -0.212224602, -0.211286092,
+    -0.402784664, -0.401583158, -0.49190844, -0.305836503, -0.298119906, -0.478108074, -0.379651181, -0.364657684,
+    -0.558987607, -0.532721362, -0.593287581, -0.436415998, -0.400296598, -0.557153853, -0.460402241, -0.412543671,
+    -0.608878779, -0.570072627, -0.608873454, -0.471069795, -0.412545784, -0.557170493, -0.460408678, -0.400302023,
+    0.388765947, 0.378075976, 0.281455192, 0.455440618, 0.455434474, 0.281455598, 0.378079478, 0.38876085,
+    0.19588991, 0.207309365, 0.108525416, 0.303556705, 0.308232807, 0.10852599, 0.212224602, 0.211286092,
+    0, 0, -0.107665641, 0.107665641, 0.107308946, -0.107308946, 0, 0,
+    -0.203165375, -0.189492236, -0.26947755, -0.0936276026, -0.0578620496, -0.232865769, -0.117100531, -0.059246307,
+    -0.29193083, -0.234634715, -0.295464572, -0.117706584, -0.058432728, -0.236958782, -0.117019188, -0.0584342205,
+    -0.29546522, -0.234637006, -0.291910061, -0.117705815, -0.0592244463, -0.232869012, -0.11712681, -0.0578632262,
+    0.0936288722, 0.189516151, 0.203147414, 0.26948254, 0.364656582, 0.298118846, 0.379676433, 0.478085884,
+    0.305839323, 0.401576649, 0.402783656, 0.491928148, 0.586608385, 0.494009767, 0.586962988, 0.668240875,
+    0.484623066, 0.567563518, 0.549062651, 0.658242616, 0.71747301, 0.606901101, 0.68467627, 0.717481628,
+    0.54907087, 0.567577057, 0.484623266, 0.658247697, 0.668224648, 0.494013435, 0.586962047, 0.586626124,
+    0.402784664, 0.401583158, 0.305836503, 0.49190844, 0.478108074, 0.298119906, 0.379651181, 0.364657684,
+    0.203165375, 0.189492236, 0.0936276026, 0.26947755, 0.232865769, 0.0578620496, 0.117100531, 0.059246307,
+    0.436419965, 0.532725406, 0.558992309, 0.593288271, 0.681623326, 0.653687795, 0.715090256, 0.789310849,
+    0.667512805, 0.744962385, 0.744645659, 0.804560335, 0.862998897, 0.803076557, 0.861960674, 0.904444722,
+    0.785918241, 0.82159346, 0.78592821, 0.882092906, 0.904451192, 0.803070005, 0.861965099, 0.862986399,
+    0.744653281, 0.744956058, 0.667509701, 0.804570766, 0.789292603, 0.653694391, 0.715084657, 0.681620495,
+    0.558987607, 0.532721362, 0.436415998, 0.593287581, 0.557153853, 0.400296598, 0.460402241, 0.412543671,
+    0.29193083, 0.234634715, 0.117706584, 0.295464572, 0.236958782, 0.058432728, 0.117019188, 0.0584342205,
+    0.724893065, 0.80124079, 0.832198668, 0.830540402, 0.888380337, 0.891422028, 0.918337454, 0.957740726,
+    0.906987462, 0.949714847, 0.949167273, 0.97353461, 0.993570141, 0.971523473, 0.993128128, 0.993573824,
+    0.949166205, 0.949723766, 0.906996753, 0.973534929, 0.957744213, 0.891420523, 0.918343575, 0.888388954,
+    0.832193459, 0.801237213, 0.724883103, 0.830531035, 0.794775858, 0.688277582, 0.728856373, 0.688277339,
+    0.608878779, 0.570072627, 0.471069795, 0.608873454, 0.557170493, 0.412545784, 0.460408678, 0.400302023,
+    0.29546522, 0.234637006, 0.117705815, 0.291910061, 0.232869012, 0.0592244463, 0.11712681, 0.0578632262,
+    0.999209791, 0.998552604, 0.999585869, 0.99892794, 0.996821751, 0.995518051, 0.997568944, 0.996262314,
+    0.998037004, 0.996728537, 0.998037004, 0.996728537, 0.992455332, 0.994117237, 0.994117237, 0.986702943,
+    0.98915568, 0.989977332, 0.98915568, 0.979452864, 0.982655371, 0.984268449, 0.984268449, 0.982655371,
+    0.970805028, 0.97470743, 0.977071582, 0.977863463, 0.977071582, 0.97470743, 0.960874337, 0.965419795,
+    0.968486185, 0.970030377, 0.970030377, 0.968486185, 0.965419795, 0.949786033, 0.954912687, 0.958625831,
+    0.960874617, 0.961627736, 0.960874617, 0.958625831, 0.954912687, 0.937671781, 0.943314684, 0.947614362,
+    0.950513694, 0.951973375, 0.951973375, 0.950513694, 0.947614362, 0.943314684, 0.924664034, 0.930756932,
+    0.935580027, 0.939071366, 0.941185024, 0.941892755, 0.941185024, 0.939071366, 0.935580027, 0.930756932,
+    0.917377399, 0.922659735, 0.92668192, 0.929392785, 0.930757169, 0.930757169, 0.929392785, 0.92668192,
+    0.922659735, 0.999585869, 0.99892794, 0.999209791, 0.998552604, 0.997568944, 0.996262314, 0.996821751,
+    0.995518051, 0.998271029, 0.997615692, 0.997148505, 0.996495374, 0.992455332, 0.994117053, 0.994116943,
+    0.986702943, 0.989156375, 0.989977848, 0.989156086, 0.979452864, 0.982655284, 0.984269047, 0.984268869,
+    0.982655682, 0.970805028, 0.974707277, 0.977071342, 0.977863895, 0.977071838, 0.974707581, 0.960874337,
+    0.965419579, 0.968485816, 0.970029923, 0.970030579, 0.968486216, 0.965419726, 0.949786033, 0.954912413,
+    0.958625342, 0.960873977, 0.961627015, 0.960874534, 0.958625584, 0.954912345, 0.937671781, 0.943314358,
+    0.947613763, 0.950512882, 0.951972417, 0.951972339, 0.950513279, 0.947613792, 0.943314028, 0.924664034,
+    0.930758532, 0.935581333, 0.939072425, 0.941185891, 0.941893485, 0.941185677, 0.939072608, 0.935581103,
+    0.930757901, 0.917377172, 0.922661062, 0.926682954, 0.929393576, 0.93075777, 0.930757637, 0.929393177,
+    0.92668288, 0.922660536, 0.999444717, 0.999444717, 0.998693304, 0.998693304, 0.99728833, 0.99728833,
+    0.995796878, 0.995796878, 0.997615692, 0.998271029, 0.996495374, 0.997148505, 0.992455004, 0.994116943,
+    0.994117053, 0.98670331, 0.989156086, 0.989977848, 0.989156375, 0.979453138, 0.982655682, 0.984268869,
+    0.984269047, 0.982655284, 0.970805143, 0.974707581, 0.977071838, 0.977863895, 0.977071342, 0.974707277,
+    0.960874236, 0.965419726, 0.968486216, 0.970030579, 0.970029923, 0.968485816, 0.965419579, 0.949785665,
+    0.954912345, 0.958625584, 0.960874534, 0.961627015, 0.960873977, 0.958625342, 0.954912413, 0.937671106,
+    0.943314028, 0.947613792, 0.950513279, 0.951972339, 0.951972417, 0.950512882, 0.947613763, 0.943314358,
+    0.924664955, 0.930757901, 0.935581103, 0.939072608, 0.941185677, 0.941893485, 0.941185891, 0.939072425,
+    0.935581333, 0.930758532, 0.922660536, 0.92668288, 0.929393177, 0.930757637, 0.93075777, 0.929393576,
+    0.926682954, 0.922661062, 0.917377172, 0.99892794, 0.999585869, 0.998552604, 0.999209791, 0.996262314,
+    0.997568944, 0.995518051, 0.996821751, 0.996728537, 0.998037004, 0.996728537, 0.998037004, 0.992455332,
+    0.994117237, 0.994117237, 0.986702943, 0.98915568, 0.989977332, 0.98915568, 0.979452864, 0.982655371,
+    0.984268449, 0.984268449, 0.982655371, 0.970805028, 0.97470743, 0.977071582, 0.977863463, 0.977071582,
+    0.97470743, 0.960874337, 0.965419795, 0.968486185, 0.970030377, 0.970030377, 0.968486185, 0.965419795,
+    0.949786033, 0.954912687, 0.958625831, 0.960874617, 0.961627736, 0.960874617, 0.958625831, 0.954912687,
+    0.937671781, 0.943314684, 0.947614362, 0.950513694, 0.951973375, 0.951973375, 0.950513694, 0.947614362,
+    0.943314684, 0.924664034, 0.930756932, 0.935580027, 0.939071366, 0.941185024, 0.941892755, 0.941185024,
+    0.939071366, 0.935580027, 0.930756932, 0.917377399, 0.922659735, 0.92668192, 0.929392785, 0.930757169,
+    0.930757169, 0.929392785, 0.92668192, 0.922659735, 0.998552604, 0.999209791, 0.99892794, 0.999585869,
+    0.995518051, 0.996821751, 0.996262314, 0.997568944, 0.996495374, 0.997148505, 0.997615692, 0.998271029,
+    0.992455332, 0.994117053, 0.994116943, 0.986702943, 0.989156375, 0.989977848, 0.989156086, 0.979452864,
+    0.982655284, 0.984269047, 0.984268869, 0.982655682, 0.970805028, 0.974707277, 0.977071342, 0.977863895,
+    0.977071838, 0.974707581, 0.960874337, 0.965419579, 0.968485816, 0.970029923, 0.970030579, 0.968486216,
+    0.965419726, 0.949786033, 0.954912413, 0.958625342, 0.960873977, 0.961627015, 0.960874534, 0.958625584,
+    0.954912345, 0.937671781, 0.943314358, 0.947613763, 0.950512882, 0.951972417, 0.951972339, 0.950513279,
+    0.947613792, 0.943314028, 0.924664034, 0.930758532, 0.935581333, 0.939072425, 0.941185891, 0.941893485,
+    0.941185677, 0.939072608, 0.935581103, 0.930757901, 0.917377172, 0.922661062, 0.926682954, 0.929393576,
+    0.93075777, 0.930757637, 0.929393177, 0.92668288, 0.922660536, 0.998693304, 0.998693304, 0.999444717,
+    0.999444717, 0.995796878, 0.995796878, 0.99728833, 0.99728833, 0.997148505, 0.996495374, 0.998271029,
+    0.997615692, 0.992455004, 0.994116943, 0.994117053, 0.98670331, 0.989156086, 0.989977848, 0.989156375,
+    0.979453138, 0.982655682, 0.984268869, 0.984269047, 0.982655284, 0.970805143, 0.974707581, 0.977071838,
+    0.977863895, 0.977071342, 0.974707277, 0.960874236, 0.965419726, 0.968486216, 0.970030579, 0.970029923,
+    0.968485816, 0.965419579, 0.949785665, 0.954912345, 0.958625584, 0.960874534, 0.961627015, 0.960873977,
+    0.958625342, 0.954912413, 0.937671106, 0.943314028, 0.947613792, 0.950513279, 0.951972339, 0.951972417,
+    0.950512882, 0.947613763, 0.943314358, 0.924664955, 0.930757901, 0.935581103, 0.939072608, 0.941185677,
+    0.941893485, 0.941185891, 0.939072425, 0.935581333, 0.930758532, 0.922660536, 0.92668288, 0.929393177,
+    0.930757637, 0.93075777, 0.929393576, 0.926682954, 0.922661062, 0.917377172,
+};
+
@@ -0,0 +1,81 @@
+#include "GEventArena.h"
+
+#include <stdlib.h>
+#include <iostream>
+
+using namespace std;
+
+
+GEventArena::GEventArena(const size_t initialSize)  :
+    block(0),
+    size(initialSize),
+    used(0),
+    overflow(0),
+    overflowUsed(0),
+    peak(0),
+    nAllocations(0),
+    nHeapAllocations(0)
+{
+    block   = AllocHeap(size);
+    nHeapAllocations++;
+}
+
+GEventArena::~GEventArena()
+{
+    while(overflow)
+    {
+        Char_t* previous    = *(Char_t**)overflow;
+        free(overflow);
+        overflow    = previous;
+    }
+    free(block);
+}
+
+Char_t* GEventArena::AllocHeap(const size_t bytes)
+{
+    Char_t* ptr = (Char_t*)malloc(bytes);
+    if(!ptr)
+    {
+        cout << "#ERROR: Event arena can not allocate " << bytes << " bytes!" << endl;
+        abort();
+    }
+    return ptr;
+}
+
+void*   GEventArena::AllocSlow(const size_t bytes, const size_t align)
+{
+    // every extra block starts with the pointer to the previous one
+    size_t  header  = (sizeof(Char_t*) + align - 1) & ~(align - 1);
+    Char_t* extra   = AllocHeap(header + bytes);
+    nHeapAllocations++;
+    *(Char_t**)extra    = overflow;
+    overflow        = extra;
+    overflowUsed    += bytes + align;
+    return extra + header;
+}
+
+void    GEventArena::Reset()
+{
+    size_t  demand  = used + overflowUsed;
+    if(demand > peak)
+        peak    = demand;
+
+    if(overflow)
+    {
+        while(overflow)
+        {
+            Char_t* previous    = *(Char_t**)overflow;
+            free(overflow);
+            overflow    = previous;
+        }
+
+        // replace the block by one that holds the largest event seen so far
+        while(size < peak)
+            size    *= 2;
+        free(block);
+        block   = AllocHeap(size);
+        nHeapAllocations++;
+    }
+    used            = 0;
+    overflowUsed    = 0;
+}
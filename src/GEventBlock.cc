@@ -0,0 +1,90 @@
+#include "GEventBlock.h"
+
+#include <cstring>
+
+
+GEventBlock::GEventBlock()  :
+    nEvents(0),
+    nTracks(0)
+{
+    ReserveEvents(64);
+    ReserveTracks(256);
+    offset[0]   = 0;
+}
+
+void    GEventBlock::ReserveEvents(const Int_t n)
+{
+    if(n < offset.GetCapacity())
+        return;
+    Int_t   grown   = offset.GetCapacity() > 0 ? offset.GetCapacity() : 64;
+    while(grown <= n)
+        grown   *= 2;
+    entry.Reserve(grown);
+    offset.Reserve(grown);
+    energySum.Reserve(grown);
+}
+
+void    GEventBlock::ReserveTracks(const Int_t n)
+{
+    if(n <= flags.GetCapacity())
+        return;
+    Int_t   grown   = flags.GetCapacity() > 0 ? flags.GetCapacity() : 256;
+    while(grown < n)
+        grown   *= 2;
+    detectors.Reserve(grown);
+    time.Reserve(grown);
+    vetoEnergy.Reserve(grown);
+    MWPC0Energy.Reserve(grown);
+    MWPC1Energy.Reserve(grown);
+    flags.Reserve(grown);
+}
+
+void    GEventBlock::AddEvent(const UInt_t _Entry, const GTreeTrack& tracks, const Double_t _EnergySum)
+{
+    const Int_t n   = tracks.GetNTracks();
+    ReserveEvents(nEvents + 1);
+    ReserveTracks(nTracks + n);
+
+    entry[nEvents]      = _Entry;
+    energySum[nEvents]  = _EnergySum;
+    offset[nEvents]     = nTracks;
+    memcpy(detectors + nTracks,   tracks.GetDetectors(),    n*sizeof(Int_t));
+    memcpy(time + nTracks,        tracks.GetTime(),         n*sizeof(GTreeReal));
+    memcpy(vetoEnergy + nTracks,  tracks.GetVetoEnergy(),   n*sizeof(GTreeReal));
+    memcpy(MWPC0Energy + nTracks, tracks.GetMWPC0Energy(),  n*sizeof(GTreeReal));
+    memcpy(MWPC1Energy + nTracks, tracks.GetMWPC1Energy(),  n*sizeof(GTreeReal));
+    nTracks += n;
+    nEvents++;
+    offset[nEvents]     = nTracks;
+}
+
+void    GEventBlock::Compact(const Bool_t* keep)
+{
+    Int_t   event   = 0;
+    Int_t   track   = 0;
+    for(Int_t e=0; e<nEvents; e++)
+    {
+        if(!keep[e])
+            continue;
+
+        Int_t   first   = offset[e];
+        Int_t   n       = offset[e+1] - first;
+        if(track != first)
+        {
+            memmove(detectors + track,   detectors + first,   n*sizeof(Int_t));
+            memmove(time + track,        time + first,        n*sizeof(GTreeReal));
+            memmove(vetoEnergy + track,  vetoEnergy + first,  n*sizeof(GTreeReal));
+            memmove(MWPC0Energy + track, MWPC0Energy + first, n*sizeof(GTreeReal));
+            memmove(MWPC1Energy + track, MWPC1Energy + first, n*sizeof(GTreeReal));
+            memmove(flags + track,       flags + first,       n*sizeof(Int_t));
+        }
+        entry[event]        = entry[e];
+        energySum[event]    = energySum[e];
+        offset[event]       = track;
+        track   += n;
+        event++;
+    }
+    nEvents     = event;
+    nTracks     = track;
+    offset[nEvents] = nTracks;
+}
@@ -0,0 +1,526 @@
+#include "GFileMerger.h"
+
+#include <iostream>
+#include <map>
+#include <set>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include <TFile.h>
+#include <TKey.h>
+#include <TTree.h>
+#include <TH1.h>
+#include <TMath.h>
+
+#include "GHistScaCor.h"
+#include "GHistBGSub.h"
+
+using namespace std;
+
+
+GFileMerger::GFileMerger(const Int_t NWorkers, const Int_t FanIn)  :
+    nWorkers(NWorkers),
+    fanIn(FanIn),
+    force(kFALSE)
+{
+    if(nWorkers<1)
+        nWorkers    = 1;
+    if(fanIn<2)
+        fanIn       = 2;
+}
+
+GFileMerger::~GFileMerger()
+{
+}
+
+Bool_t  GFileMerger::CheckScalerContinuity(const std::vector<std::string>& inputs)
+{
+    Bool_t  ok          = kTRUE;
+    Int_t   lastEvent   = -1;
+    for(size_t f=0; f<inputs.size(); f++)
+    {
+        TFile*  file    = TFile::Open(inputs[f].c_str());
+        if(!file)
+        {
+            cout << "#ERROR: Can not open input file " << inputs[f] << "!" << endl;
+            return kFALSE;
+        }
+        TTree*  scalers = 0;
+        file->GetObject("scalers", scalers);
+        if(scalers)
+        {
+            Int_t   eventNumber = 0;
+            scalers->SetBranchStatus("*", 0);
+            scalers->SetBranchStatus("eventNumber", 1);
+            scalers->SetBranchAddress("eventNumber", &eventNumber);
+            for(Long64_t i=0; i<scalers->GetEntries(); i++)
+            {
+                scalers->GetEntry(i);
+                if(eventNumber<=lastEvent)
+                {
+                    if(i==0)
+                        cout << "#ERROR: Scaler reads of " << inputs[f] << " start at event " << eventNumber << ", but the previous input ends at event " << lastEvent << "!" << endl;
+                    else
+                        cout << "#ERROR: Scaler read " << i << " of " << inputs[f] << " is not after the previous one!" << endl;
+                    ok  = kFALSE;
+                    break;
+                }
+                lastEvent   = eventNumber;
+            }
+        }
+        file->Close();
+        delete file;
+    }
+    if(!ok)
+        cout << "Inputs are from different runs, overlap or are not in order. The merged trees can not be traversed by scaler reads." << endl;
+    return ok;
+}
+
+Bool_t  GFileMerger::MergeSingleScalerReads(const std::vector<TDirectory*>& inputs, TDirectory* output)
+{
+    // every input adds its own scaler reads, so the folders are renumbered and appended
+    Int_t   offset  = 0;
+    TString prefix(GHSC_singleScalerReadFolderName);
+    for(size_t f=0; f<inputs.size(); f++)
+    {
+        Int_t   nReads  = 0;
+        TIter   next(inputs[f]->GetListOfKeys());
+        TKey*   key;
+        while((key=(TKey*)next()))
+        {
+            TString name(key->GetName());
+            if(!name.BeginsWith(prefix))
+                continue;
+            Int_t   index   = TString(name(prefix.Length(), name.Length()-prefix.Length())).Atoi();
+            if(index+1>nReads)
+                nReads  = index+1;
+
+            TDirectory* in  = inputs[f]->GetDirectory(name.Data());
+            TDirectory* out = output->mkdir(TString(prefix).Append(TString::Itoa(offset+index, 10)).Data());
+            if(!in || !out)
+                return kFALSE;
+            TIter   nextHist(in->GetListOfKeys());
+            TKey*   histKey;
+            while((histKey=(TKey*)nextHist()))
+            {
+                TH1*    hist    = dynamic_cast<TH1*>(histKey->ReadObj());
+                if(!hist)
+                    continue;
+                TString histName(hist->GetName());
+                TString indexString = TString::Itoa(index, 10);
+                if(histName.EndsWith(indexString))
+                    histName.Replace(histName.Length()-indexString.Length(), indexString.Length(), TString::Itoa(offset+index, 10));
+                out->cd();
+                hist->SetDirectory(0);
+                hist->Write(histName.Data());
+                delete hist;
+            }
+        }
+        offset  += nReads;
+    }
+    return kTRUE;
+}
+
+Bool_t  GFileMerger::MergeDirectory(const std::vector<TDirectory*>& inputs, TDirectory* output)
+{
+    // names of all keys in input order, every name only once (highest cycle)
+    std::vector<std::string>    names;
+    std::set<std::string>       known;
+    for(size_t f=0; f<inputs.size(); f++)
+    {
+        TIter   next(inputs[f]->GetListOfKeys());
+        TKey*   key;
+        while((key=(TKey*)next()))
+        {
+            if(known.insert(key->GetName()).second)
+                names.push_back(key->GetName());
+        }
+    }
+
+    Bool_t  ok              = kTRUE;
+    Bool_t  hasScalerReads  = kFALSE;
+    for(size_t n=0; n<names.size(); n++)
+    {
+        const char* name    = names[n].c_str();
+        if(TString(name).BeginsWith(GHSC_singleScalerReadFolderName))
+        {
+            hasScalerReads  = kTRUE;
+            continue;
+        }
+
+        TObject*    first   = 0;
+        for(size_t f=0; f<inputs.size() && !first; f++)
+            first   = inputs[f]->Get(name);
+        if(!first)
+            continue;
+
+        if(first->InheritsFrom("TDirectory"))
+        {
+            std::vector<TDirectory*>    subInputs;
+            for(size_t f=0; f<inputs.size(); f++)
+            {
+                TDirectory* sub = inputs[f]->GetDirectory(name);
+                if(sub)
+                    subInputs.push_back(sub);
+            }
+            TDirectory* subOutput   = output->mkdir(name);
+            if(!subOutput || !MergeDirectory(subInputs, subOutput))
+                ok  = kFALSE;
+        }
+        else if(first->InheritsFrom("TTree"))
+        {
+            output->cd();
+            TTree*  merged  = ((TTree*)first)->CloneTree(-1, "fast");
+            Bool_t  seen    = kFALSE;
+            for(size_t f=0; f<inputs.size(); f++)
+            {
+                TTree*  tree    = 0;
+                inputs[f]->GetObject(name, tree);
+                if(!tree)
+                    continue;
+                if(!seen)
+                {
+                    seen    = kTRUE;
+                    continue;
+                }
+                merged->CopyEntries(tree, -1, "fast");
+            }
+            merged->Write();
+            delete merged;
+        }
+        else if(first->InheritsFrom("TH1"))
+        {
+            output->cd();
+            TH1*    merged  = (TH1*)first->Clone();
+            merged->SetDirectory(0);
+            Bool_t  seen    = kFALSE;
+            for(size_t f=0; f<inputs.size(); f++)
+            {
+                TH1*    hist    = (TH1*)inputs[f]->Get(name);
+                if(!hist)
+                    continue;
+                if(!seen)
+                {
+                    seen    = kTRUE;
+                    continue;
+                }
+                merged->Add(hist);
+            }
+            merged->Write(name);
+            delete merged;
+        }
+        else
+        {
+            // flags and other objects are written once
+            if(strcmp(name, "Sampling_Fraction") == 0)
+            {
+                for(size_t f=0; f<inputs.size(); f++)
+                {
+                    TNamed* flag    = (TNamed*)inputs[f]->Get(name);
+                    if(!flag || strcmp(flag->GetTitle(), first->GetTitle()) != 0)
+                        cout << "#WARNING: Inputs were sampled with different fractions. Sampling_Fraction of the first input is kept." << endl;
+                }
+            }
+            output->cd();
+            first->Write(name);
+        }
+    }
+
+    if(hasScalerReads && !MergeSingleScalerReads(inputs, output))
+        ok  = kFALSE;
+
+    return ok;
+}
+
+static  Int_t   GetNCells(const TH1* hist)
+{
+    Int_t   n   = hist->GetNbinsX()+2;
+    if(hist->GetDimension()>1)  n   *= hist->GetNbinsY()+2;
+    if(hist->GetDimension()>2)  n   *= hist->GetNbinsZ()+2;
+    return n;
+}
+
+// prompt and random window of a background subtracted histogram, the random sum for several windows
+static  Bool_t  GetWindows(TDirectory* dir, const TString& name, const TString& suffix, TH1*& prompt, TH1*& rand)
+{
+    prompt  = dynamic_cast<TH1*>(dir->Get(TString(name).Append(GHBS_promptNameSuffix).Append(suffix).Data()));
+    rand    = dynamic_cast<TH1*>(dir->Get(TString(name).Append(GHBS_randSumNameSuffix).Append(suffix).Data()));
+    if(!rand)
+        rand    = dynamic_cast<TH1*>(dir->Get(TString(name).Append(GHBS_randNameSuffix).Append(suffix).Data()));
+    return (prompt && rand && GetNCells(prompt)==GetNCells(rand));
+}
+
+Bool_t  GFileMerger::GetSubtractionFactor(const TH1* result, const TH1* prompt, const TH1* rand, Double_t& factor, Bool_t& defined)
+{
+    if(GetNCells(result)!=GetNCells(prompt))
+        return kFALSE;
+
+    // result = prompt - factor * rand, least squares over all bins
+    Double_t    num = 0;
+    Double_t    den = 0;
+    for(Int_t b=0; b<GetNCells(rand); b++)
+    {
+        num += (prompt->GetBinContent(b) - result->GetBinContent(b)) * rand->GetBinContent(b);
+        den += rand->GetBinContent(b) * rand->GetBinContent(b);
+    }
+    defined = (den>0);
+    factor  = defined ? num/den : 0;
+
+    Double_t    maxDiff = 0;
+    Double_t    maxVal  = 0;
+    for(Int_t b=0; b<GetNCells(rand); b++)
+    {
+        maxDiff = TMath::Max(maxDiff, TMath::Abs(prompt->GetBinContent(b) - factor*rand->GetBinContent(b) - result->GetBinContent(b)));
+        maxVal  = TMath::Max(maxVal, TMath::Abs(result->GetBinContent(b)));
+    }
+    return (maxDiff <= 1e-6*TMath::Max(maxVal, 1.0));
+}
+
+Bool_t  GFileMerger::RebuildResult(TDirectory* output, const TString& name, TH1* prompt, TH1* rand, const Double_t factor)
+{
+    TH1*    result  = dynamic_cast<TH1*>(output->Get(name.Data()));
+    if(!result)
+        return kFALSE;
+
+    // same as GHistBGSub::CalcResult on the merged windows
+    TH1*    rebuilt = (TH1*)prompt->Clone();
+    rebuilt->SetDirectory(0);
+    rebuilt->SetNameTitle(result->GetName(), result->GetTitle());
+    rebuilt->Add(rand, -factor);
+    output->cd();
+    Bool_t  ok  = (rebuilt->Write(name.Data(), TObject::kOverwrite) > 0);
+    delete rebuilt;
+    return ok;
+}
+
+Bool_t  GFileMerger::RebuildBackgroundSubtraction(const std::vector<TDirectory*>& inputs, TDirectory* output)
+{
+    Bool_t      ok          = kTRUE;
+    TDirectory* bgSub       = output->GetDirectory(GHBS_folderName);
+    TDirectory* scaCor      = output->GetDirectory(GHSC_folderName);
+    TDirectory* bgSubScaCor = bgSub ? bgSub->GetDirectory(GHSC_folderName) : 0;
+
+    // the results are overwritten below, so the key list is copied first
+    std::vector<TString>    names;
+    TIter   next(output->GetListOfKeys());
+    TKey*   key;
+    while((key=(TKey*)next()))
+        names.push_back(key->GetName());
+
+    for(size_t n=0; n<names.size() && bgSub; n++)
+    {
+        const TString&  name    = names[n];
+        TH1*    prompt;
+        TH1*    rand;
+        if(!GetWindows(bgSub, name, "", prompt, rand) || !dynamic_cast<TH1*>(output->Get(name.Data())))
+            continue;
+
+        // every input has to subtract with the same factor and nothing else may be in its result
+        Double_t    factor  = 0;
+        Bool_t      found   = kFALSE;
+        for(size_t f=0; f<inputs.size(); f++)
+        {
+            TDirectory* inBGSub = inputs[f]->GetDirectory(GHBS_folderName);
+            TH1*        inResult    = dynamic_cast<TH1*>(inputs[f]->Get(name.Data()));
+            TH1*        inPrompt;
+            TH1*        inRand;
+            if(!inBGSub || !inResult || !GetWindows(inBGSub, name, "", inPrompt, inRand))
+                continue;
+            Double_t    inFactor;
+            Bool_t      defined;
+            if(!GetSubtractionFactor(inResult, inPrompt, inRand, inFactor, defined))
+            {
+                cout << "#ERROR: " << name << " of " << inputs[f]->GetFile()->GetName() << " is not prompt - factor * random. Direct fills can not be merged." << endl;
+                ok  = kFALSE;
+                break;
+            }
+            if(!defined)
+                continue;
+            if(found && TMath::Abs(inFactor - factor) > 1e-6*TMath::Abs(factor))
+            {
+                cout << "#ERROR: " << name << " of " << inputs[f]->GetFile()->GetName() << " was subtracted with factor " << inFactor << " instead of " << factor << ". Inputs used different windows." << endl;
+                ok  = kFALSE;
+                break;
+            }
+            factor  = inFactor;
+            found   = kTRUE;
+        }
+        if(!ok)
+            break;
+
+        // the corrected and the uncorrected accumulation are both linear in the windows
+        if(!RebuildResult(output, name, prompt, rand, factor))
+            ok  = kFALSE;
+        TString noScaCor    = TString(name).Append(GHSC_accumulatedNameSuffix);
+        if(scaCor && bgSubScaCor && scaCor->Get(noScaCor.Data()) && GetWindows(bgSubScaCor, name, GHSC_accumulatedNameSuffix, prompt, rand))
+        {
+            if(!RebuildResult(scaCor, noScaCor, prompt, rand, factor))
+                ok  = kFALSE;
+        }
+    }
+
+    // histograms in sub folders of the analysis
+    for(size_t n=0; n<names.size() && ok; n++)
+    {
+        if(names[n]==GHBS_folderName || names[n]==GHSC_folderName)
+            continue;
+        TDirectory* sub = output->GetDirectory(names[n].Data());
+        if(!sub)
+            continue;
+        std::vector<TDirectory*>    subInputs;
+        for(size_t f=0; f<inputs.size(); f++)
+        {
+            TDirectory* inSub   = inputs[f]->GetDirectory(names[n].Data());
+            if(inSub)
+                subInputs.push_back(inSub);
+        }
+        ok  = RebuildBackgroundSubtraction(subInputs, sub);
+    }
+    return ok;
+}
+
+Bool_t  GFileMerger::MergeGroup(const std::vector<std::string>& inputs, const std::string& output)
+{
+    std::vector<TFile*>         files;
+    std::vector<TDirectory*>    dirs;
+    Bool_t  ok  = kTRUE;
+    for(size_t f=0; f<inputs.size(); f++)
+    {
+        TFile*  file    = TFile::Open(inputs[f].c_str());
+        if(!file || file->IsZombie())
+        {
+            cout << "#ERROR: Can not open input file " << inputs[f] << "!" << endl;
+            ok  = kFALSE;
+            break;
+        }
+        files.push_back(file);
+        dirs.push_back(file);
+    }
+
+    TFile*  out = 0;
+    if(ok)
+    {
+        out = TFile::Open(output.c_str(), "RECREATE");
+        if(!out)
+        {
+            cout << "#ERROR: Can not create output file " << output << "!" << endl;
+            ok  = kFALSE;
+        }
+    }
+    if(ok)
+    {
+        ok  = MergeDirectory(dirs, out);
+        if(ok)
+            ok  = RebuildBackgroundSubtraction(dirs, out);
+        out->Close();
+        delete out;
+        // an inconsistent output is not kept
+        if(!ok)
+            unlink(output.c_str());
+    }
+
+    for(size_t f=0; f<files.size(); f++)
+    {
+        files[f]->Close();
+        delete files[f];
+    }
+    return ok;
+}
+
+Bool_t  GFileMerger::Merge(const std::vector<std::string>& inputs, const std::string& output)
+{
+    if(inputs.empty())
+    {
+        cout << "#ERROR: No input files given!" << endl;
+        return kFALSE;
+    }
+    if(!CheckScalerContinuity(inputs) && !force)
+    {
+        cout << "#ERROR: Scaler reads are not continuous. Use --force to merge anyway." << endl;
+        return kFALSE;
+    }
+
+    std::vector<std::string>    current = inputs;
+    std::vector<std::string>    temporary;
+    Int_t   round   = 0;
+    Bool_t  ok      = kTRUE;
+    while(ok)
+    {
+        Bool_t  final   = ((Int_t)current.size() <= fanIn);
+        Int_t   nGroups = (current.size() + fanIn - 1)/fanIn;
+        std::vector<std::string>    next;
+        std::vector<std::string>    created;
+        std::map<Int_t, Int_t>      running;
+        cout << "Merge round " << round << ": " << current.size() << " files in " << nGroups << " groups." << endl;
+
+        for(Int_t g=0; g<nGroups && ok; g++)
+        {
+            std::vector<std::string>    group(current.begin() + g*fanIn, current.begin() + TMath::Min((Int_t)current.size(), (g+1)*fanIn));
+            if(group.size()==1 && !final)
+            {
+                next.push_back(group[0]);
+                continue;
+            }
+            std::string target  = output;
+            if(!final)
+            {
+                target  = output + ".merge" + std::to_string((long long)round) + "_" + std::to_string((long long)g) + ".root";
+                created.push_back(target);
+            }
+            next.push_back(target);
+
+            // the files of every group are merged by a separate process
+            while((Int_t)running.size() >= nWorkers)
+            {
+                Int_t   status;
+                Int_t   pid = waitpid(-1, &status, 0);
+                if(pid<0)
+                    break;
+                if(!WIFEXITED(status) || WEXITSTATUS(status)!=0)
+                    ok  = kFALSE;
+                running.erase(pid);
+            }
+            if(!ok)
+                break;
+
+            Int_t   pid = fork();
+            if(pid == 0)
+                _exit(MergeGroup(group, target) ? 0 : 1);
+            if(pid<0)
+            {
+                ok  = MergeGroup(group, target);
+                continue;
+            }
+            running[pid]    = g;
+        }
+        while(!running.empty())
+        {
+            Int_t   status;
+            Int_t   pid = waitpid(-1, &status, 0);
+            if(pid<0)
+                break;
+            if(!WIFEXITED(status) || WEXITSTATUS(status)!=0)
+                ok  = kFALSE;
+            running.erase(pid);
+        }
+
+        // intermediate files of the previous round are not needed anymore
+        for(size_t t=0; t<temporary.size(); t++)
+            unlink(temporary[t].c_str());
+        temporary.clear();
+        temporary   = created;
+        if(final)
+            break;
+        current = next;
+        round++;
+    }
+
+    for(size_t t=0; t<temporary.size(); t++)
+        unlink(temporary[t].c_str());
+    if(!ok)
+        cout << "#ERROR: Merging into " << output << " failed!" << endl;
+    else
+        cout << "Merged " << inputs.size() << " files into " << output << endl;
+    return ok;
+}
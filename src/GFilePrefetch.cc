@@ -0,0 +1,81 @@
+#include "GFilePrefetch.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+using namespace std;
+
+
+GFilePrefetch::GFilePrefetch(const Long64_t head, const Long64_t tail)  :
+    fileName(),
+    worker(),
+    cancel(false),
+    headSize(head),
+    tailSize(tail),
+    nBytesRead(0)
+{
+}
+
+GFilePrefetch::~GFilePrefetch()
+{
+    Stop();
+}
+
+void    GFilePrefetch::Start(const char* name)
+{
+    Stop();
+
+    // remote files are left to the ROOT read-ahead
+    if(strstr(name, "://"))
+        return;
+
+    fileName    = name;
+    nBytesRead  = 0;
+    cancel      = false;
+    worker      = std::thread(&GFilePrefetch::Run, this);
+}
+
+void    GFilePrefetch::Stop()
+{
+    cancel  = true;
+    Wait();
+}
+
+void    GFilePrefetch::Wait()
+{
+    if(worker.joinable())
+        worker.join();
+}
+
+void    GFilePrefetch::Run()
+{
+    FILE*   file    = fopen(fileName.c_str(), "rb");
+    if(!file)
+        return;
+
+    fseeko(file, 0, SEEK_END);
+    Long64_t    size    = ftello(file);
+
+    // the key list and streamer info are at the end of a ROOT file
+    Long64_t    tailStart   = size - tailSize;
+    if(tailStart<headSize)
+        tailStart   = headSize;
+
+    std::vector<char>   buffer(1024*1024);
+    Long64_t    ranges[2][2]    = {{0, headSize<size ? headSize : size}, {tailStart, size}};
+    for(Int_t r=0; r<2; r++)
+    {
+        fseeko(file, ranges[r][0], SEEK_SET);
+        Long64_t    pos = ranges[r][0];
+        while(pos<ranges[r][1] && !cancel)
+        {
+            size_t  n   = fread(&buffer[0], 1, buffer.size(), file);
+            if(n==0)
+                break;
+            pos         += n;
+            nBytesRead  += n;
+        }
+    }
+    fclose(file);
+}
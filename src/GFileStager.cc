@@ -0,0 +1,249 @@
+#include "GFileStager.h"
+
+#include <iostream>
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+using namespace std;
+
+
+GFileStager::GFileStager(const std::string& stagingDirectory)  :
+    directory(stagingDirectory),
+    stageIn(),
+    stageOut()
+{
+    if(directory.length()>0 && directory.find_last_of("/") != (directory.length()-1))
+        directory += "/";
+}
+
+GFileStager::~GFileStager()
+{
+    WaitAll();
+    for(size_t i=0; i<stageIn.size(); i++)
+    {
+        unlink(stageIn[i]->destination.c_str());
+        delete stageIn[i];
+    }
+}
+
+UInt_t  GFileStager::Adler32(UInt_t adler, const char* buffer, const size_t length)
+{
+    // the modulo is only needed every 5552 bytes (as in zlib)
+    UInt_t  a   = adler & 0xffff;
+    UInt_t  b   = (adler >> 16) & 0xffff;
+    size_t  i   = 0;
+    while(i<length)
+    {
+        size_t  end = i + 5552;
+        if(end>length)
+            end = length;
+        for(; i<end; i++)
+        {
+            a   += (unsigned char)buffer[i];
+            b   += a;
+        }
+        a   %= 65521;
+        b   %= 65521;
+    }
+    return (b << 16) | a;
+}
+
+Bool_t  GFileStager::Copy(const std::string& source, const std::string& destination, UInt_t& checksum)
+{
+    FILE*   in  = fopen(source.c_str(), "rb");
+    if(!in)
+        return kFALSE;
+    FILE*   out = fopen(destination.c_str(), "wb");
+    if(!out)
+    {
+        fclose(in);
+        return kFALSE;
+    }
+
+    std::vector<char>   buffer(4*1024*1024);
+    Bool_t  ok  = kTRUE;
+    checksum    = 1;
+    size_t  n;
+    while((n = fread(&buffer[0], 1, buffer.size(), in)) > 0)
+    {
+        checksum    = Adler32(checksum, &buffer[0], n);
+        if(fwrite(&buffer[0], 1, n, out) != n)
+        {
+            ok  = kFALSE;
+            break;
+        }
+    }
+    if(ferror(in))
+        ok  = kFALSE;
+    fclose(in);
+    if(fflush(out)!=0 || fsync(fileno(out))!=0)
+        ok  = kFALSE;
+    if(fclose(out)!=0)
+        ok  = kFALSE;
+    return ok;
+}
+
+Bool_t  GFileStager::Checksum(const std::string& fileName, UInt_t& checksum)
+{
+    FILE*   in  = fopen(fileName.c_str(), "rb");
+    if(!in)
+        return kFALSE;
+
+    // the pages were just written and fsync'ed, so they are clean and can be dropped:
+    // the file is then read back from the storage instead of from the page cache
+    posix_fadvise(fileno(in), 0, 0, POSIX_FADV_DONTNEED);
+
+    std::vector<char>   buffer(4*1024*1024);
+    checksum    = 1;
+    size_t  n;
+    while((n = fread(&buffer[0], 1, buffer.size(), in)) > 0)
+        checksum    = Adler32(checksum, &buffer[0], n);
+    Bool_t  ok  = !ferror(in);
+    fclose(in);
+    return ok;
+}
+
+Long64_t    GFileStager::GetSize(const std::string& fileName)
+{
+    struct stat info;
+    if(stat(fileName.c_str(), &info) != 0)
+        return -1;
+    return info.st_size;
+}
+
+std::string GFileStager::GetLocalName(const std::string& fileName)    const
+{
+    std::string::size_type  pos = fileName.find_last_of("/");
+    if(pos == std::string::npos)
+        return directory + fileName;
+    return directory + fileName.substr(pos+1);
+}
+
+void    GFileStager::RunStageIn(Job* job)
+{
+    std::string temporary   = job->destination + ".part";
+    job->success    = Copy(job->source, temporary, job->checksum);
+    if(job->success)
+        job->success    = (rename(temporary.c_str(), job->destination.c_str()) == 0);
+    if(!job->success)
+        unlink(temporary.c_str());
+}
+
+void    GFileStager::RunStageOut(Job* job)
+{
+    // copy to a temporary name on the destination file system, verify, then rename atomically
+    std::string temporary   = job->destination + ".part";
+    UInt_t      verify      = 0;
+    job->success    = Copy(job->source, temporary, job->checksum);
+    if(job->success)
+        job->success    = (GetSize(temporary) == GetSize(job->source));
+    if(job->success)
+        job->success    = Checksum(temporary, verify) && (verify == job->checksum);
+    if(job->success)
+        job->success    = (rename(temporary.c_str(), job->destination.c_str()) == 0);
+
+    std::lock_guard<std::mutex> lock(logMutex);
+    if(job->success)
+    {
+        FILE*   sum = fopen((job->destination + ".adler32").c_str(), "w");
+        if(sum)
+        {
+            fprintf(sum, "%08x  %s\n", job->checksum, job->destination.c_str());
+            fclose(sum);
+        }
+        unlink(job->source.c_str());
+        cout << "Staged out " << job->destination << " (adler32 " << hex << job->checksum << dec << ")" << endl;
+    }
+    else
+    {
+        unlink(temporary.c_str());
+        cout << "#ERROR: Could not stage out " << job->source << " to " << job->destination << ". Local copy is kept." << endl;
+    }
+}
+
+void    GFileStager::StageIn(const std::string& fileName)
+{
+    for(size_t i=0; i<stageIn.size(); i++)
+    {
+        if(stageIn[i]->source == fileName)
+            return;
+    }
+
+    // prefixed, so a staged input never collides with a local output of the same name
+    std::string::size_type  pos = fileName.find_last_of("/");
+    Job*    job         = new Job();
+    job->source         = fileName;
+    job->destination    = directory + "staged_" + (pos == std::string::npos ? fileName : fileName.substr(pos+1));
+    job->success        = kFALSE;
+    job->checksum       = 0;
+    job->worker         = std::thread(&GFileStager::RunStageIn, this, job);
+    stageIn.push_back(job);
+}
+
+std::string GFileStager::WaitStageIn(const std::string& fileName)
+{
+    for(size_t i=0; i<stageIn.size(); i++)
+    {
+        if(stageIn[i]->source != fileName)
+            continue;
+        if(stageIn[i]->worker.joinable())
+            stageIn[i]->worker.join();
+        if(stageIn[i]->success)
+            return stageIn[i]->destination;
+        cout << "#ERROR: Could not stage in " << fileName << ". Reading it in place." << endl;
+        return fileName;
+    }
+    return fileName;
+}
+
+void    GFileStager::RemoveStagedIn(const std::string& fileName)
+{
+    for(size_t i=0; i<stageIn.size(); i++)
+    {
+        if(stageIn[i]->source != fileName)
+            continue;
+        if(stageIn[i]->worker.joinable())
+            stageIn[i]->worker.join();
+        unlink(stageIn[i]->destination.c_str());
+        delete stageIn[i];
+        stageIn.erase(stageIn.begin()+i);
+        return;
+    }
+}
+
+Bool_t  GFileStager::StageOut(const std::string& localName, const std::string& fileName)
+{
+    if(localName == fileName)
+        return kTRUE;
+
+    Job*    job         = new Job();
+    job->source         = localName;
+    job->destination    = fileName;
+    job->success        = kFALSE;
+    job->checksum       = 0;
+    job->worker         = std::thread(&GFileStager::RunStageOut, this, job);
+    stageOut.push_back(job);
+    return kTRUE;
+}
+
+Bool_t  GFileStager::WaitAll()
+{
+    Bool_t  ok  = kTRUE;
+    for(size_t i=0; i<stageIn.size(); i++)
+    {
+        if(stageIn[i]->worker.joinable())
+            stageIn[i]->worker.join();
+    }
+    for(size_t i=0; i<stageOut.size(); i++)
+    {
+        if(stageOut[i]->worker.joinable())
+            stageOut[i]->worker.join();
+        if(!stageOut[i]->success)
+            ok  = kFALSE;
+        delete stageOut[i];
+    }
+    stageOut.clear();
+    return ok;
+}
@@ -35,6 +35,14 @@ void GHistManager::ClearLinkedHistograms()
         hist->Reset();
 }
 
+void GHistManager::ScaleLinkedHistograms(const Double_t factor)
+{
+    TIter   iter(&histList);
+    GHistLinked*    hist;
+    while(hist=(GHistLinked*)iter.Next())
+        hist->Scale(factor);
+}
+
 void GHistManager::WriteLinkedHistograms(TDirectory* dir)
 {
     std::cout << "Calc Result -->";
@@ -0,0 +1,136 @@
+#include "GMesonAssignment.h"
+
+#include <stdlib.h>
+
+
+GMesonAssignment::GMesonAssignment()    :
+    memo(0),
+    generation(0),
+    compact(0),
+    compactCapacity(0)
+{
+    memo    = (Memo*)calloc(1 << MAX_PARTICLES, sizeof(Memo));
+}
+
+GMesonAssignment::~GMesonAssignment()
+{
+    free(memo);
+    free(compact);
+}
+
+const GMesonAssignment::Memo&   GMesonAssignment::Solve(const UInt_t open)
+{
+    Memo&   m   = memo[open];
+    if(m.generation == generation)
+        return m;
+
+    const Int_t     i       = __builtin_ctz(open);
+    const UInt_t    others  = open & ~(1u << i);
+
+    // lowest particle unpaired
+    const Memo& skip    = others ? Solve(others) : memo[0];
+    Double_t    chi2    = skip.chi2;
+    Int_t       nPairs  = skip.nPairs;
+    Int_t       choice  = -1;
+
+    // or with one of its partners
+    for(Int_t e=0; e<nEdges[i]; e++)
+    {
+        const UInt_t    bit = 1u << edgePartner[i][e];
+        if(!(others & bit))  continue;
+        const Memo&     rest    = Solve(others & ~bit);
+        const Int_t     n       = rest.nPairs + 1;
+        const Double_t  c       = rest.chi2 + edgeChi2[i][e];
+        if(n > nPairs || (n == nPairs && c < chi2))
+        {
+            nPairs  = n;
+            chi2    = c;
+            choice  = e;
+        }
+    }
+
+    m.chi2          = chi2;
+    m.nPairs        = nPairs;
+    m.choice        = choice;
+    m.generation    = generation;
+    return m;
+}
+
+Bool_t  GMesonAssignment::Run(const Int_t nParticles, const Int_t nCandidates, const Int_t* first, const Int_t* second, const Double_t* diff, Bool_t* chosen)
+{
+    for(Int_t c=0; c<nCandidates; c++)
+        chosen[c]   = kFALSE;
+
+    if(nParticles > compactCapacity)
+    {
+        free(compact);
+        compactCapacity = nParticles;
+        compact = (Int_t*)malloc(compactCapacity*sizeof(Int_t));
+    }
+    for(Int_t i=0; i<nParticles; i++)
+        compact[i]  = -1;
+
+    Int_t   n   = 0;
+    for(Int_t c=0; c<nCandidates; c++)
+    {
+        if(compact[first[c]] < 0)
+        {
+            if(n == MAX_PARTICLES)  return kFALSE;
+            nEdges[n]   = 0;
+            compact[first[c]]   = n++;
+        }
+        if(compact[second[c]] < 0)
+        {
+            if(n == MAX_PARTICLES)  return kFALSE;
+            nEdges[n]   = 0;
+            compact[second[c]]  = n++;
+        }
+    }
+    if(n == 0)
+        return kTRUE;
+
+    // every candidate is an edge of its lower particle
+    for(Int_t c=0; c<nCandidates; c++)
+    {
+        Int_t   a   = compact[first[c]];
+        Int_t   b   = compact[second[c]];
+        if(b < a)
+        {
+            Int_t   t   = a;
+            a   = b;
+            b   = t;
+        }
+        edgePartner[a][nEdges[a]]   = b;
+        edgeCandidate[a][nEdges[a]] = c;
+        edgeChi2[a][nEdges[a]]      = diff[c]*diff[c];
+        nEdges[a]++;
+    }
+
+    // new generation, the empty set is the only valid entry
+    generation++;
+    if(generation == 0)
+    {
+        for(Int_t m=0; m<(1 << MAX_PARTICLES); m++)
+            memo[m].generation  = 0;
+        generation  = 1;
+    }
+    memo[0].chi2        = 0;
+    memo[0].nPairs      = 0;
+    memo[0].choice      = -1;
+    memo[0].generation  = generation;
+
+    UInt_t  open    = (1u << n) - 1;
+    Solve(open);
+    while(open)
+    {
+        const Int_t i   = __builtin_ctz(open);
+        const Memo& m   = memo[open];
+        open    &= ~(1u << i);
+        if(m.choice >= 0)
+        {
+            chosen[edgeCandidate[i][m.choice]]  = kTRUE;
+            open    &= ~(1u << edgePartner[i][m.choice]);
+        }
+    }
+    return kTRUE;
+}
@@ -0,0 +1,278 @@
+#include "GMesonFit.h"
+#include "GKinematics.h"
+
+#include <TMath.h>
+
+
+// 4-vector of a photon from energy, theta and phi
+static  inline  GP4     FitPhoton(const Double_t* y)
+{
+    const Double_t  st  = sin(y[1]);
+    return GP4(y[0]*st*cos(y[2]), y[0]*st*sin(y[2]), y[0]*cos(y[1]), y[0]);
+}
+
+// the same with its derivatives by energy, theta and phi
+static  inline  GP4     FitPhoton(const Double_t* y, GP4* d)
+{
+    const Double_t  st  = sin(y[1]);
+    const Double_t  ct  = cos(y[1]);
+    const Double_t  sp  = sin(y[2]);
+    const Double_t  cp  = cos(y[2]);
+    d[0]    = GP4(st*cp, st*sp, ct, 1);
+    d[1]    = GP4(y[0]*ct*cp, y[0]*ct*sp, -y[0]*st, 0);
+    d[2]    = GP4(-y[0]*st*sp, y[0]*st*cp, 0, 0);
+    return GP4(y[0]*st*cp, y[0]*st*sp, y[0]*ct, y[0]);
+}
+
+// d(M^2)/dy = 2 (E dE - p dp)
+static  inline  Double_t    FitMass2Derivative(const GP4& p, const GP4& d)
+{
+    return 2*(p.e*d.e - p.px*d.px - p.py*d.py - p.pz*d.pz);
+}
+
+// one meson of two photons: f = M^2 - m^2
+struct  GMesonFitMass
+{
+    Double_t    mass2;
+
+    void    operator()(const Double_t* y, const Double_t*, Double_t* f)    const
+    {
+        f[0]    = (FitPhoton(y) + FitPhoton(y + 3)).M2() - mass2;
+    }
+    void    Jacobian(const Double_t* y, const Double_t*, Double_t* D, Double_t*)    const
+    {
+        GP4         d[6];
+        const GP4   meson   = FitPhoton(y, d) + FitPhoton(y + 3, d + 3);
+        for(Int_t i=0; i<6; i++)
+            D[i]    = FitMass2Derivative(meson, d[i]);
+    }
+};
+
+// beam + target -> K mesons of two photons + recoil, the beam energy is
+// the last measured variable and x the recoil momentum
+template<Int_t K>
+struct  GMesonFitEvent
+{
+    enum
+    {
+        NM  = 6*K + 1,
+        NU  = 3
+    };
+
+    Double_t    mass2[K];
+    Double_t    target;
+
+    void    operator()(const Double_t* y, const Double_t* x, Double_t* f)    const
+    {
+        GP4     sum;
+        for(Int_t k=0; k<K; k++)
+        {
+            const GP4   meson   = FitPhoton(y + 6*k) + FitPhoton(y + 6*k + 3);
+            f[4+k]  = meson.M2() - mass2[k];
+            sum     += meson;
+        }
+        const Double_t  beam    = y[6*K];
+        const Double_t  recoilE = sqrt(x[0]*x[0] + x[1]*x[1] + x[2]*x[2] + target*target);
+        f[0]    = - sum.px - x[0];
+        f[1]    = - sum.py - x[1];
+        f[2]    = beam - sum.pz - x[2];
+        f[3]    = beam + target - sum.e - recoilE;
+    }
+    void    Jacobian(const Double_t* y, const Double_t* x, Double_t* D, Double_t* E)    const
+    {
+        for(Int_t i=0; i<(4+K)*NM; i++)
+            D[i]    = 0;
+        for(Int_t i=0; i<(4+K)*NU; i++)
+            E[i]    = 0;
+
+        for(Int_t k=0; k<K; k++)
+        {
+            GP4         d[6];
+            const GP4   meson   = FitPhoton(y + 6*k, d) + FitPhoton(y + 6*k + 3, d + 3);
+            for(Int_t i=0; i<6; i++)
+            {
+                const Int_t j   = 6*k + i;
+                D[0*NM + j]     = -d[i].px;
+                D[1*NM + j]     = -d[i].py;
+                D[2*NM + j]     = -d[i].pz;
+                D[3*NM + j]     = -d[i].e;
+                D[(4+k)*NM + j] = FitMass2Derivative(meson, d[i]);
+            }
+        }
+        D[2*NM + 6*K]   = 1;
+        D[3*NM + 6*K]   = 1;
+
+        const Double_t  recoilE = sqrt(x[0]*x[0] + x[1]*x[1] + x[2]*x[2] + target*target);
+        for(Int_t u=0; u<NU; u++)
+        {
+            E[u*NU + u]     = -1;
+            E[3*NU + u]     = -x[u]/recoilE;
+        }
+    }
+};
+
+
+GMesonFit::GMesonFit(const Double_t _TargetMass, const Double_t _BeamResolution)    :
+    targetMass(_TargetMass),
+    beamResolution(_BeamResolution)
+{
+}
+
+void    GMesonFit::Resolution(const Double_t energy, const Double_t theta, const Bool_t taps, Double_t* sigma)
+{
+    const Double_t  e       = energy > 1 ? energy/1000 : 0.001;
+    const Double_t  st      = TMath::Max(sin(theta), 0.05);
+    if(taps)
+    {
+        sigma[0]    = energy*(0.018 + 0.008/sqrt(e));
+        sigma[1]    = 1.0*TMath::DegToRad();
+        sigma[2]    = 1.0*TMath::DegToRad()/st;
+    }
+    else
+    {
+        sigma[0]    = energy*0.02*pow(e, -0.36);
+        sigma[1]    = 2.5*TMath::DegToRad();
+        sigma[2]    = 2.5*TMath::DegToRad()/st;
+    }
+}
+
+template<Int_t K>
+Int_t   GMesonFit::FitEvent(const Double_t* mass, const Double_t* measured, const Double_t* sigma, const Int_t nBeam, const Double_t* beamEnergy, Double_t& chi2, Double_t* pulls)
+{
+    GMesonFitEvent<K>   constraint;
+    constraint.target   = targetMass;
+    for(Int_t k=0; k<K; k++)
+        constraint.mass2[k] = mass[k]*mass[k];
+
+    // The recoil starts from the missing momentum at the mean beam energy.
+    // The constraints are linear in the beam energy, so the first step is
+    // shared by all beam energies.
+    Double_t    y[6*K + 1];
+    Double_t    s[6*K + 1];
+    GP4         sum;
+    for(Int_t i=0; i<6*K; i++)
+    {
+        y[i]    = measured[i];
+        s[i]    = sigma[i];
+    }
+    for(Int_t k=0; k<2*K; k++)
+        sum += FitPhoton(measured + 3*k);
+    y[6*K]  = 0;
+    for(Int_t t=0; t<nBeam; t++)
+        y[6*K]  += beamEnergy[t];
+    y[6*K]  /= nBeam;
+    s[6*K]  = beamResolution;
+    const Double_t  recoil[3]   = {-sum.px, -sum.py, y[6*K] - sum.pz};
+
+    chi2    = -1;
+    GKinFit<6*K + 1, 3, 4+K>    fit;
+    if(!fit.Start(constraint, y, s, recoil))
+        return -1;
+
+    Int_t   best    = -1;
+    for(Int_t t=0; t<nBeam; t++)
+    {
+        fit.SetMeasured(6*K, beamEnergy[t]);
+        if(!fit.Fit(constraint))    continue;
+        if(best >= 0 && fit.GetChi2() >= chi2)  continue;
+        chi2    = fit.GetChi2();
+        best    = t;
+        if(pulls)
+        {
+            for(Int_t i=0; i<6*K + 1; i++)
+                pulls[i]    = fit.GetPull(i);
+        }
+    }
+    return best;
+}
+
+Int_t   GMesonFit::FitEvent(const Int_t nMesons, const Double_t* mass, const Double_t* measured, const Double_t* sigma, const Int_t nBeam, const Double_t* beamEnergy, Double_t& chi2, Double_t* pulls)
+{
+    chi2    = -1;
+    if(nBeam <= 0)
+        return -1;
+    switch(nMesons)
+    {
+    case 1: return FitEvent<1>(mass, measured, sigma, nBeam, beamEnergy, chi2, pulls);
+    case 2: return FitEvent<2>(mass, measured, sigma, nBeam, beamEnergy, chi2, pulls);
+    case 3: return FitEvent<3>(mass, measured, sigma, nBeam, beamEnergy, chi2, pulls);
+    }
+    return -1;
+}
+
+Bool_t  GMesonFit::FitMeson(const Double_t mass, const Double_t* measured, const Double_t* sigma)
+{
+    GMesonFitMass   constraint;
+    constraint.mass2    = mass*mass;
+    return mesonFit.Start(constraint, measured, sigma, 0) && mesonFit.Fit(constraint);
+}
+
+// The pulls of a meson are stored in the order of GetTrackIndexList, i.e.
+// sub particle 0 is the one with the lower track index.
+void    GMesonFit::Fit(GTreeTrack* tracks, GTreeTagger* tagger, const Int_t nTrees, GTreeMeson** trees, const Double_t* masses, const Bool_t exclusive)
+{
+    GTreeMeson* tree[MAX_MESONS];
+    Int_t       index[MAX_MESONS];
+    Double_t    mass[MAX_MESONS];
+    Double_t    measured[6*MAX_MESONS];
+    Double_t    sigma[6*MAX_MESONS];
+    Int_t       nMesons     = 0;
+    Bool_t      eventFit    = exclusive && tagger && tagger->GetNTagged() > 0;
+
+    Double_t    y[6];
+    Double_t    s[6];
+    Double_t    pulls[6];
+    for(Int_t t=0; t<nTrees; t++)
+    {
+        for(Int_t m=0; m<trees[t]->GetNMesons(); m++)
+        {
+            if(trees[t]->GetNSubParticles(m) != 2 || trees[t]->GetNSubChargedPi(m) != 0)
+            {
+                eventFit    = kFALSE;
+                continue;
+            }
+
+            Int_t   track[2];
+            trees[t]->GetTrackIndexList(m, track);
+            for(Int_t d=0; d<2; d++)
+            {
+                y[3*d]      = tracks->GetClusterEnergy(track[d]);
+                y[3*d+1]    = tracks->GetTheta(track[d])*TMath::DegToRad();
+                y[3*d+2]    = tracks->GetPhi(track[d])*TMath::DegToRad();
+                Resolution(y[3*d], y[3*d+1], tracks->HasTAPS(track[d]), s + 3*d);
+            }
+
+            if(FitMeson(masses[t], y, s))
+            {
+                for(Int_t i=0; i<6; i++)
+                    pulls[i]    = mesonFit.GetPull(i);
+                trees[t]->SetFit(m, mesonFit.GetChi2(), pulls);
+            }
+
+            if(nMesons == MAX_MESONS)
+            {
+                eventFit    = kFALSE;
+                continue;
+            }
+            tree[nMesons]   = trees[t];
+            index[nMesons]  = m;
+            mass[nMesons]   = masses[t];
+            for(Int_t i=0; i<6; i++)
+            {
+                measured[6*nMesons + i] = y[i];
+                sigma[6*nMesons + i]    = s[i];
+            }
+            nMesons++;
+        }
+    }
+
+    if(!eventFit || nMesons == 0)
+        return;
+    beam.resize(tagger->GetNTagged());
+    for(Int_t t=0; t<tagger->GetNTagged(); t++)
+        beam[t] = tagger->GetTaggedEnergy(t);
+    Double_t    chi2;
+    const Int_t best    = FitEvent(nMesons, mass, measured, sigma, tagger->GetNTagged(), &beam[0], chi2);
+    for(Int_t k=0; k<nMesons; k++)
+        tree[k]->SetEventFit(index[k], chi2, best);
+}
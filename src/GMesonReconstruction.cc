@@ -5,15 +5,26 @@ using namespace std;
 
 
 GMesonReconstruction::GMesonReconstruction()    :
+    massNeutralPion(pdgDB->GetParticle("pi0" )->Mass()*1000),
+    massEta(pdgDB->GetParticle("eta" )->Mass()*1000),
+    massEtaPrime(pdgDB->GetParticle("eta'")->Mass()*1000),
+    pdgPhoton(pdgDB->GetParticle("gamma")->PdgCode()),
+    pdgChargedPion(pdgDB->GetParticle("pi+")->PdgCode()),
     widthNeutralPion(0),
     widthEta(0),
-    widthEtaPrime(0)
+    widthEtaPrime(0),
+    crystalAngles(0),
+    usePartition(kFALSE),
+    assignment(0),
+    fitter(0)
 {
 }
 
 GMesonReconstruction::~GMesonReconstruction()
 {
-
+    if(crystalAngles) delete crystalAngles;
+    if(assignment) delete assignment;
+    if(fitter) delete fitter;
 }
 
 Bool_t GMesonReconstruction::Start()
@@ -73,12 +84,111 @@ Bool_t	GMesonReconstruction::Init()
         widthEtaPrime = DEFAULT_WIDTH_ETA_PRIME;
         cout << "Eta-Prime IM width cut set to default (" << widthEtaPrime << " MeV)" << endl;
     }
+
+    config = ReadConfig("Meson-Crystal-Angles");
+    Int_t   useCrystalAngles = 0;
+    if(sscanf( config.c_str(), "%d\n", &useCrystalAngles) == 1 && useCrystalAngles)
+    {
+        if(!crystalAngles) crystalAngles = new GCrystalAngleTable();
+        cout << "2 photon invariant masses use central crystal opening angles" << endl;
+    }
+
+    config = ReadConfig("Meson-Partition");
+    Int_t   partition = 0;
+    if(sscanf( config.c_str(), "%d\n", &partition) == 1 && partition)
+    {
+        usePartition = kTRUE;
+        cout << "events with 4, 6 or 8 photons are first split completely into 2 photon mesons" << endl;
+    }
+
+    config = ReadConfig("Meson-Exact-Pairing");
+    Int_t   exact = 0;
+    if(sscanf( config.c_str(), "%d\n", &exact) == 1 && exact)
+    {
+        if(!assignment) assignment = new GMesonAssignment();
+        cout << "2 particle mesons are chosen by the most mesons with the smallest total chi2" << endl;
+    }
+
+    config = ReadConfig("Meson-Kinematic-Fit");
+    Int_t   fit = 0;
+    if(sscanf( config.c_str(), "%d\n", &fit) == 1 && fit)
+    {
+        Double_t    targetMass = MASS_PROTON;
+        config = ReadConfig("Meson-Fit-Target-Mass");
+        if (strcmp(config.c_str(), "nokey") != 0 && (sscanf( config.c_str(), "%lf\n", &targetMass) != 1 || targetMass <= 0))
+        {
+            cout << "ERROR: Meson-Fit-Target-Mass set improperly" << endl;
+            return kFALSE;
+        }
+        if(fitter) delete fitter;
+        fitter = new GMesonFit(targetMass);
+        GetNeutralPions()->SetHasFit(kTRUE);
+        GetEtas()->SetHasFit(kTRUE);
+        GetEtaPrimes()->SetHasFit(kTRUE);
+        cout << "2 photon mesons are kinematically fitted, target mass " << targetMass << " MeV" << endl;
+    }
     cout << endl;
 
     return kTRUE;
 }
 
+// Window of every pair mass: type[p] is the meson with the smallest
+// distance in units of its width if that is <= 1 and strictly smaller
+// than the other two, MESON_NONE otherwise. Written with selects only, so
+// the loop vectorises.
+void    GMesonReconstruction::ClassifyPairs(const Int_t nPairs, const Double_t* __restrict__ mass, Int_t* __restrict__ type, Double_t* __restrict__ diff)  const
+{
+    for (Int_t p = 0; p < nPairs; p++)
+    {
+        const Double_t  diff_pi0  = TMath::Abs( mass[p] - massNeutralPion )/widthNeutralPion;
+        const Double_t  diff_eta  = TMath::Abs( mass[p] - massEta         )/widthEta;
+        const Double_t  diff_etap = TMath::Abs( mass[p] - massEtaPrime    )/widthEtaPrime;
+
+        const Int_t     isPi0   = (diff_pi0  <= 1.0) & (diff_pi0  < diff_eta) & (diff_pi0  < diff_etap);
+        const Int_t     isEta   = (diff_eta  <= 1.0) & (diff_eta  < diff_pi0) & (diff_eta  < diff_etap);
+        const Int_t     isEtaP  = (diff_etap <= 1.0) & (diff_etap < diff_pi0) & (diff_etap < diff_eta);
+
+        type[p] = isPi0*MESON_PI0 + isEta*MESON_ETA + isEtaP*MESON_ETA_PRIME;
+        diff[p] = isPi0 ? diff_pi0 : (isEta ? diff_eta : diff_etap);
+    }
+}
+
 Bool_t  GMesonReconstruction::ProcessEventWithoutFilling()
+{
+    if(!ReconstructMesons())    return kFALSE;
+    if(fitter)
+    {
+        GTreeMeson* trees[]     = {GetNeutralPions(), GetEtas(), GetEtaPrimes()};
+        Double_t    masses[]    = {massNeutralPion, massEta, massEtaPrime};
+        // nothing left besides the mesons but at most one recoil nucleon
+        Bool_t      exclusive   = GetRootinos()->GetNParticles() + GetPhotons()->GetNParticles() + GetChargedPions()->GetNParticles() + GetElectrons()->GetNParticles() == 0 &&
+                                  GetProtons()->GetNParticles() + GetNeutrons()->GetNParticles() <= 1;
+        fitter->Fit(GetTracks(), GetTagger()->IsOpenForInput() ? GetTagger() : 0, 3, trees, masses, exclusive);
+    }
+    return kTRUE;
+}
+
+// The pairs i<j of n particles that are in a meson window, in the order
+// of the pair loop and without branches. Returns their number.
+Int_t   GMesonReconstruction::CompactPairs(const Int_t n, const Int_t* pairType, const Double_t* pairDiff, Int_t* index1, Int_t* index2, Int_t* type, Double_t* diff)
+{
+    Int_t k = 0;
+    Int_t p = 0;
+    for (Int_t i = 0; i < n; i++)
+    {
+        for (Int_t j = i+1; j < n; j++, p++)
+        {
+            diff[k]     = pairDiff[p];
+            type[k]     = pairType[p];
+            index1[k]   = i;
+            index2[k]   = j;
+            k += pairType[p] != MESON_NONE;
+        }
+    }
+    return k;
+}
+
+Bool_t  GMesonReconstruction::ReconstructMesons()
 {
     GetNeutralPions()->Clear();
     GetEtas()->Clear();
@@ -86,21 +196,19 @@ Bool_t  GMesonReconstruction::ProcessEventWithoutFilling()
 
     Int_t       maxSubs = GetRootinos()->GetNParticles() + GetPhotons()->GetNParticles() + GetChargedPions()->GetNParticles();
 
-    Int_t		index1	  [maxSubs * maxSubs];
-    Int_t		index2	  [maxSubs * maxSubs];
-    Int_t 		tempID    [maxSubs * maxSubs];
-    Double_t 	diff_meson[maxSubs * maxSubs];
-    Int_t 		sort_index[maxSubs * maxSubs];
-    Bool_t 		is_meson  [maxSubs];
+    GEventArena&    arena   = GetEventArena();
+    Bool_t* 	is_meson  = arena.Alloc<Bool_t>(maxSubs);
 
     Int_t       countRootinos	= 0;
     Int_t       countPhotons	= 0;
     Int_t       countChargedPi	= 0;
 
 
-    TLorentzVector  daughter_list[maxSubs];
-    Int_t       	daughter_index[maxSubs];
-    Int_t       	pdg_list[maxSubs];
+    GP4*            daughter_p4   = arena.Alloc<GP4>(maxSubs);
+    Int_t*          daughter_crystal = arena.Alloc<Int_t>(maxSubs);
+    Double_t*       daughter_energy  = arena.Alloc<Double_t>(maxSubs);
+    Int_t*       	daughter_index= arena.Alloc<Int_t>(maxSubs);
+    Int_t*       	pdg_list      = arena.Alloc<Int_t>(maxSubs);
 
     // one list including only GetRootinos() and GetPhotons()
     Int_t 			ndaughter   = 0;
@@ -138,8 +246,10 @@ Bool_t  GMesonReconstruction::ProcessEventWithoutFilling()
 		
         is_meson[ndaughter] = kFALSE;
 
-        daughter_list[ ndaughter] = GetRootinos()->Particle(i);
+        daughter_p4[   ndaughter] = GP4(GetRootinos()->Particle(i));
         daughter_index[ndaughter] = i;
+        daughter_crystal[ndaughter] = GetRootinos()->GetMass(i) == 0 ? GetRootinos()->GetCrystal(i) : -1;
+        daughter_energy[ndaughter]  = GetRootinos()->GetClusterEnergy(i);
         pdg_list[ndaughter] 	  = PDG_ROOTINO;
 
         reaction_p4 	 += GetRootinos()->Particle(i);
@@ -161,9 +271,11 @@ Bool_t  GMesonReconstruction::ProcessEventWithoutFilling()
 
         is_meson[ndaughter] = kFALSE;
 
-        daughter_list[ ndaughter] = GetPhotons()->Particle(i);
+        daughter_p4[   ndaughter] = GP4(GetPhotons()->Particle(i));
         daughter_index[ndaughter] = i;
-        pdg_list[ndaughter] 	  = pdgDB->GetParticle("gamma")->PdgCode();;
+        daughter_crystal[ndaughter] = GetPhotons()->GetMass(i) == 0 ? GetPhotons()->GetCrystal(i) : -1;
+        daughter_energy[ndaughter]  = GetPhotons()->GetClusterEnergy(i);
+        pdg_list[ndaughter] 	  = pdgPhoton;
 
         reaction_p4 	 += GetPhotons()->Particle(i);
         reaction_p4_full += GetPhotons()->Particle(i);
@@ -185,9 +297,9 @@ Bool_t  GMesonReconstruction::ProcessEventWithoutFilling()
 
         is_meson[ndaughter_full] = kFALSE;
 
-        daughter_list[ ndaughter_full] = GetChargedPions()->Particle(i);
+        daughter_p4[   ndaughter_full] = GP4(GetChargedPions()->Particle(i));
         daughter_index[ndaughter_full] = i;
-        pdg_list[ndaughter_full] 	   = pdgDB->GetParticle("pi+")->PdgCode();;
+        pdg_list[ndaughter_full] 	   = pdgChargedPion;
 
         reaction_p4_full += GetChargedPions()->Particle(i);
         ndaughter_full++;
@@ -196,14 +308,14 @@ Bool_t  GMesonReconstruction::ProcessEventWithoutFilling()
 
     }
 
-    Double_t diff_pi0  = TMath::Abs( reaction_p4.M() 	  - (pdgDB->GetParticle("pi0" )->Mass()*1000) )/widthNeutralPion;
-    Double_t diff_eta  = TMath::Abs( reaction_p4_full.M() - (pdgDB->GetParticle("eta" )->Mass()*1000) )/widthEta;
-    Double_t diff_etap = TMath::Abs( reaction_p4_full.M() - (pdgDB->GetParticle("eta'")->Mass()*1000) )/widthEtaPrime;
+    Double_t diff_pi0  = TMath::Abs( reaction_p4.M() 	  - massNeutralPion )/widthNeutralPion;
+    Double_t diff_eta  = TMath::Abs( reaction_p4_full.M() - massEta )/widthEta;
+    Double_t diff_etap = TMath::Abs( reaction_p4_full.M() - massEtaPrime )/widthEtaPrime;
 
     if ((diff_pi0 <= 1.0) && (diff_pi0 < diff_eta) && (diff_pi0 < diff_etap) && (ndaughter >= 2))
     {
 		// Add pi0 (charged pion list not included)
-        GetNeutralPions()->AddParticle(countRootinos, countPhotons, 0, daughter_index, daughter_list);
+        GetNeutralPions()->AddParticle(countRootinos, countPhotons, 0, daughter_index, daughter_p4);
 						
         // Remove GetRootinos() and GetPhotons() from original particle list
         GetRootinos()->RemoveParticles(countRootinos, daughter_index);
@@ -215,7 +327,7 @@ Bool_t  GMesonReconstruction::ProcessEventWithoutFilling()
     else if ((diff_eta <= 1.0) && (diff_eta < diff_pi0) && (diff_eta < diff_etap) && (ndaughter_full >= 2))
     {
         // Add eta 
-        GetEtas()->AddParticle(countRootinos, countPhotons, countChargedPi, daughter_index, daughter_list);
+        GetEtas()->AddParticle(countRootinos, countPhotons, countChargedPi, daughter_index, daughter_p4);
 
 		// Remove daughters from original particle list
         GetRootinos()->RemoveParticles(countRootinos, daughter_index);
@@ -228,7 +340,7 @@ Bool_t  GMesonReconstruction::ProcessEventWithoutFilling()
     else if ((diff_etap <= 1.0) && (diff_etap < diff_pi0) && (diff_etap < diff_eta) && (ndaughter_full >= 2))
     {
         // Add eta prime
-        GetEtaPrimes()->AddParticle(countRootinos, countPhotons, countChargedPi, daughter_index, daughter_list);
+        GetEtaPrimes()->AddParticle(countRootinos, countPhotons, countChargedPi, daughter_index, daughter_p4);
 
 		// Remove daughters from original particle list
         GetRootinos()->RemoveParticles(countRootinos, daughter_index);
@@ -247,170 +359,110 @@ Bool_t  GMesonReconstruction::ProcessEventWithoutFilling()
     // Use only GetPhotons() and GetRootinos()
     // Don't double count in sorting!
 
-    Int_t k = 0;
-    for (Int_t i = 0; i < ndaughter; i++)
+    // All pair masses in one flat array, then their windows in one pass.
+    // Candidates keep the order of the i<j loop, so the sort below and with
+    // it the pairing do not change.
+    Int_t       nPairs      = ndaughter*(ndaughter-1)/2;
+    Double_t*   pair_mass   = arena.Alloc<Double_t>(nPairs);
+    Double_t*   pair_diff   = arena.Alloc<Double_t>(nPairs);
+    Int_t*      pair_type   = arena.Alloc<Int_t>(nPairs);
+    Int_t*		index1	    = arena.Alloc<Int_t>(nPairs);
+    Int_t*		index2	    = arena.Alloc<Int_t>(nPairs);
+    Int_t* 		tempID      = arena.Alloc<Int_t>(nPairs);
+    Double_t* 	diff_meson  = arena.Alloc<Double_t>(nPairs);
+    Int_t* 		sort_index  = arena.Alloc<Int_t>(nPairs);
+
+    if(crystalAngles)
+        crystalAngles->PairMasses(ndaughter, daughter_crystal, daughter_energy, daughter_p4, pair_mass);
+    else
+        GKinematics::PairMasses(ndaughter, daughter_p4, pair_mass);
+    ClassifyPairs(nPairs, pair_mass, pair_type, pair_diff);
+
+    // Optionally try first to split all particles into 2 particle mesons
+    // at once (3 pi0 -> 6g, pi0 eta -> 4g, ...) with the smallest sum of
+    // the squared distances to the meson masses.
+    if(usePartition && GMesonPartitionSearch::IsSupported(ndaughter))
     {
-        for (Int_t j = i+1; j < ndaughter; j++)
+        Double_t*   chi2    = arena.Alloc<Double_t>(ndaughter*ndaughter);
+        Int_t*      partner = arena.Alloc<Int_t>(ndaughter);
+        Int_t       p       = 0;
+        for (Int_t i = 0; i < ndaughter; i++)
         {
-            TLorentzVector p4 = daughter_list[i] + daughter_list[j];
-
-            Double_t diff_pi0  = TMath::Abs( p4.M() - (pdgDB->GetParticle("pi0" )->Mass()*1000) )/widthNeutralPion;
-            Double_t diff_eta  = TMath::Abs( p4.M() - (pdgDB->GetParticle("eta" )->Mass()*1000) )/widthEta;
-            Double_t diff_etap = TMath::Abs( p4.M() - (pdgDB->GetParticle("eta'")->Mass()*1000) )/widthEtaPrime;
-
-            if ((diff_pi0 <= 1.0) && (diff_pi0 < diff_eta) && (diff_pi0 < diff_etap))
-            {
-                diff_meson[k] 	= diff_pi0;
-                tempID[k] 		= pdgDB->GetParticle("pi0")->PdgCode();
-                index1[k]		= i;
-                index2[k]		= j;
-                k++;
-            }
-            else if ((diff_eta <= 1.0) && (diff_eta < diff_pi0) && (diff_eta < diff_etap))
+            for (Int_t j = i+1; j < ndaughter; j++, p++)
             {
-                diff_meson[k]	= diff_eta;
-                tempID[k] 		= pdgDB->GetParticle("eta")->PdgCode();
-                index1[k]		= i;
-                index2[k]		= j;
-                k++;
+                chi2[i*ndaughter + j]   = pair_type[p] == MESON_NONE ? std::numeric_limits<Double_t>::infinity() : pair_diff[p]*pair_diff[p];
+                chi2[j*ndaughter + i]   = chi2[i*ndaughter + j];
             }
-            else if ((diff_etap <= 1.0) && (diff_etap < diff_pi0) && (diff_etap < diff_eta))
+        }
+
+        if(GMesonPartitionSearch::Find(ndaughter, chi2, partner) < std::numeric_limits<Double_t>::infinity())
+        {
+            GTreeMeson* mesons[] = {0, GetNeutralPions(), GetEtas(), GetEtaPrimes()};
+            for (Int_t i = 0; i < ndaughter; i++)
             {
-                diff_meson[k]	= diff_etap;
-                tempID[k] 		= pdgDB->GetParticle("eta'")->PdgCode();
-                index1[k]		= i;
-                index2[k]		= j;
-                k++;
+                const Int_t j   = partner[i];
+                if(j < i)   continue;
+                const Int_t type    = pair_type[i*ndaughter - i*(i+1)/2 + j-i-1];
+                mesons[type]->AddParticle(daughter_index[i], daughter_p4[i], pdg_list[i], daughter_index[j], daughter_p4[j], pdg_list[j]);
             }
+
+            GetRootinos()->RemoveParticles(countRootinos, daughter_index);
+            GetPhotons()->RemoveParticles(countPhotons, &daughter_index[countRootinos]);
+            return kTRUE;
         }
     }
 
+    Int_t k = CompactPairs(ndaughter, pair_type, pair_diff, index1, index2, tempID, diff_meson);
+
     TMath::Sort(k, diff_meson, sort_index, kFALSE);
 
     Int_t		nIndex_rootino_delete    = 0;
     Int_t		nIndex_photon_delete    = 0;
- //   Int_t		nIndex_chargedPion_delete = 0;
-    Int_t		index_rootino_delete[GTreeTrack_MAX];
-    Int_t		index_photon_delete[GTreeTrack_MAX];
-  //  Int_t		index_chargedPion_delete[GTreeParticle_MaxEntries];
+    Int_t*		index_rootino_delete = arena.Alloc<Int_t>(countRootinos);
+    Int_t*		index_photon_delete  = arena.Alloc<Int_t>(countPhotons);
+
+    // exact mode: only the candidates of the best assignment are taken,
+    // greedily if there are too many particles for it
+    Bool_t*     chosen  = 0;
+    if(assignment)
+    {
+        chosen  = arena.Alloc<Bool_t>(k);
+        if(!assignment->Run(ndaughter, k, index1, index2, diff_meson, chosen))
+            chosen  = 0;
+    }
+
+    GTreeMeson* mesons[] = {0, GetNeutralPions(), GetEtas(), GetEtaPrimes()};
 
     for (Int_t i = 0; i < k; i++)
     {
+        if(chosen && !chosen[sort_index[i]])    continue;
+
+        const Int_t first   = index1[sort_index[i]];
+        const Int_t second  = index2[sort_index[i]];
+
         //particle pair already involved in a meson reconstruction?
-        if(is_meson[index1[sort_index[i]]] == kTRUE)  continue;
-        if(is_meson[index2[sort_index[i]]] == kTRUE)  continue;
+        if(is_meson[first] == kTRUE)  continue;
+        if(is_meson[second] == kTRUE)  continue;
 
         // New meson identified!
-        is_meson[index1[sort_index[i]]] = kTRUE;
-        is_meson[index2[sort_index[i]]] = kTRUE;
+        is_meson[first]  = kTRUE;
+        is_meson[second] = kTRUE;
 
         // Add to particle list
-        if(tempID[sort_index[i]] == pdgDB->GetParticle("pi0")->PdgCode())
-        {
-            GetNeutralPions()->AddParticle(daughter_index[index1[sort_index[i]]], daughter_list[index1[sort_index[i]]], pdg_list[index1[sort_index[i]]], daughter_index[index2[sort_index[i]]], daughter_list[index2[sort_index[i]]], pdg_list[index2[sort_index[i]]]);
-            if(index1[sort_index[i]] < countRootinos)
-            {
-                index_rootino_delete[nIndex_rootino_delete] = daughter_index[index1[sort_index[i]]];
-                nIndex_rootino_delete++;
-            }
-            else if(index1[sort_index[i]] < (countRootinos+countPhotons))
-            {
-                index_photon_delete[nIndex_photon_delete] = daughter_index[index1[sort_index[i]]];
-                nIndex_photon_delete++;
-            }
- /*           else
-            {
-                index_chargedPion_delete[nIndex_chargedPion_delete] = daughter_index[index1[sort_index[i]]];
-                nIndex_chargedPion_delete++;
-            }*/
-            if(index2[sort_index[i]] < countRootinos)
-            {
-                index_rootino_delete[nIndex_rootino_delete] = daughter_index[index2[sort_index[i]]];
-                nIndex_rootino_delete++;
-            }
-            else if(index2[sort_index[i]] < (countRootinos+countPhotons))
-            {
-                index_photon_delete[nIndex_photon_delete] = daughter_index[index2[sort_index[i]]];
-                nIndex_photon_delete++;
-            }
-/*            else
-            {
-                index_chargedPion_delete[nIndex_chargedPion_delete] = daughter_index[index2[sort_index[i]]];
-                nIndex_chargedPion_delete++;
-            }*/
-        }
-        else if(tempID[sort_index[i]] == pdgDB->GetParticle("eta")->PdgCode())
-        {
-            GetEtas()->AddParticle(daughter_index[index1[sort_index[i]]], daughter_list[index1[sort_index[i]]], pdg_list[index1[sort_index[i]]], daughter_index[index2[sort_index[i]]], daughter_list[index2[sort_index[i]]], pdg_list[index2[sort_index[i]]]);
-            if(index1[sort_index[i]] < countRootinos)
-            {
-                index_rootino_delete[nIndex_rootino_delete] = daughter_index[index1[sort_index[i]]];
-                nIndex_rootino_delete++;
-            }
-            else if(index1[sort_index[i]] < (countRootinos+countPhotons))
-            {
-                index_photon_delete[nIndex_photon_delete] = daughter_index[index1[sort_index[i]]];
-                nIndex_photon_delete++;
-            }
-/*          else
-            {
-                index_chargedPion_delete[nIndex_chargedPion_delete] = daughter_index[index1[sort_index[i]]];
-                nIndex_chargedPion_delete++;
-            }*/
-            if(index2[sort_index[i]] < countRootinos)
-            {
-                index_rootino_delete[nIndex_rootino_delete] = daughter_index[index2[sort_index[i]]];
-                nIndex_rootino_delete++;
-            }
-            else if(index2[sort_index[i]] < (countRootinos+countPhotons))
-            {
-                index_photon_delete[nIndex_photon_delete] = daughter_index[index2[sort_index[i]]];
-                nIndex_photon_delete++;
-            }
-/*            else
-            {
-                index_chargedPion_delete[nIndex_chargedPion_delete] = daughter_index[index2[sort_index[i]]];
-                nIndex_chargedPion_delete++;
-            }*/
-        }
-        else if(tempID[sort_index[i]] == pdgDB->GetParticle("eta'")->PdgCode())
-        {
-            GetEtaPrimes()->AddParticle(daughter_index[index1[sort_index[i]]], daughter_list[index1[sort_index[i]]], pdg_list[index1[sort_index[i]]], daughter_index[index2[sort_index[i]]], daughter_list[index2[sort_index[i]]], pdg_list[index2[sort_index[i]]]);
-            if(index1[sort_index[i]] < countRootinos)
-            {
-                index_rootino_delete[nIndex_rootino_delete] = daughter_index[index1[sort_index[i]]];
-                nIndex_rootino_delete++;
-            }
-            else if(index1[sort_index[i]] < (countRootinos+countPhotons))
-            {
-                index_photon_delete[nIndex_photon_delete] = daughter_index[index1[sort_index[i]]];
-                nIndex_photon_delete++;
-            }
- /*           else
-            {
-                index_chargedPion_delete[nIndex_chargedPion_delete] = daughter_index[index1[sort_index[i]]];
-                nIndex_chargedPion_delete++;
-            }*/
-            if(index2[sort_index[i]] < countRootinos)
-            {
-                index_rootino_delete[nIndex_rootino_delete] = daughter_index[index2[sort_index[i]]];
-                nIndex_rootino_delete++;
-            }
-            else if(index2[sort_index[i]] < (countRootinos+countPhotons))
-            {
-                index_photon_delete[nIndex_photon_delete] = daughter_index[index2[sort_index[i]]];
-                nIndex_photon_delete++;
-            }
-/*            else
-            {
-                index_chargedPion_delete[nIndex_chargedPion_delete] = daughter_index[index2[sort_index[i]]];
-                nIndex_chargedPion_delete++;
-            }*/
-        }
+        mesons[tempID[sort_index[i]]]->AddParticle(daughter_index[first], daughter_p4[first], pdg_list[first], daughter_index[second], daughter_p4[second], pdg_list[second]);
+
+        // charged pions are not paired, so both are rootinos or photons
+        if(first < countRootinos)
+            index_rootino_delete[nIndex_rootino_delete++] = daughter_index[first];
+        else if(first < (countRootinos+countPhotons))
+            index_photon_delete[nIndex_photon_delete++] = daughter_index[first];
+        if(second < countRootinos)
+            index_rootino_delete[nIndex_rootino_delete++] = daughter_index[second];
+        else if(second < (countRootinos+countPhotons))
+            index_photon_delete[nIndex_photon_delete++] = daughter_index[second];
     }
     GetRootinos()->RemoveParticles(nIndex_rootino_delete, index_rootino_delete);
     GetPhotons()->RemoveParticles(nIndex_photon_delete, index_photon_delete);
-//    GetChargedPions()->RemoveParticles(nIndex_chargedPion_delete, index_chargedPion_delete);
 
 
     return kTRUE;
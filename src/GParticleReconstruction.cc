@@ -4,9 +4,8 @@
 using namespace std;
 
 GParticleReconstruction::GParticleReconstruction() :
-    identified(new Int_t[GTreeTrack_MAX]),
-    charge(new Int_t[GTreeTrack_MAX]),
-    hadron(new Int_t[GTreeTrack_MAX]),
+    typeCB(ReconstructNone),
+    typeTAPS(ReconstructNone),
     doScalerCorrection(kFALSE),
     doTrigger(kFALSE),
     energySum(50),
@@ -22,10 +21,16 @@ GParticleReconstruction::GParticleReconstruction() :
     timeCutCB[1] = 1000000.0;
     timeCutTAPS[0] = -1000000.0;
     timeCutTAPS[1] = 1000000.0;
+    for(Int_t s=0; s<SpeciesCount; s++)
+        speciesMass[s]  = 0;
+    Compile(programCB, ReconstructNone, kTRUE);
+    Compile(programTAPS, ReconstructNone, kFALSE);
 }
 
 GParticleReconstruction::~GParticleReconstruction()
 {
+    Release(programCB);
+    Release(programTAPS);
 }
 
 Bool_t GParticleReconstruction::Trigger()
@@ -325,188 +330,204 @@ Bool_t	GParticleReconstruction::Init()
             return kFALSE;
         }
     }
-	
+
+    Compile(programCB, typeCB, kTRUE);
+    Compile(programTAPS, typeTAPS, kFALSE);
+
+    speciesMass[SpeciesRootino]     = 0;
+    speciesMass[SpeciesPhoton]      = 0;
+    speciesMass[SpeciesProton]      = pdgDB->GetParticle("proton")->Mass()*1000;
+    speciesMass[SpeciesChargedPion] = pdgDB->GetParticle("pi+")->Mass()*1000;
+    speciesMass[SpeciesElectron]    = pdgDB->GetParticle("e-")->Mass()*1000;
+    speciesMass[SpeciesNeutron]     = pdgDB->GetParticle("neutron")->Mass()*1000;
+
 	return kTRUE;
 }
 
-Bool_t	GParticleReconstruction::ProcessEventWithoutFilling()
+void    GParticleReconstruction::Compile(RuleProgram& program, const ReconstructType type, const Bool_t cb)
 {
-    if(doTrigger)
-    {
-        if(!Trigger())
-            return kFALSE;
-    }
+    Release(program);
+    program.fixed   = -1;
+    if(type & ReconstructAllPhotons)        program.fixed   = SpeciesPhoton;
+    else if(type & ReconstructAllProtons)   program.fixed   = SpeciesProton;
 
-    GetRootinos()->Clear();
-    GetPhotons()->Clear();
-    GetElectrons()->Clear();
-    GetChargedPions()->Clear();
-    GetProtons()->Clear();
-    GetNeutrons()->Clear();
+    program.timeFlag    = cb ? FlagTimeCB : FlagTimeTAPS;
+    program.chargeFlag  = cb ? FlagChargeCB : FlagChargeTAPS;
 
-    for(Int_t i=0; i<GetTracks()->GetNTracks(); i++)
+    program.nHadronCuts = 0;
+    if(type & ReconstructTimeOfFlight)
     {
-        if(GetTracks()->HasCB(i))
-        {
-            if(GetTracks()->GetTime(i)<timeCutCB[0] || GetTracks()->GetTime(i)>timeCutCB[1])
-                return kFALSE;
-
-            identified[i] = PDG_ROOTINO;
-            charge[i] = 0;
-            hadron[i] = 0;
-
-            if(typeCB & ReconstructAllPhotons)
-            {
-                identified[i] = pdgDB->GetParticle("gamma")->PdgCode();
-                continue;
-            }
-
-            if(typeCB & ReconstructAllProtons)
-            {
-                identified[i] = pdgDB->GetParticle("proton")->PdgCode();
-                continue;
-            }
+        program.hadronCut[program.nHadronCuts]          = new GCutRaster(cb ? cutTimeOfFlightCB : cutTimeOfFlightTAPS);
+        program.hadronClusterSize[program.nHadronCuts]  = kFALSE;
+        program.nHadronCuts++;
+    }
+    if(type & ReconstructClusterSize)
+    {
+        program.hadronCut[program.nHadronCuts]          = new GCutRaster(cb ? cutClusterSizeCB : cutClusterSizeTAPS);
+        program.hadronClusterSize[program.nHadronCuts]  = kTRUE;
+        program.nHadronCuts++;
+    }
 
+    // a later dE-E cut overrides an earlier one, so test them in reverse
+    program.nSpeciesCuts    = 0;
+    if(type & ReconstructCutElectron)
+    {
+        program.speciesCut[program.nSpeciesCuts]    = new GCutRaster(cb ? cutElectronCB : cutElectronTAPS);
+        program.species[program.nSpeciesCuts]       = SpeciesElectron;
+        program.nSpeciesCuts++;
+    }
+    if(type & ReconstructCutPion)
+    {
+        program.speciesCut[program.nSpeciesCuts]    = new GCutRaster(cb ? cutPionCB : cutPionTAPS);
+        program.species[program.nSpeciesCuts]       = SpeciesChargedPion;
+        program.nSpeciesCuts++;
+    }
+    if(type & ReconstructCutProton)
+    {
+        program.speciesCut[program.nSpeciesCuts]    = new GCutRaster(cb ? cutProtonCB : cutProtonTAPS);
+        program.species[program.nSpeciesCuts]       = SpeciesProton;
+        program.nSpeciesCuts++;
+    }
+}
 
-            if ((!chargeIgnorePID) && (GetTracks()->GetVetoEnergy(i) > 0.0))	charge[i] = 1;
-            if ((!chargeIgnoreMWPC0) && (GetTracks()->GetMWPC0Energy(i) > 0.0))	charge[i] = 1;
-            if ((!chargeIgnoreMWPC1) && (GetTracks()->GetMWPC1Energy(i) > 0.0))	charge[i] = 1;
+void    GParticleReconstruction::Release(RuleProgram& program)
+{
+    for(Int_t c=0; c<program.nHadronCuts; c++)
+        delete program.hadronCut[c];
+    for(Int_t c=0; c<program.nSpeciesCuts; c++)
+        delete program.speciesCut[c];
+    program.nHadronCuts     = 0;
+    program.nSpeciesCuts    = 0;
+}
 
-            if(typeCB & ReconstructTimeOfFlight)
-            {
-                if(cutTimeOfFlightCB->IsInside(GetTracks()->GetClusterEnergy(i),GetTracks()->GetTime(i)))
-                    hadron[i] = 1;
-            }
+// Branch free pass over track columns, of one event or of a whole block
+// (see GEventBlock), so the compiler can vectorise the compares. Only the
+// polygon cuts are left to Identify().
+void    GParticleReconstruction::ClassifyTracks(const Int_t n, const Int_t* det, const GTreeReal* time, const GTreeReal* veto, const GTreeReal* mwpc0, const GTreeReal* mwpc1, Int_t* __restrict__ flags) const
+{
+    const Int_t     maskCB      = GTreeTrack::DETECTOR_CB;
+    const Int_t     maskTAPS    = GTreeTrack::DETECTOR_TAPS;
+    const Double_t  cbMin       = timeCutCB[0];
+    const Double_t  cbMax       = timeCutCB[1];
+    const Double_t  tapsMin     = timeCutTAPS[0];
+    const Double_t  tapsMax     = timeCutTAPS[1];
+    const Int_t     usePID      = !chargeIgnorePID;
+    const Int_t     useMWPC0    = !chargeIgnoreMWPC0;
+    const Int_t     useMWPC1    = !chargeIgnoreMWPC1;
+    const Int_t     useVeto     = !chargeIgnoreVETO;
+
+    for(Int_t i=0; i<n; i++)
+    {
+        const Double_t  t       = time[i];
+        const Int_t     cb      = (det[i] & maskCB) != 0;
+        const Int_t     taps    = (det[i] & maskTAPS) != 0;
+        // written as !(outside) so a NaN time passes like before
+        const Int_t     timeCB  = !(t < cbMin) & !(t > cbMax);
+        const Int_t     timeTAPS= !(t < tapsMin) & !(t > tapsMax);
+        const Int_t     vetoHit = veto[i] > 0;
+        const Int_t     chargeCB    = (usePID & vetoHit) | (useMWPC0 & (mwpc0[i] > 0)) | (useMWPC1 & (mwpc1[i] > 0));
+        const Int_t     chargeTAPS  = useVeto & vetoHit;
+
+        flags[i]    = cb*FlagCB | taps*FlagTAPS | timeCB*FlagTimeCB | timeTAPS*FlagTimeTAPS | chargeCB*FlagChargeCB | chargeTAPS*FlagChargeTAPS;
+    }
+}
 
-            if(typeCB & ReconstructClusterSize)
-            {
-                if(cutClusterSizeCB->IsInside(GetTracks()->GetClusterEnergy(i),GetTracks()->GetClusterSize(i)))
-                    hadron[i] = 1;
-            }
+GParticleReconstruction::RuleResult GParticleReconstruction::Identify(const RuleProgram& program, const Int_t track, const Int_t flags, Int_t& species) const
+{
+    const GTreeTrack*   tracks  = GetTracks();
+    if(!(flags & program.timeFlag))
+        return RuleReject;
 
-            if (charge[i] == 0)
-            {
-                if(hadron[i] == 0) identified[i] = pdgDB->GetParticle("gamma")->PdgCode();
-                else identified[i] = pdgDB->GetParticle("neutron")->PdgCode();
-                continue;
-            }
+    if(program.fixed >= 0)
+    {
+        species = program.fixed;
+        return RuleDone;
+    }
 
-            if (GetTracks()->GetTheta(i) < chargedThetaMin) break; // user rejected theta region
-            if (GetTracks()->GetTheta(i) > chargedThetaMax) break; // user rejected theta region
+    Bool_t      charged = flags & program.chargeFlag;
+    Double_t    time    = tracks->GetTime(track);
 
-            if(hadron[i] == 1)
-            {
-                identified[i] = pdgDB->GetParticle("proton")->PdgCode();
-                continue;
-            }
+    Double_t    energy  = tracks->GetClusterEnergy(track);
+    Bool_t      hadron  = kFALSE;
+    for(Int_t c=0; c<program.nHadronCuts && !hadron; c++)
+        hadron  = program.hadronCut[c]->IsInside(energy, program.hadronClusterSize[c] ? Double_t(tracks->GetClusterSize(track)) : time);
 
-            if(typeCB & ReconstructCutProton)
-            {
-                if(cutProtonCB->IsInside(GetTracks()->GetClusterEnergy(i),GetTracks()->GetVetoEnergy(i)))
-                    identified[i] = pdgDB->GetParticle("proton")->PdgCode();
-            }
-            if(typeCB & ReconstructCutPion)
-            {
-                if(cutPionCB->IsInside(GetTracks()->GetClusterEnergy(i),GetTracks()->GetVetoEnergy(i)))
-                    identified[i] = pdgDB->GetParticle("pi+")->PdgCode();
-            }
+    if(!charged)
+    {
+        species = hadron ? SpeciesNeutron : SpeciesPhoton;
+        return RuleDone;
+    }
 
-            if(typeCB & ReconstructCutElectron)
-            {
-                if(cutElectronCB->IsInside(GetTracks()->GetClusterEnergy(i),GetTracks()->GetVetoEnergy(i)))
-                    identified[i] = pdgDB->GetParticle("e-")->PdgCode();
-            }
+    species = SpeciesRootino;
+    if(tracks->GetTheta(track) < chargedThetaMin) return RuleStop; // user rejected theta region
+    if(tracks->GetTheta(track) > chargedThetaMax) return RuleStop; // user rejected theta region
 
-        }
+    if(hadron)
+    {
+        species = SpeciesProton;
+        return RuleDone;
+    }
 
-        if(GetTracks()->HasTAPS(i))
+    Double_t    vetoEnergy  = tracks->GetVetoEnergy(track);
+    for(Int_t c=0; c<program.nSpeciesCuts; c++)
+    {
+        if(program.speciesCut[c]->IsInside(energy, vetoEnergy))
         {
-            if(GetTracks()->GetTime(i)<timeCutTAPS[0] || GetTracks()->GetTime(i)>timeCutTAPS[1])
-                return kFALSE;
-
-            identified[i] = PDG_ROOTINO;
-            charge[i] = 0;
-            hadron[i] = 0;
-
-            if(typeTAPS & ReconstructAllPhotons)
-            {
-                identified[i] = pdgDB->GetParticle("gamma")->PdgCode();
-                continue;
-            }
-
-            if(typeTAPS & ReconstructAllProtons)
-            {
-                identified[i] = pdgDB->GetParticle("proton")->PdgCode();
-                continue;
-            }
-
-            if ((!chargeIgnoreVETO) && (GetTracks()->GetVetoEnergy(i) > 0.0))	charge[i] = 1;
-
-            if(typeTAPS & ReconstructTimeOfFlight)
-            {
-                if(cutTimeOfFlightTAPS->IsInside(GetTracks()->GetClusterEnergy(i),GetTracks()->GetTime(i)))
-                    hadron[i] = 1;
-            }
-
-            if(typeTAPS & ReconstructClusterSize)
-            {
-                if(cutClusterSizeTAPS->IsInside(GetTracks()->GetClusterEnergy(i),GetTracks()->GetClusterSize(i)))
-                    hadron[i] = 1;
-            }
-
-            if (charge[i] == 0)
-            {
-                if(hadron[i] == 0) identified[i] = pdgDB->GetParticle("gamma")->PdgCode();
-                else identified[i] = pdgDB->GetParticle("neutron")->PdgCode();
-                continue;
-            }
-
-            if (GetTracks()->GetTheta(i) < chargedThetaMin) break; // user rejected theta region
-            if (GetTracks()->GetTheta(i) > chargedThetaMax) break; // user rejected theta region
-
-            if(hadron[i] == 1)
-            {
-                identified[i] = pdgDB->GetParticle("proton")->PdgCode();
-                continue;
-            }
+            species = program.species[c];
+            break;
+        }
+    }
+    return RuleOpen;
+}
 
-            if(typeTAPS & ReconstructCutProton)
-            {
-                if(cutProtonTAPS->IsInside(GetTracks()->GetClusterEnergy(i),GetTracks()->GetVetoEnergy(i)))
-                    identified[i] = pdgDB->GetParticle("proton")->PdgCode();
-            }
-            if(typeTAPS & ReconstructCutPion)
-            {
-                if(cutPionTAPS->IsInside(GetTracks()->GetClusterEnergy(i),GetTracks()->GetVetoEnergy(i)))
-                    identified[i] = pdgDB->GetParticle("pi+")->PdgCode();
-            }
+// trackFlags: result of ClassifyTracks for the tracks of this event if a
+// block pass computed it already, 0 => classify here
+Bool_t	GParticleReconstruction::ProcessEventWithoutFilling(const Int_t* trackFlags)
+{
+    if(doTrigger)
+    {
+        if(!Trigger())
+            return kFALSE;
+    }
 
-            if(typeTAPS & ReconstructCutElectron)
-            {
-                if(cutElectronTAPS->IsInside(GetTracks()->GetClusterEnergy(i),GetTracks()->GetVetoEnergy(i)))
-                    identified[i] = pdgDB->GetParticle("e-")->PdgCode();
-            }
+    GetRootinos()->Clear();
+    GetPhotons()->Clear();
+    GetElectrons()->Clear();
+    GetChargedPions()->Clear();
+    GetProtons()->Clear();
+    GetNeutrons()->Clear();
 
-        }
+    const GTreeTrack*   tracks      = GetTracks();
+    Int_t*              identified  = GetEventArena().Alloc<Int_t>(tracks->GetNTracks());     // Species per track
+    for(Int_t i=0; i<tracks->GetNTracks(); i++)
+        identified[i]   = SpeciesRootino;
+    const Int_t*        flags   = trackFlags;
+    if(!flags)
+    {
+        Int_t*  buffer  = GetEventArena().Alloc<Int_t>(tracks->GetNTracks());
+        ClassifyTracks(tracks->GetNTracks(), tracks->GetDetectors(), tracks->GetTime(), tracks->GetVetoEnergy(), tracks->GetMWPC0Energy(), tracks->GetMWPC1Energy(), buffer);
+        flags   = buffer;
     }
 
-    for (Int_t i = 0; i < GetTracks()->GetNTracks(); i++)
+    for(Int_t i=0; i<tracks->GetNTracks(); i++)
     {
-        // Finally add particles which were temporarily identified
-        if (identified[i] == pdgDB->GetParticle("proton")->PdgCode())
-            GetProtons()->AddParticle(GetTracks()->GetClusterEnergy(i), GetTracks()->GetTheta(i), GetTracks()->GetPhi(i), (pdgDB->GetParticle("proton")->Mass()*1000), GetTracks()->GetTime(i), GetTracks()->GetClusterSize(i), GetTracks()->GetCentralCrystal(i), GetTracks()->GetCentralVeto(i), GetTracks()->GetDetectors(i), GetTracks()->GetVetoEnergy(i), GetTracks()->GetMWPC0Energy(i), GetTracks()->GetMWPC1Energy(i), i);
-        else if (identified[i] == pdgDB->GetParticle("pi+")->PdgCode())
-            GetChargedPions()->AddParticle(GetTracks()->GetClusterEnergy(i), GetTracks()->GetTheta(i), GetTracks()->GetPhi(i), (pdgDB->GetParticle("pi+")->Mass()*1000), GetTracks()->GetTime(i), GetTracks()->GetClusterSize(i), GetTracks()->GetCentralCrystal(i), GetTracks()->GetCentralVeto(i), GetTracks()->GetDetectors(i), GetTracks()->GetVetoEnergy(i), GetTracks()->GetMWPC0Energy(i), GetTracks()->GetMWPC1Energy(i), i);
-        else if (identified[i] == pdgDB->GetParticle("e-")->PdgCode())
-            GetElectrons()->AddParticle(GetTracks()->GetClusterEnergy(i), GetTracks()->GetTheta(i), GetTracks()->GetPhi(i), (pdgDB->GetParticle("e-")->Mass()*1000), GetTracks()->GetTime(i), GetTracks()->GetClusterSize(i), GetTracks()->GetCentralCrystal(i), GetTracks()->GetCentralVeto(i), GetTracks()->GetDetectors(i), GetTracks()->GetVetoEnergy(i), GetTracks()->GetMWPC0Energy(i), GetTracks()->GetMWPC1Energy(i), i);
-        else if (identified[i] == pdgDB->GetParticle("neutron")->PdgCode())
-            GetNeutrons()->AddParticle(GetTracks()->GetClusterEnergy(i), GetTracks()->GetTheta(i), GetTracks()->GetPhi(i), (pdgDB->GetParticle("neutron")->Mass()*1000), GetTracks()->GetTime(i), GetTracks()->GetClusterSize(i), GetTracks()->GetCentralCrystal(i), GetTracks()->GetCentralVeto(i), GetTracks()->GetDetectors(i), GetTracks()->GetVetoEnergy(i), GetTracks()->GetMWPC0Energy(i), GetTracks()->GetMWPC1Energy(i), i);
-        else if (identified[i] == pdgDB->GetParticle("gamma")->PdgCode())
-            GetPhotons()->AddParticle(GetTracks()->GetClusterEnergy(i), GetTracks()->GetTheta(i), GetTracks()->GetPhi(i), 0, GetTracks()->GetTime(i), GetTracks()->GetClusterSize(i), GetTracks()->GetCentralCrystal(i), GetTracks()->GetCentralVeto(i), GetTracks()->GetDetectors(i), GetTracks()->GetVetoEnergy(i), GetTracks()->GetMWPC0Energy(i), GetTracks()->GetMWPC1Energy(i), i);
-        else
-            GetRootinos()->AddParticle(GetTracks()->GetClusterEnergy(i), GetTracks()->GetTheta(i), GetTracks()->GetPhi(i), 0, GetTracks()->GetTime(i), GetTracks()->GetClusterSize(i), GetTracks()->GetCentralCrystal(i), GetTracks()->GetCentralVeto(i), GetTracks()->GetDetectors(i), GetTracks()->GetVetoEnergy(i), GetTracks()->GetMWPC0Energy(i), GetTracks()->GetMWPC1Energy(i), i);
+        RuleResult  result  = RuleOpen;
+        if(flags[i] & FlagCB)
+            result  = Identify(programCB, i, flags[i], identified[i]);
+        if(result == RuleOpen && (flags[i] & FlagTAPS))
+            result  = Identify(programTAPS, i, flags[i], identified[i]);
+
+        if(result == RuleReject)    return kFALSE;
+        if(result == RuleStop)      break;
     }
 
+    // Finally add particles which were temporarily identified. The species
+    // trees only keep the track index and mass, the track columns are
+    // copied when the trees are filled
+    GTreeParticle*  speciesTree[SpeciesCount] = {GetRootinos(), GetPhotons(), GetProtons(), GetChargedPions(), GetElectrons(), GetNeutrons()};
+    for (Int_t i = 0; i < tracks->GetNTracks(); i++)
+        speciesTree[identified[i]]->AddTrack(tracks, i, speciesMass[identified[i]]);
+
     return kTRUE;
 }
 
@@ -0,0 +1,375 @@
+#include "GReclustering.h"
+
+#include <iostream>
+
+using namespace std;
+
+
+#define NEIGHBOUR_CB    2.25
+#define NEIGHBOUR_TAPS  1.5
+
+
+GReclustering::GReclustering(const Double_t _MaxEnergy, const Double_t _MaxAngle, const Double_t _MinSplitEnergy)  :
+    hasEnergies(kFALSE),
+    maxEnergy(_MaxEnergy),
+    minCosAngle(TMath::Cos(_MaxAngle * TMath::DegToRad())),
+    minSplitEnergy(_MinSplitEnergy),
+    nMerged(0),
+    nSplit(0)
+{
+    for(Int_t i=0; i<GDetectorGeometry::N_CRYSTALS; i++)
+    {
+        nNeighbours[i]  = 0;
+        energy[i]       = 0;
+    }
+    BuildNeighbours(0, GDetectorGeometry::N_NaI, NEIGHBOUR_CB);
+    BuildNeighbours(GDetectorGeometry::TAPS_OFFSET, GDetectorGeometry::N_TAPS, NEIGHBOUR_TAPS);
+}
+
+GReclustering::~GReclustering()
+{
+}
+
+void    GReclustering::AddNeighbour(const Int_t crystal, const Int_t neighbour)
+{
+    for(Int_t k=0; k<nNeighbours[crystal]; k++)
+    {
+        if(neighbours[crystal][k] == neighbour)
+            return;
+    }
+    if(nNeighbours[crystal] == MAX_NEIGHBOURS)
+    {
+        cout << "#ERROR: more than " << MAX_NEIGHBOURS << " neighbours of crystal " << crystal << endl;
+        return;
+    }
+    neighbours[crystal][nNeighbours[crystal]++] = neighbour;
+}
+
+void    GReclustering::BuildNeighbours(const Int_t first, const Int_t n, const Double_t factor)
+{
+    for(Int_t i=first; i<first+n; i++)
+    {
+        // compare cosines, acos of the rounded unit vectors can leave [-1, 1]
+        Double_t    closestCos  = -1;
+        for(Int_t j=first; j<first+n; j++)
+        {
+            if(j != i)
+                closestCos  = TMath::Max(closestCos, GDetectorGeometry::GetCosAngle(i, j));
+        }
+        const Double_t  limitCos    = TMath::Cos(TMath::Min(factor * TMath::ACos(TMath::Min(closestCos, 1.0)), TMath::Pi()));
+        for(Int_t j=first; j<first+n; j++)
+        {
+            if(j == i)  continue;
+            if(GDetectorGeometry::GetCosAngle(i, j) > limitCos)
+            {
+                AddNeighbour(i, j);
+                AddNeighbour(j, i);
+            }
+        }
+    }
+}
+
+Bool_t  GReclustering::IsNeighbour(const Int_t crystal1, const Int_t crystal2)    const
+{
+    for(Int_t k=0; k<nNeighbours[crystal1]; k++)
+    {
+        if(neighbours[crystal1][k] == crystal2)
+            return kTRUE;
+    }
+    return kFALSE;
+}
+
+void    GReclustering::SetHits(const Int_t n, const Int_t* hits, const Int_t offset, const Int_t size)
+{
+    for(Int_t i=0; i<n; i++)
+    {
+        if(hits[i] < 0 || hits[i] >= size)   continue;
+        const Int_t c   = offset + hits[i];
+        hit[c >> 6] |= 1ULL << (c & 63);
+    }
+}
+
+void    GReclustering::FloodFill(const Int_t n, const Int_t* hits, const Int_t offset, const Int_t size, Int_t& nRegions)
+{
+    for(Int_t i=0; i<n; i++)
+    {
+        if(hits[i] < 0 || hits[i] >= size)   continue;
+        const Int_t start   = offset + hits[i];
+        if(visited[start >> 6] >> (start & 63) & 1)
+            continue;
+
+        Int_t   top     = 0;
+        stack[top++]    = start;
+        visited[start >> 6] |= 1ULL << (start & 63);
+        while(top > 0)
+        {
+            const Int_t c   = stack[--top];
+            region[c]       = nRegions;
+            for(Int_t k=0; k<nNeighbours[c]; k++)
+            {
+                const Int_t     nb      = neighbours[c][k];
+                const ULong64_t bit     = 1ULL << (nb & 63);
+                if((hit[nb >> 6] & bit) && !(visited[nb >> 6] & bit))
+                {
+                    visited[nb >> 6]    |= bit;
+                    stack[top++]        = nb;
+                }
+            }
+        }
+        nRegions++;
+    }
+}
+
+void    GReclustering::ClearEnergies()
+{
+    for(Int_t i=0; i<GDetectorGeometry::N_CRYSTALS; i++)
+        energy[i]   = 0;
+    hasEnergies = kFALSE;
+}
+
+void    GReclustering::SetEnergies(const Int_t n, const Int_t* crystals, const Float_t* energies, const Int_t offset, const Int_t size, const Double_t scale)
+{
+    for(Int_t i=0; i<n; i++)
+    {
+        if(crystals[i] < 0 || crystals[i] >= size)   continue;
+        energy[offset + crystals[i]]    += scale*energies[i];
+    }
+    hasEnergies = kTRUE;
+}
+
+// the local maximum reached from a crystal by always going to the most
+// energetic member neighbour, ties to the lower crystal number
+Int_t   GReclustering::Climb(const Int_t crystal)  const
+{
+    Int_t   c   = crystal;
+    while(kTRUE)
+    {
+        Int_t   next    = c;
+        for(Int_t k=0; k<nNeighbours[c]; k++)
+        {
+            const Int_t nb  = neighbours[c][k];
+            if(!IsMember(nb))   continue;
+            if(energy[nb] > energy[next] || (energy[nb] == energy[next] && nb < next))
+                next    = nb;
+        }
+        if(next == c)
+            return c;
+        c   = next;
+    }
+}
+
+// the maximum of a crystal, the closest one if it climbs to a local
+// maximum below the split energy
+Int_t   GReclustering::Owner(const Int_t crystal, const Int_t nMaxima, const Int_t* maxima)  const
+{
+    const Int_t top = Climb(crystal);
+    Int_t       k   = 0;
+    for(Int_t m=0; m<nMaxima; m++)
+    {
+        if(maxima[m] == top)
+            return m;
+        if(GDetectorGeometry::GetCosAngle(top, maxima[m]) > GDetectorGeometry::GetCosAngle(top, maxima[k]))
+            k   = m;
+    }
+    return k;
+}
+
+void    GReclustering::Relabel(GTreeDetectorHits& hits, const Bool_t taps, const Int_t from, const Int_t to)   const
+{
+    if(taps)
+    {
+        for(Int_t i=0; i<hits.GetNBaF2Hits(); i++)
+        {
+            if(hits.GetBaF2Cluster(i) == from)
+                hits.SetBaF2Cluster(i, to);
+        }
+    }
+    else
+    {
+        for(Int_t i=0; i<hits.GetNNaIHits(); i++)
+        {
+            if(hits.GetNaICluster(i) == from)
+                hits.SetNaICluster(i, to);
+        }
+    }
+}
+
+Bool_t  GReclustering::SplitTrack(GTreeTrack& tracks, GTreeDetectorHits& hits, const Int_t track)
+{
+    const Int_t     central = tracks.GetCrystal(track);
+    if(central < 0)
+        return kFALSE;
+    const Bool_t    taps    = GDetectorGeometry::IsTAPS(central);
+    const Int_t     offset  = taps ? GDetectorGeometry::TAPS_OFFSET : 0;
+    const Int_t     size    = taps ? GDetectorGeometry::N_TAPS : GDetectorGeometry::N_NaI;
+    const Int_t     nHits   = taps ? hits.GetNBaF2Hits() : hits.GetNNaIHits();
+    const Int_t*    crystal = taps ? hits.GetBaF2Hits() : hits.GetNaIHits();
+    const Int_t*    label   = taps ? hits.GetBaF2Cluster() : hits.GetNaICluster();
+    const Int_t     cluster = tracks.GetCentralCrystal(track);
+
+    // the crystals of the track with an energy
+    for(Int_t w=0; w<N_WORDS; w++)
+        member[w]   = 0;
+    for(Int_t i=0; i<nHits; i++)
+    {
+        if(label[i] != cluster || crystal[i] < 0 || crystal[i] >= size)    continue;
+        const Int_t c   = offset + crystal[i];
+        if(energy[c] > 0)
+            member[c >> 6]  |= 1ULL << (c & 63);
+    }
+
+    // its local maxima above the split energy
+    Int_t   nMaxima = 0;
+    Int_t   maxima[MAX_MAXIMA];
+    for(Int_t i=0; i<nHits; i++)
+    {
+        if(label[i] != cluster || crystal[i] < 0 || crystal[i] >= size)    continue;
+        const Int_t c   = offset + crystal[i];
+        if(!IsMember(c) || energy[c] < minSplitEnergy || Climb(c) != c)
+            continue;
+        if(nMaxima == MAX_MAXIMA)
+            return kFALSE;
+        maxima[nMaxima++]   = c;
+    }
+    if(nMaxima < 2 || tracks.GetNTracks() + nMaxima - 1 > MAX_TRACKS)
+        return kFALSE;
+
+    // the energy and direction of every part
+    Double_t    sum[MAX_MAXIMA];
+    Double_t    x[MAX_MAXIMA];
+    Double_t    y[MAX_MAXIMA];
+    Double_t    z[MAX_MAXIMA];
+    Int_t       count[MAX_MAXIMA];
+    Int_t       keep    = 0;
+    Double_t    total   = 0;
+    for(Int_t k=0; k<nMaxima; k++)
+    {
+        sum[k]      = 0;
+        x[k]        = 0;
+        y[k]        = 0;
+        z[k]        = 0;
+        count[k]    = 0;
+    }
+    for(Int_t i=0; i<nHits; i++)
+    {
+        if(label[i] != cluster || crystal[i] < 0 || crystal[i] >= size)    continue;
+        const Int_t c   = offset + crystal[i];
+        if(!IsMember(c))    continue;
+        const Int_t k   = Owner(c, nMaxima, maxima);
+        sum[k]      += energy[c];
+        x[k]        += energy[c]*GDetectorGeometry::UnitX[c];
+        y[k]        += energy[c]*GDetectorGeometry::UnitY[c];
+        z[k]        += energy[c]*GDetectorGeometry::UnitZ[c];
+        count[k]++;
+        total       += energy[c];
+        if(c == central)
+            keep    = k;
+    }
+
+    // the track keeps the part of its central crystal, the others are new
+    // tracks; the cluster energy is shared like the crystal energies
+    const Double_t  clusterEnergy   = tracks.GetClusterEnergy(track);
+    for(Int_t k=0; k<nMaxima; k++)
+    {
+        const Double_t  theta   = TMath::ATan2(TMath::Sqrt(x[k]*x[k] + y[k]*y[k]), z[k]) * TMath::RadToDeg();
+        const Double_t  phi     = TMath::ATan2(y[k], x[k]) * TMath::RadToDeg();
+        const Int_t     t       = k == keep ? track : tracks.CopyTrack(track);
+        tracks.SetCluster(t, clusterEnergy*sum[k]/total, theta, phi, k == keep ? cluster : maxima[k] - offset, count[k]);
+        split[t]    = kTRUE;
+    }
+
+    // relabel the crystals of the new tracks
+    for(Int_t i=0; i<nHits; i++)
+    {
+        if(label[i] != cluster || crystal[i] < 0 || crystal[i] >= size)    continue;
+        const Int_t c   = offset + crystal[i];
+        if(!IsMember(c))    continue;
+        const Int_t k   = Owner(c, nMaxima, maxima);
+        if(k == keep)   continue;
+        if(taps)
+            hits.SetBaF2Cluster(i, maxima[k] - offset);
+        else
+            hits.SetNaICluster(i, maxima[k] - offset);
+    }
+    nSplit  += nMaxima - 1;
+    return kTRUE;
+}
+
+void    GReclustering::MergeTracks(GTreeTrack& tracks, GTreeDetectorHits& hits)
+{
+    for(Int_t w=0; w<N_WORDS; w++)
+    {
+        hit[w]      = 0;
+        visited[w]  = 0;
+    }
+    SetHits(hits.GetNNaIHits(), hits.GetNaIHits(), 0, GDetectorGeometry::N_NaI);
+    SetHits(hits.GetNBaF2Hits(), hits.GetBaF2Hits(), GDetectorGeometry::TAPS_OFFSET, GDetectorGeometry::N_TAPS);
+
+    Int_t   nRegions    = 0;
+    FloodFill(hits.GetNNaIHits(), hits.GetNaIHits(), 0, GDetectorGeometry::N_NaI, nRegions);
+    FloodFill(hits.GetNBaF2Hits(), hits.GetBaF2Hits(), GDetectorGeometry::TAPS_OFFSET, GDetectorGeometry::N_TAPS, nRegions);
+
+    // merge the least energetic candidate first, until none is left
+    while(kTRUE)
+    {
+        Int_t   from    = -1;
+        Int_t   into    = -1;
+        for(Int_t i=0; i<tracks.GetNTracks(); i++)
+        {
+            if(tracks.GetClusterEnergy(i) >= maxEnergy)    continue;
+            if(tracks.GetVetoEnergy(i) != 0 || IsSplit(i)) continue;
+            if(from >= 0 && tracks.GetClusterEnergy(i) >= tracks.GetClusterEnergy(from))  continue;
+            const Int_t r   = GetRegion(tracks.GetCrystal(i));
+            if(r < 0)   continue;
+
+            Int_t   best    = -1;
+            for(Int_t j=0; j<tracks.GetNTracks(); j++)
+            {
+                if(j == i || tracks.GetClusterEnergy(j) < tracks.GetClusterEnergy(i))  continue;
+                if(tracks.GetVetoEnergy(j) != 0 || IsSplit(j)) continue;
+                if(best >= 0 && tracks.GetClusterEnergy(j) <= tracks.GetClusterEnergy(best)) continue;
+                if(GetRegion(tracks.GetCrystal(j)) != r)   continue;
+                const GP4   u   = tracks.GetDirection(i);
+                const GP4   v   = tracks.GetDirection(j);
+                if(u.px*v.px + u.py*v.py + u.pz*v.pz < minCosAngle)   continue;
+                best    = j;
+            }
+            if(best >= 0)
+            {
+                from    = i;
+                into    = best;
+            }
+        }
+        if(from < 0)
+            break;
+
+        // the region holds one detector, so both tracks are in it
+        Relabel(hits, GDetectorGeometry::IsTAPS(tracks.GetCrystal(from)), tracks.GetCentralCrystal(from), tracks.GetCentralCrystal(into));
+        tracks.MergeTrack(into, from);
+        for(Int_t i=from; i<MAX_TRACKS-1; i++)
+            split[i]    = split[i+1];
+        nMerged++;
+    }
+}
+
+Int_t   GReclustering::Run(GTreeTrack& tracks, GTreeDetectorHits& hits)
+{
+    nMerged = 0;
+    nSplit  = 0;
+    for(Int_t i=0; i<MAX_TRACKS; i++)
+        split[i]    = kFALSE;
+
+    if(hasEnergies && minSplitEnergy > 0)
+    {
+        const Int_t n   = tracks.GetNTracks();
+        for(Int_t i=0; i<n && i<MAX_TRACKS; i++)
+        {
+            if(tracks.GetVetoEnergy(i) == 0)
+                SplitTrack(tracks, hits, i);
+        }
+    }
+    if(maxEnergy > 0)
+        MergeTracks(tracks, hits);
+
+    return nSplit - nMerged;
+}
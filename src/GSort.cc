@@ -208,6 +208,30 @@ void	GSort::Reconstruct()
 }
 
 Bool_t GSort::SortAnalyseEvent()
+{
+    return SortRaw(GetTracks()->GetNTracks(), GetTracks()->GetNCB(), GetTracks()->GetNTAPS(), GetTrigger()->GetEnergySum());
+}
+
+// Raw sort of all events of a block, rejected events are removed from it
+void GSort::SortAnalyseBlock(GEventBlock& block)
+{
+    const Int_t*    detectors   = block.GetDetectors();
+    Bool_t*         keep        = GetEventArena().Alloc<Bool_t>(block.GetNEvents());
+    for(Int_t e=0; e<block.GetNEvents(); e++)
+    {
+        Int_t   nCB     = 0;
+        Int_t   nTAPS   = 0;
+        for(Int_t i=block.GetOffset(e); i<block.GetOffset(e+1); i++)
+        {
+            nCB     += (detectors[i] & GTreeTrack::DETECTOR_CB) != 0;
+            nTAPS   += (detectors[i] & GTreeTrack::DETECTOR_TAPS) != 0;
+        }
+        keep[e] = SortRaw(block.GetNTracks(e), nCB, nTAPS, block.GetEnergySum(e));
+    }
+    block.Compact(keep);
+}
+
+Bool_t GSort::SortRaw(const Int_t nTracks, const Int_t nCB, const Int_t nTAPS, const Double_t energySum) const
 {
 
 	// Sort on raw variables before analysis (increases speed)
@@ -216,13 +240,13 @@ Bool_t GSort::SortAnalyseEvent()
         switch (SR_nTracks_total_condition) 	// Total number of tracks
 		{
             case Condion_EqualOrMore:
-                if (GetTracks()->GetNTracks() < SR_nTracks_total) 	return kFALSE;
+                if (nTracks < SR_nTracks_total) 	return kFALSE;
 				break;
             case Condion_EqualOrLess:
-                if (GetTracks()->GetNTracks() > SR_nTracks_total) 	return kFALSE;
+                if (nTracks > SR_nTracks_total) 	return kFALSE;
 				break;
             case Condion_Equal:
-                if (GetTracks()->GetNTracks() != SR_nTracks_total) 	return kFALSE;
+                if (nTracks != SR_nTracks_total) 	return kFALSE;
 				break;
             case Condion_NONE:
                 return kFALSE;
@@ -231,13 +255,13 @@ Bool_t GSort::SortAnalyseEvent()
         switch (SR_nTracks_CB_condition) 	// Number of tracks in CB
 		{
             case Condion_EqualOrMore:
-                if (GetTracks()->GetNCB() < SR_nTracks_CB) 			return kFALSE;
+                if (nCB < SR_nTracks_CB) 			return kFALSE;
 				break;
             case Condion_EqualOrLess:
-                if (GetTracks()->GetNCB() > SR_nTracks_CB) 			return kFALSE;
+                if (nCB > SR_nTracks_CB) 			return kFALSE;
 				break;
             case Condion_Equal:
-                if (GetTracks()->GetNCB() != SR_nTracks_CB) 			return kFALSE;
+                if (nCB != SR_nTracks_CB) 			return kFALSE;
 				break;
             case Condion_NONE:
                 return kFALSE;
@@ -246,13 +270,13 @@ Bool_t GSort::SortAnalyseEvent()
         switch (SR_nTracks_TAPS_condition) 	// Number of tracks in TAPS
 		{
             case Condion_EqualOrMore:
-                if (GetTracks()->GetNTAPS() < SR_nTracks_TAPS) 		return kFALSE;
+                if (nTAPS < SR_nTracks_TAPS) 		return kFALSE;
 				break;
             case Condion_EqualOrLess:
-                if (GetTracks()->GetNTAPS() > SR_nTracks_TAPS) 		return kFALSE;
+                if (nTAPS > SR_nTracks_TAPS) 		return kFALSE;
 				break;
             case Condion_Equal:
-                if (GetTracks()->GetNTAPS() != SR_nTracks_TAPS)		return kFALSE;
+                if (nTAPS != SR_nTracks_TAPS)		return kFALSE;
 				break;
             case Condion_NONE:
                 return kFALSE;
@@ -264,13 +288,13 @@ Bool_t GSort::SortAnalyseEvent()
 		switch (SR_CBESum_condition) 	// Crystal Ball Energy Sum
 		{
             case Condion_EqualOrMore:
-                if (GetTrigger()->GetEnergySum() < SR_CBESum) 				return kFALSE;
+                if (energySum < SR_CBESum) 				return kFALSE;
 				break;
             case Condion_EqualOrLess:
-                if (GetTrigger()->GetEnergySum() > SR_CBESum) 				return kFALSE;
+                if (energySum > SR_CBESum) 				return kFALSE;
 				break;
             case Condion_Equal:
-                if (GetTrigger()->GetEnergySum() != SR_CBESum)				return kFALSE;
+                if (energySum != SR_CBESum)				return kFALSE;
 				break;
             case Condion_NONE:
                 return kFALSE;
@@ -1,6 +1,8 @@
 #include "GTree.h"
 #include "GTreeManager.h"
 
+#include <TLeaf.h>
+
 
 using namespace std;
 
@@ -13,51 +15,46 @@ GTree::GTree(GTreeManager *Manager, const TString& _Name, const Bool_t Correlate
     inputTree(0),
     outputTree(0),
     manager(Manager),
-    saveToFile(true)
+    saveToFile(true),
+    convertInput(kFALSE),
+    capacity(0),
+    generation(0)
 {
     if(correlatedToScalerRead)
-    {
-        if(!manager->treeCorreleatedToScalerReadList.FindObject(this))
-            manager->treeCorreleatedToScalerReadList.Add(this);
-    }
+        slot    = manager->registry.Add(this, GTreeRegistry::KIND_SCALER);
     else if(singleRead)
-    {
-        if(!manager->treeSingleReadList.FindObject(this))
-            manager->treeSingleReadList.Add(this);
-    }
+        slot    = manager->registry.Add(this, GTreeRegistry::KIND_SINGLE);
     else
-    {
-        if(!manager->treeList.FindObject(this))
-            manager->treeList.Add(this);
-    }
+        slot    = manager->registry.Add(this, GTreeRegistry::KIND_EVENT);
 }
 
 GTree::~GTree()
 {
-    if(correlatedToScalerRead)
-    {
-        if(manager->treeCorreleatedToScalerReadList.FindObject(this))
-        {
-            manager->treeCorreleatedToScalerReadList.Remove(this);
-            manager->treeCorreleatedToScalerReadList.Compress();
-        }
-    }
-    else if(singleRead)
-    {
-        if(manager->treeSingleReadList.FindObject(this))
-        {
-            manager->treeSingleReadList.Remove(this);
-            manager->treeSingleReadList.Compress();
-        }
-    }
-    else
-    {
-        if(manager->treeList.FindObject(this))
-        {
-            manager->treeList.Remove(this);
-            manager->treeList.Compress();
-        }
-    }
+    manager->registry.Remove(slot);
+}
+
+void    GTree::Reserve(const Int_t n)
+{
+    if(n <= capacity)
+        return;
+    Int_t   grown   = capacity>0 ? capacity : 8;
+    while(grown < n)
+        grown   *= 2;
+    ReserveColumns(grown);
+    capacity    = grown;
+
+    // the columns moved, so the branches have to follow
+    if(IsOpenForInput())
+        SetBranchAdresses();
+    if(IsOpenForOutput())
+        SetOutputAddresses();
+}
+
+void    GTree::ReserveFromInput(const char* counter)
+{
+    TLeaf*  leaf    = inputTree->GetLeaf(counter);
+    if(leaf)
+        Reserve(leaf->GetMaximum());
 }
 
 void    GTree::Fill()
@@ -78,24 +75,11 @@ Bool_t  GTree::OpenForInput()
     manager->inputFile->GetObject(name.Data(),inputTree);
     if(inputTree)
     {
+        convertInput    = kFALSE;
         SetBranchAdresses();
         status  = status | FLAG_OPENFORINPUT;
         GetEntry(0);
-        if(correlatedToScalerRead)
-        {
-            if(!manager->readCorreleatedToScalerReadList.FindObject(this))
-                manager->readCorreleatedToScalerReadList.Add(this);
-        }
-        else if(singleRead)
-        {
-            if(!manager->readSingleReadList.FindObject(this))
-                manager->readSingleReadList.Add(this);
-        }
-        else
-        {
-            if(!manager->readList.FindObject(this))
-                manager->readList.Add(this);
-        }
+        manager->registry.SetRead(slot, kTRUE);
         return kTRUE;
     }
 
@@ -112,8 +96,7 @@ Bool_t  GTree::OpenForOutput()
     {
         SetBranches();
         status  = status | FLAG_OPENFOROUTPUT;
-        if(!manager->writeList.FindObject(this))
-            manager->writeList.Add(this);
+        manager->registry.SetWrite(slot, kTRUE);
         return kTRUE;
     }
 
@@ -125,16 +108,8 @@ Bool_t  GTree::OpenForOutput()
 void    GTree::Close()
 {
     status = FLAG_CLOSED;
-    if(manager->writeList.FindObject(this))
-    {
-        manager->writeList.Remove(this);
-        manager->writeList.Compress();
-    }
-    if(manager->readList.FindObject(this))
-    {
-        manager->readList.Remove(this);
-        manager->readList.Compress();
-    }
+    manager->registry.SetWrite(slot, kFALSE);
+    manager->registry.SetRead(slot, kFALSE);
     if(outputTree)
         delete outputTree;
 
@@ -148,8 +123,7 @@ void    GTree::Close()
 void    GTree::CloseForInput()
 {
     status = status & ~FLAG_OPENFORINPUT;
-    if(manager->readList.FindObject(this))
-        manager->readList.Remove(this);
+    manager->registry.SetRead(slot, kFALSE);
     if(inputTree)
         delete inputTree;
 }
@@ -157,8 +131,7 @@ void    GTree::CloseForInput()
 void    GTree::CloseForOutput()
 {
     status = status & ~FLAG_OPENFOROUTPUT;
-    if(manager->writeList.FindObject(this))
-        manager->writeList.Remove(this);
+    manager->registry.SetWrite(slot, kFALSE);
     if(outputTree)
         delete outputTree;
 }
@@ -5,76 +5,50 @@
 
 void GTreeA2Geant::SetBranchAdresses()
 {
-    inputTree->SetBranchAddress("nhits",&fnhits);
-    inputTree->SetBranchAddress("npart",&fnpart);
-    inputTree->SetBranchAddress("ntaps",&fntaps);
-    inputTree->SetBranchAddress("nvtaps",&fnvtaps);
-    inputTree->SetBranchAddress("vhits",&fvhits);
-    inputTree->SetBranchAddress("plab",plab);
-    inputTree->SetBranchAddress("tctaps",tctaps);
-    inputTree->SetBranchAddress("vertex",fvertex);
-    inputTree->SetBranchAddress("beam",fbeam);
-    inputTree->SetBranchAddress("dircos",dircos);
-    inputTree->SetBranchAddress("ecryst",ecryst);
-    inputTree->SetBranchAddress("tcryst",tcryst);
-    inputTree->SetBranchAddress("ectapfs",ectapfs);
-    inputTree->SetBranchAddress("ectapsl",ectapsl);
-    inputTree->SetBranchAddress("elab",elab);
-    inputTree->SetBranchAddress("eleak",&feleak);
-    inputTree->SetBranchAddress("enai",&fenai);
-    inputTree->SetBranchAddress("etot",&fetot);
-    inputTree->SetBranchAddress("eveto",eveto);
-    inputTree->SetBranchAddress("tveto",tveto);
-    inputTree->SetBranchAddress("evtaps",evtaps);
-    inputTree->SetBranchAddress("icryst",icryst);
-    inputTree->SetBranchAddress("ictaps",ictaps);
-    inputTree->SetBranchAddress("ivtaps",ivtaps);
-    inputTree->SetBranchAddress("idpart",idpart);
-    inputTree->SetBranchAddress("iveto",iveto);
-    inputTree->SetBranchAddress("nmwpc",&fnmwpc);
-    inputTree->SetBranchAddress("imwpc",imwpc);
-    inputTree->SetBranchAddress("mposx",mposx);
-    inputTree->SetBranchAddress("mposy",mposy);
-    inputTree->SetBranchAddress("mposz",mposz);
-    inputTree->SetBranchAddress("emwpc",emwpc);
-    inputTree->SetBranchAddress("mc_evt_id",&mc_evt_id);
-    inputTree->SetBranchAddress("mc_rnd_id",&mc_evt_id);
+    GTreeA2Geant_SCALARS(GTREE_BIND_SCALAR, inputTree)
+    GTreeA2Geant_PART_COLUMNS(GTREE_BIND_COLUMN, inputTree)
+    GTreeA2Geant_CB_COLUMNS(GTREE_BIND_COLUMN, inputTree)
+    GTreeA2Geant_TAPS_COLUMNS(GTREE_BIND_COLUMN, inputTree)
+    GTreeA2Geant_VTAPS_COLUMNS(GTREE_BIND_COLUMN, inputTree)
+    GTreeA2Geant_PID_COLUMNS(GTREE_BIND_COLUMN, inputTree)
+    GTreeA2Geant_MWPC_COLUMNS(GTREE_BIND_COLUMN, inputTree)
+    GTreeA2Geant_FIXED_COLUMNS(GTREE_BIND_COLUMN, inputTree)
+    hasMCID = inputTree->GetBranch("mc_evt_id") != 0;
+    if(hasMCID)
+    {
+        GTreeA2Geant_MCID_SCALARS(GTREE_BIND_SCALAR, inputTree)
+    }
 }
 
 void GTreeA2Geant::SetBranches()
 {
-    outputTree->Branch("nhits",&fnhits,"fnhits/I");
-    outputTree->Branch("npart",&fnpart,"fnpart/I");
-    outputTree->Branch("ntaps",&fntaps,"fntaps/I");
-    outputTree->Branch("nvtaps",&fnvtaps,"fnvtaps/I");
-    outputTree->Branch("vhits",&fvhits,"fvhits/I");
-    outputTree->Branch("plab",plab,"fplab[fnpart]/F");
-    outputTree->Branch("tctaps",tctaps,"ftctaps[fntaps]/F");
-    outputTree->Branch("vertex",fvertex,"fvertex[3]/F");
-    outputTree->Branch("beam",fbeam,"fbeam[5]/F");
-    outputTree->Branch("dircos",dircos,"fdircos[fnpart][3]/F");
-    outputTree->Branch("ecryst",ecryst,"fecryst[fnhits]/F");
-    outputTree->Branch("tcryst",tcryst,"ftcryst[fnhits]/F");
-    outputTree->Branch("ectapfs",ectapfs,"fectapfs[fntaps]/F");
-    outputTree->Branch("ectapsl",ectapsl,"fectapsl[fntaps]/F");
-    outputTree->Branch("elab",elab,"felab[fnpart]/F");
-    outputTree->Branch("eleak",&feleak,"feleak/F");
-    outputTree->Branch("enai",&fenai,"fenai/F");
-    outputTree->Branch("etot",&fetot,"fetot/F");
-    outputTree->Branch("eveto",eveto,"feveto[fvhits]/F");
-    outputTree->Branch("tveto",tveto,"ftveto[fvhits]/F");
-    outputTree->Branch("evtaps",evtaps,"fevtaps[fnvtaps]/F");
-    outputTree->Branch("icryst",icryst,"ficryst[fnhits]/I");
-    outputTree->Branch("ictaps",ictaps,"fictaps[fntaps]/I");
-    outputTree->Branch("ivtaps",ivtaps,"fictaps[fnvtaps]/I");
-    outputTree->Branch("idpart",idpart,"fidpart[fnpart]/I");
-    outputTree->Branch("iveto",iveto,"fiveto[fvhits]/I");
-    outputTree->Branch("nmwpc",&fnmwpc,"fnmwpc/I");
-    outputTree->Branch("imwpc",imwpc,"fimwpc[fnmwpc]/I");
-    outputTree->Branch("mposx",mposx,"fmposx[fnmwpc]/F");
-    outputTree->Branch("mposy",mposy,"fmposy[fnmwpc]/F");
-    outputTree->Branch("mposz",mposz,"fmposz[fnmwpc]/F");
-    outputTree->Branch("emwpc",emwpc,"femwpc[fnmwpc]/F");
+    GTreeA2Geant_SCALARS(GTREE_BRANCH_SCALAR, outputTree)
+    GTreeA2Geant_PART_COLUMNS(GTREE_BRANCH_COLUMN, "npart")
+    GTreeA2Geant_CB_COLUMNS(GTREE_BRANCH_COLUMN, "nhits")
+    GTreeA2Geant_TAPS_COLUMNS(GTREE_BRANCH_COLUMN, "ntaps")
+    GTreeA2Geant_VTAPS_COLUMNS(GTREE_BRANCH_COLUMN, "nvtaps")
+    GTreeA2Geant_PID_COLUMNS(GTREE_BRANCH_COLUMN, "vhits")
+    GTreeA2Geant_MWPC_COLUMNS(GTREE_BRANCH_COLUMN, "nmwpc")
+    vertex.Branch(outputTree, "vertex", "3");
+    beam.Branch(outputTree, "beam", "5");
+    dircos.Branch(outputTree, "dircos", "npart", "[3]");
+    if(hasMCID)
+    {
+        GTreeA2Geant_MCID_SCALARS(GTREE_BRANCH_SCALAR, outputTree)
+    }
+}
+
+void GTreeA2Geant::ConvertInput()
+{
+    GTreeA2Geant_PART_COLUMNS(GTREE_CONVERT_COLUMN, npart)
+    GTreeA2Geant_CB_COLUMNS(GTREE_CONVERT_COLUMN, nhits)
+    GTreeA2Geant_TAPS_COLUMNS(GTREE_CONVERT_COLUMN, ntaps)
+    GTreeA2Geant_VTAPS_COLUMNS(GTREE_CONVERT_COLUMN, nvtaps)
+    GTreeA2Geant_PID_COLUMNS(GTREE_CONVERT_COLUMN, vhits)
+    GTreeA2Geant_MWPC_COLUMNS(GTREE_CONVERT_COLUMN, nmwpc)
+    vertex.Convert(3);
+    beam.Convert(5);
+    dircos.Convert(3*npart);
 }
 
 Double_t GTreeA2Geant::sumArray(const Float_t * const data, const Int_t size)
@@ -99,41 +73,28 @@ void GTreeA2Geant::buildPattern(GTreeA2Geant::hitvector &pattern, const Int_t *
 
 GTreeA2Geant::GTreeA2Geant(GTreeManager *Manager):
     GTree(Manager, TString(GEANT_TREE_NAME)),
-    fnhits(0),
-    fnpart(0),
-    fntaps(0),
-    fnvtaps(0),
-    fvhits(0),
-    plab(),
-    tctaps(),
-    fvertex(),
-    fbeam(),
-    dircos(),
-    ecryst(),
-    tcryst(),
-    ectapfs(),
-    ectapsl(),
-    elab(),
-    feleak(0),
-    fenai(0),
-    fetot(0),
-    eveto(),
-    tveto(),
-    evtaps(),
-    icryst(),
-    ictaps(),
-    ivtaps(),
-    idpart(),
-    iveto(),
-    fnmwpc(0),
-    imwpc(),
-    mposx(),
-    mposy(),
-    mposz(),
-    emwpc(),
+    nhits(0),
+    npart(0),
+    ntaps(0),
+    nvtaps(0),
+    vhits(0),
+    eleak(0),
+    enai(0),
+    etot(0),
+    nmwpc(0),
     mc_evt_id(0),
-    mc_rnd_id(0)
+    mc_rnd_id(0),
+    hasMCID(kFALSE)
 {
+    GTreeA2Geant_PART_COLUMNS(GTREE_RESERVE_COLUMN, GEANT_MAX_PART)
+    GTreeA2Geant_CB_COLUMNS(GTREE_RESERVE_COLUMN, GEANT_MAX_CBHITS)
+    GTreeA2Geant_TAPS_COLUMNS(GTREE_RESERVE_COLUMN, GEANT_MAX_TAPSHITS)
+    GTreeA2Geant_VTAPS_COLUMNS(GTREE_RESERVE_COLUMN, GEANT_MAX_TAPSHITS)
+    GTreeA2Geant_PID_COLUMNS(GTREE_RESERVE_COLUMN, GEANT_MAX_PIDHITS)
+    GTreeA2Geant_MWPC_COLUMNS(GTREE_RESERVE_COLUMN, GEANT_MAX_MWPCHITS)
+    vertex.Reserve(3);
+    beam.Reserve(5);
+    dircos.Reserve(3*GEANT_MAX_PART);
 }
 
 GTreeA2Geant::~GTreeA2Geant()
@@ -142,19 +103,19 @@ GTreeA2Geant::~GTreeA2Geant()
 
 TLorentzVector GTreeA2Geant::GetBeam() const
 {
-    double x = fbeam[0], y = fbeam[1], z = fbeam[2], t = fbeam[3];
+    double x = beam[0], y = beam[1], z = beam[2], t = beam[3];
 
     return TLorentzVector(t*x, t*y, t*z, t);
 }
 
 TVector3 GTreeA2Geant::GetVertex() const
 {
-    return TVector3(fvertex);
+    return TVector3(vertex[0], vertex[1], vertex[2]);
 }
 
 Double_t GTreeA2Geant::GetCBESum() const
 {
-    return fetot;
+    return etot;
 }
 
 Double_t GTreeA2Geant::GetPIDESum() const
@@ -164,18 +125,18 @@ Double_t GTreeA2Geant::GetPIDESum() const
 
 Double_t GTreeA2Geant::GetTAPSESum() const
 {
-    return sumArray(ectapsl, fntaps);
+    return sumArray(ectapsl, ntaps);
 }
 
 Double_t GTreeA2Geant::GetTAPSVetoESum() const
 {
-    return sumArray(evtaps, fnvtaps);
+    return sumArray(evtaps, nvtaps);
 }
 
 
 Int_t GTreeA2Geant::GetNCBHits() const
 {
-    return fnhits;
+    return nhits;
 }
 
 Int_t GTreeA2Geant::GetCBHitIndex(const UInt_t n) const throw (std::out_of_range)
@@ -207,7 +168,7 @@ const Float_t * const GTreeA2Geant::GetCBHitEnergies() const
 
 Int_t GTreeA2Geant::GetNTAPSHits() const
 {
-    return fntaps;
+    return ntaps;
 }
 
 const Int_t * const GTreeA2Geant::GetTAPSHitIndices() const
@@ -264,7 +225,7 @@ const Float_t * const GTreeA2Geant::GetTAPSHitTimes() const
 
 Int_t GTreeA2Geant::GetNTAPSVetoHits() const
 {
-    return fnvtaps;
+    return nvtaps;
 }
 
 Int_t GTreeA2Geant::GetTAPSVetoHitIndex(const UInt_t n) const throw (std::out_of_range)
@@ -295,7 +256,7 @@ const Float_t * const GTreeA2Geant::GetTAPSVetoHitEnergies() const
 
 Int_t GTreeA2Geant::GetNPIDHits() const
 {
-    return fvhits;
+    return vhits;
 }
 
 Int_t GTreeA2Geant::GetPIDHitIndex(const UInt_t n) const throw (std::out_of_range)
@@ -339,7 +300,7 @@ const Float_t * const GTreeA2Geant::GetPIDHitTimes() const
 
 Int_t GTreeA2Geant::GetNMWPCHits() const
 {
-    return fnmwpc;
+    return nmwpc;
 }
 
 const Int_t * const GTreeA2Geant::GetMWPCHitIndices() const
@@ -411,7 +372,7 @@ void GTreeA2Geant::BuildTAPSHitPattern(GTreeA2Geant::hitvector &pattern) const
 
 UInt_t GTreeA2Geant::GetNTrueParticles() const
 {
-    return fnpart;
+    return npart;
 }
 
 UInt_t GTreeA2Geant::GetTrueID(const UInt_t n) const throw(std::out_of_range)
@@ -428,7 +389,7 @@ TLorentzVector GTreeA2Geant::GetTrueVector(const UInt_t n) const throw(std::out_
     if( n >= GetNTrueParticles() )
         throw std::out_of_range(Form("%s: MC-True Particle index out of bounds. (%d/%d)", __func__, n, GetNTrueParticles()));
 
-    TVector3 p(dircos[n][0], dircos[n][1], dircos[n][2]);
+    TVector3 p(dircos[3*n], dircos[3*n+1], dircos[3*n+2]);
     p *= plab[n];
 
     TLorentzVector lv( p, elab[n]);
@@ -436,45 +397,15 @@ TLorentzVector GTreeA2Geant::GetTrueVector(const UInt_t n) const throw(std::out_
     return lv;
 }
 
-template <class T>
-void zero( T& data ) {
-    memset( data, 0, sizeof(data) );
-}
-
 void GTreeA2Geant::Clear()
 {
-    fnhits = 0;
-    fnpart = 0;
-    fntaps = 0;
-    fnvtaps = 0;
-    fvhits = 0;
-    zero(plab);
-    zero(tctaps);
-    zero(fvertex);
-    zero(fbeam);
-    zero(dircos);
-    zero(ecryst);
-    zero(tcryst);
-    zero(ectapfs);
-    zero(ectapsl);
-    zero(elab);
-    feleak = 0;
-    fenai = 0;
-    fetot = 0;
-    zero(eveto);
-    zero(tveto);
-    zero(evtaps);
-    zero(icryst);
-    zero(ictaps);
-    zero(ivtaps);
-    zero(idpart);
-    zero(iveto);
-    fnmwpc = 0;
-    zero(imwpc);
-    zero(mposx);
-    zero(mposy);
-    zero(mposz);
-    zero(emwpc);
-    mc_evt_id = 0;
-    mc_rnd_id = 0;
+    GTreeA2Geant_SCALARS(GTREE_ZERO_SCALAR, )
+    GTreeA2Geant_PART_COLUMNS(GTREE_ZERO_COLUMN, )
+    GTreeA2Geant_CB_COLUMNS(GTREE_ZERO_COLUMN, )
+    GTreeA2Geant_TAPS_COLUMNS(GTREE_ZERO_COLUMN, )
+    GTreeA2Geant_VTAPS_COLUMNS(GTREE_ZERO_COLUMN, )
+    GTreeA2Geant_PID_COLUMNS(GTREE_ZERO_COLUMN, )
+    GTreeA2Geant_MWPC_COLUMNS(GTREE_ZERO_COLUMN, )
+    GTreeA2Geant_FIXED_COLUMNS(GTREE_ZERO_COLUMN, )
+    GTreeA2Geant_MCID_SCALARS(GTREE_ZERO_SCALAR, )
 }
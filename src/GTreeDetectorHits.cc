@@ -10,6 +10,11 @@ GTreeDetectorHits::GTreeDetectorHits(GTreeManager *Manager)    :
     nBaF2Hits(0),
     nVetoHits(0)
 {
+    GTreeDetectorHits_NaI_COLUMNS(GTREE_RESERVE_COLUMN, GTreeDetectorHits_MAX_NaI)
+    GTreeDetectorHits_PID_COLUMNS(GTREE_RESERVE_COLUMN, GTreeDetectorHits_MAX_PID)
+    GTreeDetectorHits_MWPC_COLUMNS(GTREE_RESERVE_COLUMN, GTreeDetectorHits_MAX_MWPC)
+    GTreeDetectorHits_BaF2_COLUMNS(GTREE_RESERVE_COLUMN, GTreeDetectorHits_MAX_BaF2)
+    GTreeDetectorHits_Veto_COLUMNS(GTREE_RESERVE_COLUMN, GTreeDetectorHits_MAX_Veto)
 }
 
 GTreeDetectorHits::~GTreeDetectorHits()
@@ -18,34 +23,29 @@ GTreeDetectorHits::~GTreeDetectorHits()
 
 void    GTreeDetectorHits::SetBranchAdresses()
 {
-    inputTree->SetBranchAddress("nNaIHits", &nNaIHits);
-    inputTree->SetBranchAddress("NaIHits", NaIHits);
-    inputTree->SetBranchAddress("NaICluster", NaICluster);
-    inputTree->SetBranchAddress("nPIDHits", &nPIDHits);
-    inputTree->SetBranchAddress("PIDHits", PIDHits);
-    inputTree->SetBranchAddress("nMWPCHits", &nMWPCHits);
-    inputTree->SetBranchAddress("MWPCHits", MWPCHits);
-    inputTree->SetBranchAddress("nBaF2Hits", &nBaF2Hits);
-    inputTree->SetBranchAddress("BaF2Hits", BaF2Hits);
-    inputTree->SetBranchAddress("BaF2Cluster", BaF2Cluster);
-    inputTree->SetBranchAddress("nVetoHits", &nVetoHits);
-    inputTree->SetBranchAddress("VetoHits", VetoHits);
+    GTreeDetectorHits_SCALARS(GTREE_BIND_SCALAR, inputTree)
+    GTreeDetectorHits_NaI_COLUMNS(GTREE_BIND_COLUMN, inputTree)
+    GTreeDetectorHits_PID_COLUMNS(GTREE_BIND_COLUMN, inputTree)
+    GTreeDetectorHits_MWPC_COLUMNS(GTREE_BIND_COLUMN, inputTree)
+    GTreeDetectorHits_BaF2_COLUMNS(GTREE_BIND_COLUMN, inputTree)
+    GTreeDetectorHits_Veto_COLUMNS(GTREE_BIND_COLUMN, inputTree)
 }
 
 void    GTreeDetectorHits::SetBranches()
 {
-    outputTree->Branch("nNaIHits", &nNaIHits, "nNaIHits/I");
-    outputTree->Branch("NaIHits", NaIHits, "NaIHits[nNaIHits]/I");
-    outputTree->Branch("NaICluster", NaICluster, "NaICluster[nNaIHits]/I");
-    outputTree->Branch("nPIDHits", &nPIDHits, "nPIDHits/I");
-    outputTree->Branch("PIDHits", PIDHits, "PIDHits[nPIDHits]/I");
-    outputTree->Branch("nMWPCHits", &nMWPCHits, "nMWPCHits/I");
-    outputTree->Branch("MWPCHits", MWPCHits, "MWPCHits[nMWPCHits]/I");
-    outputTree->Branch("nBaF2Hits", &nBaF2Hits, "nBaF2Hits/I");
-    outputTree->Branch("BaF2Hits", BaF2Hits, "BaF2Hits[nBaF2Hits]/I");
-    outputTree->Branch("BaF2Cluster", BaF2Cluster, "BaF2Cluster[nBaF2Hits]/I");
-    outputTree->Branch("nVetoHits", &nVetoHits, "nVetoHits/I");
-    outputTree->Branch("VetoHits", VetoHits, "VetoHits[nVetoHits]/I");
+    GTreeDetectorHits_SCALARS(GTREE_BRANCH_SCALAR, outputTree)
+    GTreeDetectorHits_NaI_COLUMNS(GTREE_BRANCH_COLUMN, "nNaIHits")
+    GTreeDetectorHits_PID_COLUMNS(GTREE_BRANCH_COLUMN, "nPIDHits")
+    GTreeDetectorHits_MWPC_COLUMNS(GTREE_BRANCH_COLUMN, "nMWPCHits")
+    GTreeDetectorHits_BaF2_COLUMNS(GTREE_BRANCH_COLUMN, "nBaF2Hits")
+    GTreeDetectorHits_Veto_COLUMNS(GTREE_BRANCH_COLUMN, "nVetoHits")
 }
 
-
+void    GTreeDetectorHits::ConvertInput()
+{
+    GTreeDetectorHits_NaI_COLUMNS(GTREE_CONVERT_COLUMN, nNaIHits)
+    GTreeDetectorHits_PID_COLUMNS(GTREE_CONVERT_COLUMN, nPIDHits)
+    GTreeDetectorHits_MWPC_COLUMNS(GTREE_CONVERT_COLUMN, nMWPCHits)
+    GTreeDetectorHits_BaF2_COLUMNS(GTREE_CONVERT_COLUMN, nBaF2Hits)
+    GTreeDetectorHits_Veto_COLUMNS(GTREE_CONVERT_COLUMN, nVetoHits)
+}
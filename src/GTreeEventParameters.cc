@@ -17,16 +17,10 @@ GTreeEventParameters::~GTreeEventParameters()
 
 void    GTreeEventParameters::SetBranchAdresses()
 {
-    inputTree->SetBranchAddress("eventNumber", 	&eventNumber);
-    inputTree->SetBranchAddress("nReconstructed", 	&nReconstructed);
-
+    GTreeEventParameters_SCALARS(GTREE_BIND_SCALAR, inputTree)
 }
 
 void    GTreeEventParameters::SetBranches()
 {
-    outputTree->Branch("eventNumber", &eventNumber, "eventNumber/I");
-    outputTree->Branch("nReconstructed", &nReconstructed, "nReconstructed/I");
-
-  }
-
-
+    GTreeEventParameters_SCALARS(GTREE_BRANCH_SCALAR, outputTree)
+}
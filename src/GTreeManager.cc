@@ -13,12 +13,33 @@ GTreeManager::GTreeManager()    :
     GConfigFile(),
     inputFile(0),
     outputFile(0),
-    treeList(),
-    treeCorreleatedToScalerReadList(),
-    readList(),
-    readCorreleatedToScalerReadList(),
-    writeList(),
+    registry(),
+    treeList(registry.GetTrees(GTreeRegistry::KIND_EVENT)),
+    treeCorreleatedToScalerReadList(registry.GetTrees(GTreeRegistry::KIND_SCALER)),
+    treeSingleReadList(registry.GetTrees(GTreeRegistry::KIND_SINGLE)),
+    readList(registry.GetRead(GTreeRegistry::KIND_EVENT)),
+    readCorreleatedToScalerReadList(registry.GetRead(GTreeRegistry::KIND_SCALER)),
+    readSingleReadList(registry.GetRead(GTreeRegistry::KIND_SINGLE)),
+    writeList(registry.GetWrite()),
     countReconstructed(0),
+    samplingPeriod(1),
+    samplingFraction(1),
+    samplingSeed(4357),
+    samplingRandom(4357),
+    nScalerBlocks(0),
+    nScalerBlocksSampled(0),
+    inputSamplingFraction(1),
+    maxEventsAccepted(0),
+    maxEventsRead(0),
+    nEventsAccepted(0),
+    nEventsRead(0),
+    chainInput(kFALSE),
+    chainFile(0),
+    eventNumberOffset(0),
+    countScalerValid(0),
+    prefetch(),
+    eventArena(),
+    blockSize(0),
     tracks(0),
     tagger(0),
     trigger(0),
@@ -72,11 +93,8 @@ GTreeManager::GTreeManager()    :
 
 GTreeManager::~GTreeManager()
 {
-    while(treeList.GetEntries()>0)
-    {
-        if((GTree*)treeList[0])
-            delete (GTree*)treeList[0];
-    }
+    while(GTree* tree = registry.GetAny())
+        delete tree;
 }
 
 Bool_t  GTreeManager::TraverseEntries(const UInt_t min, const UInt_t max)
@@ -84,19 +102,46 @@ Bool_t  GTreeManager::TraverseEntries(const UInt_t min, const UInt_t max)
     if(!inputFile)
         return kFALSE;
 
-    for(UInt_t i=min; i<max; i++)
+    if(blockSize > 1)
     {
-        for(Int_t l=0; l<readList.GetEntriesFast(); l++)
-            ((GTree*)readList[l])->GetEntryFast(i);
+        for(UInt_t i=min; i<max; i+=blockSize)
+            ProcessBlock(i, (max-i > UInt_t(blockSize)) ? i+blockSize : max);
+        return kTRUE;
+    }
 
-        eventParameters->SetEventNumber(i);
-        countReconstructed = 0;
+    for(UInt_t i=min; i<max; i++)
+    {
+        ReadEntry(i);
         ProcessEvent();
     }
 
     return kTRUE;
 }
 
+void    GTreeManager::ReadEntry(const UInt_t index)
+{
+    ReadCountedEntry(index);
+    nEventsRead++;
+}
+
+// block mode: counts an entry of which only single trees were read,
+// the entries processed afterwards are read with ReadCountedEntry()
+void    GTreeManager::CountEntry(const UInt_t index)
+{
+    eventParameters->SetEventNumber(index + eventNumberOffset);
+    nEventsRead++;
+}
+
+void    GTreeManager::ReadCountedEntry(const UInt_t index)
+{
+    for(Int_t l=0; l<readList.GetEntries(); l++)
+        readList[l]->GetEntryFast(index);
+
+    eventParameters->SetEventNumber(index + eventNumberOffset);
+    countReconstructed = 0;
+    eventArena.Reset();
+}
+
 Bool_t  GTreeManager::TraverseScalerEntries(const UInt_t min, const UInt_t max)
 {
     if(!inputFile)
@@ -117,6 +162,7 @@ Bool_t  GTreeManager::TraverseScalerEntries(const UInt_t min, const UInt_t max)
     {
         scalers->GetEntryFast(i);
         countReconstructed = 0;
+        eventArena.Reset();
         ProcessEvent();
     }
 
@@ -124,17 +170,164 @@ Bool_t  GTreeManager::TraverseScalerEntries(const UInt_t min, const UInt_t max)
 }
 
 
+void    GTreeManager::InitSampling()
+{
+    std::string config = ReadConfig("Sampling-Period");
+    if(strcmp(config.c_str(), "nokey") != 0)
+    {
+        if(sscanf(config.c_str(), "%d\n", &samplingPeriod) != 1 || samplingPeriod<1)
+        {
+            cout << "#ERROR: Sampling-Period has to be a positive integer. Sampling disabled." << endl;
+            samplingPeriod  = 1;
+        }
+        else if(samplingPeriod>1)
+            cout << "Quick-look sampling: processing every " << samplingPeriod << ". scaler block." << endl;
+    }
+
+    config = ReadConfig("Sampling-Fraction");
+    if(strcmp(config.c_str(), "nokey") != 0)
+    {
+        if(sscanf(config.c_str(), "%lf %u\n", &samplingFraction, &samplingSeed) < 1 || samplingFraction<=0 || samplingFraction>1)
+        {
+            cout << "#ERROR: Sampling-Fraction has to be in (0,1]. Sampling disabled." << endl;
+            samplingFraction  = 1;
+        }
+        else if(samplingFraction<1)
+            cout << "Quick-look sampling: processing a random fraction of " << samplingFraction << " of the scaler blocks (seed " << samplingSeed << ")." << endl;
+    }
+}
+
+Bool_t  GTreeManager::SampleScalerBlock()
+{
+    nScalerBlocks++;
+    if(samplingPeriod>1 && (nScalerBlocks-1)%samplingPeriod != 0)
+        return kFALSE;
+    if(samplingFraction<1 && samplingRandom.Rndm()>=samplingFraction)
+        return kFALSE;
+    nScalerBlocksSampled++;
+    return kTRUE;
+}
+
+Double_t    GTreeManager::GetSamplingFraction()   const
+{
+    if(nScalerBlocks==0)
+        return inputSamplingFraction;
+    return inputSamplingFraction * nScalerBlocksSampled / nScalerBlocks;
+}
+
+void    GTreeManager::InitEventLimits()
+{
+    nEventsAccepted = 0;
+    nEventsRead     = 0;
+
+    std::string config = ReadConfig("Max-Accepted-Events");
+    if(strcmp(config.c_str(), "nokey") != 0)
+    {
+        if(sscanf(config.c_str(), "%lld\n", &maxEventsAccepted) == 1 && maxEventsAccepted>0)
+            cout << "Stop after " << maxEventsAccepted << " accepted events." << endl;
+        else
+            maxEventsAccepted   = 0;
+    }
+
+    config = ReadConfig("Max-Events-Read");
+    if(strcmp(config.c_str(), "nokey") != 0)
+    {
+        if(sscanf(config.c_str(), "%lld\n", &maxEventsRead) == 1 && maxEventsRead>0)
+            cout << "Stop after " << maxEventsRead << " events read." << endl;
+        else
+            maxEventsRead   = 0;
+    }
+}
+
 Bool_t  GTreeManager::TraverseFiles()
 {
+    InitSampling();
+    InitEventLimits();
+
     Int_t nFiles = GetNFiles();
+
+    chainInput  = kFALSE;
+    std::string config = ReadConfig("Chain-Input");
+    if(strcmp(config.c_str(), "nokey") != 0)
+    {
+        Int_t buffer=0;
+        sscanf(config.c_str(), "%d\n", &buffer);
+        chainInput  = (buffer==1);
+    }
+    if(chainInput && (HasScalerRange() || HasEventRange()))
+    {
+        cout << "#ERROR: Scaler or event ranges can not be used with Chain-Input. Files are processed one by one." << endl;
+        chainInput  = kFALSE;
+    }
+    if(chainInput && nFiles>1)
+    {
+        cout << "Chaining " << nFiles << " input files into output file " << GetOutputFile(0) << endl;
+        if(GetStagingDirectory().length() > 0)
+            cout << "Staging directory is not used with Chain-Input, the next file is prefetched instead." << endl;
+        chainFile   = 0;
+        Bool_t  ok  = StartFile(GetInputFile(0).c_str(), GetOutputFile(0).c_str());
+        if(!ok) cout << "ERROR: Failed on chain starting with file " << GetInputFile(0) << "!" << endl;
+        prefetch.Stop();
+        return ok;
+    }
+    chainInput  = kFALSE;
+
+    // with a staging directory the next input is copied to local disk while the current one
+    // is processed, and outputs are written locally and moved to their final place afterwards
+    Bool_t          ok      = kTRUE;
+    GFileStager*    stager  = 0;
+    if(GetStagingDirectory().length() > 0)
+    {
+        stager  = new GFileStager(GetStagingDirectory());
+        if(nFiles>0)
+            stager->StageIn(GetInputFile(0));
+    }
+
     for(Int_t i=0; i<nFiles; i++)
     {
         std::string inputFileName = GetInputFile(i);
         std::string outputFileName = GetOutputFile(i);
-        if(!StartFile(inputFileName.c_str(), outputFileName.c_str())) cout << "ERROR: Failed on file " << inputFileName << "!" << endl;
+        if(stager)
+        {
+            std::string localInput  = stager->WaitStageIn(inputFileName);
+            std::string localOutput = stager->GetLocalName(outputFileName);
+            if(i+1<nFiles)
+                stager->StageIn(GetInputFile(i+1));
+            if(!StartFile(localInput.c_str(), localOutput.c_str()))
+            {
+                cout << "ERROR: Failed on file " << inputFileName << "!" << endl;
+                ok  = kFALSE;
+            }
+            else stager->StageOut(localOutput, outputFileName);
+            stager->RemoveStagedIn(inputFileName);
+        }
+        else if(!StartFile(inputFileName.c_str(), outputFileName.c_str()))
+        {
+            cout << "ERROR: Failed on file " << inputFileName << "!" << endl;
+            ok  = kFALSE;
+        }
+        if(IsEventLimitReached())
+        {
+            cout << "Event limit reached after " << nEventsRead << " events read and " << nEventsAccepted << " events accepted.";
+            if(i<nFiles-1)
+                cout << " Skipping remaining " << nFiles-1-i << " files.";
+            cout << endl;
+            break;
+        }
     }
 
-    return kTRUE;
+    if(stager)
+    {
+        cout << "Waiting for outputs to be staged out..." << endl;
+        if(!stager->WaitAll())
+        {
+            cout << "#ERROR: Not all outputs could be staged out!" << endl;
+            ok  = kFALSE;
+        }
+        delete stager;
+    }
+
+    return ok;
 }
 
 Bool_t  GTreeManager::StartFile(const char* inputFileName, const char* outputFileName)
@@ -150,18 +343,18 @@ Bool_t  GTreeManager::StartFile(const char* inputFileName, const char* outputFil
 
     for(Int_t l=0; l<treeList.GetEntries(); l++)
     {
-        if(inputFile->Get(((GTree*)treeList[l])->GetName()))
-            ((GTree*)treeList[l])->OpenForInput();
+        if(inputFile->Get(treeList[l]->GetName()))
+            treeList[l]->OpenForInput();
     }
     for(Int_t l=0; l<treeCorreleatedToScalerReadList.GetEntries(); l++)
     {
-        if(inputFile->Get(((GTree*)treeCorreleatedToScalerReadList[l])->GetName()))
-            ((GTree*)treeCorreleatedToScalerReadList[l])->OpenForInput();
+        if(inputFile->Get(treeCorreleatedToScalerReadList[l]->GetName()))
+            treeCorreleatedToScalerReadList[l]->OpenForInput();
     }
     for(Int_t l=0; l<treeSingleReadList.GetEntries(); l++)
     {
-        if(inputFile->Get(((GTree*)treeSingleReadList[l])->GetName()))
-            ((GTree*)treeSingleReadList[l])->OpenForInput();
+        if(inputFile->Get(treeSingleReadList[l]->GetName()))
+            treeSingleReadList[l]->OpenForInput();
     }
 
     if(outputFile)
@@ -178,6 +371,18 @@ Bool_t  GTreeManager::StartFile(const char* inputFileName, const char* outputFil
     isWritten   = kFALSE;
     ClearLinkedHistograms();
 
+    // same seed for every file, so a sampled pass can be reproduced
+    nScalerBlocks           = 0;
+    nScalerBlocksSampled    = 0;
+    samplingRandom.SetSeed(samplingSeed);
+    inputSamplingFraction   = 1;
+    TNamed* samplingFlag    = (TNamed*)inputFile->Get("Sampling_Fraction");
+    if(samplingFlag)
+    {
+        inputSamplingFraction   = atof(samplingFlag->GetTitle());
+        cout << "Input file was sampled with a fraction of " << inputSamplingFraction << " of the scaler blocks." << endl;
+    }
+
     if(!Start())
         return kFALSE;
 
@@ -186,11 +391,11 @@ Bool_t  GTreeManager::StartFile(const char* inputFileName, const char* outputFil
     cache->Flush();
 
     for(Int_t l=0; l<treeList.GetEntries(); l++)
-        ((GTree*)treeList[l])->Close();
+        treeList[l]->Close();
     for(Int_t l=0; l<treeCorreleatedToScalerReadList.GetEntries(); l++)
-        ((GTree*)treeCorreleatedToScalerReadList[l])->Close();
+        treeCorreleatedToScalerReadList[l]->Close();
     for(Int_t l=0; l<treeSingleReadList.GetEntries(); l++)
-        ((GTree*)treeSingleReadList[l])->Close();
+        treeSingleReadList[l]->Close();
 
 
     if(inputFile)     inputFile->Close();
@@ -206,7 +411,7 @@ Bool_t  GTreeManager::Write()
     outputFile->cd();
 
     for(Int_t l=0; l<writeList.GetEntries(); l++)
-        ((GTree*)writeList[l])->Write();
+        writeList[l]->Write();
 
     TIter objectIterator(gROOT->GetList());
     TObject *object;
@@ -216,6 +421,13 @@ Bool_t  GTreeManager::Write()
         std::cout << "object " << object->GetName() << " has been written to disk." << std::endl;
     }
 
+    if(GetSamplingFraction()<1 && GetSamplingFraction()>0)
+    {
+        cout << "Sampled " << nScalerBlocksSampled << " of " << nScalerBlocks << " scaler blocks. Scale histograms by " << 1/GetSamplingFraction() << endl;
+        ScaleLinkedHistograms(1/GetSamplingFraction());
+        TNamed flag("Sampling_Fraction", Form("%.10g", GetSamplingFraction()));
+        Write(&flag);
+    }
     WriteLinkedHistograms(outputFile);
 
     isWritten   = kTRUE;
@@ -233,28 +445,125 @@ Bool_t  GTreeManager::Write(const TNamed* object)
 }
 
 
+Bool_t  GTreeManager::TraverseValidEvents()
+{
+    eventNumberOffset   = 0;
+    Bool_t  isAcqu  = IsAcquFile();
+    Bool_t  ret     = kTRUE;
+    while(kTRUE)
+    {
+        // warm up the next file of the chain while this one is processed
+        if(chainInput && chainFile+1<GetNFiles())
+            prefetch.Start(GetInputFile(chainFile+1).c_str());
+
+        if(isAcqu)
+            ret = TraverseValidEvents_AcquTreeFile();
+        else
+            ret = TraverseValidEvents_GoATTreeFile();
+
+        if(!ret || !chainInput || chainFile+1>=GetNFiles() || IsEventLimitReached())
+            break;
+
+        eventNumberOffset   = GetEventNumberEnd();
+        prefetch.Stop();
+        cout << "Prefetched " << prefetch.GetNBytesRead()/1048576 << " MB of next input file." << endl;
+        if(!OpenChainFile(chainFile+1))
+        {
+            ret = kFALSE;
+            break;
+        }
+        if(IsAcquFile() != isAcqu)
+        {
+            cout << "#ERROR: Input file " << GetInputFile(chainFile) << " is of a different type than the first file of the chain!" << endl;
+            ret = kFALSE;
+            break;
+        }
+    }
+
+    if(countScalerValid)
+    {
+        countScalerValid->SetBinContent(3, countScalerValid->GetBinContent(1) - countScalerValid->GetBinContent(2));
+        if(!Write(countScalerValid))  ret = kFALSE;
+        delete countScalerValid;
+        countScalerValid    = 0;
+    }
+    return ret;
+}
+
+// first event number behind the current input file, the offset of the next chained file
+Int_t   GTreeManager::GetEventNumberEnd()
+{
+    Int_t   end = eventNumberOffset + GetNEntries();
+    if(IsAcquFile() || !eventParameters->IsOpenForInput() || GetNEntries()==0)
+        return end;
+
+    // GoAT files keep the event numbers of their Acqu file
+    eventParameters->GetEntryFast(GetNEntries()-1);
+    if(eventNumberOffset + eventParameters->GetEventNumber() + 1 > end)
+        end = eventNumberOffset + eventParameters->GetEventNumber() + 1;
+    if(scalers->IsOpenForInput() && scalers->GetNEntries()>0)
+    {
+        scalers->GetEntryFast(scalers->GetNEntries()-1);
+        if(eventNumberOffset + scalers->GetEventNumber() > end)
+            end = eventNumberOffset + scalers->GetEventNumber();
+    }
+    return end;
+}
+
+Bool_t  GTreeManager::OpenChainFile(const Int_t index)
+{
+    if(inputFile)    inputFile->Close();
+    chainFile   = index;
+    inputFile   = TFile::Open(GetInputFile(index).c_str());
+    if(!inputFile)
+    {
+        cout << "#ERROR: Can not open input file " << GetInputFile(index) << "!" << endl;
+        return kFALSE;
+    }
+    cout << "Opened input file " << inputFile->GetName() << "!" << inputFile->GetTitle() << " (chain file " << index << ")" << endl;
+
+    // only the trees still open for input after Start() are switched to the new file
+    Bool_t  ok  = kTRUE;
+    for(Int_t l=0; l<treeList.GetEntries(); l++)
+    {
+        if(treeList[l]->IsOpenForInput())
+            ok = treeList[l]->OpenForInput() && ok;
+    }
+    for(Int_t l=0; l<treeCorreleatedToScalerReadList.GetEntries(); l++)
+    {
+        if(treeCorreleatedToScalerReadList[l]->IsOpenForInput())
+            ok = treeCorreleatedToScalerReadList[l]->OpenForInput() && ok;
+    }
+    for(Int_t l=0; l<treeSingleReadList.GetEntries(); l++)
+    {
+        if(treeSingleReadList[l]->IsOpenForInput())
+            ok = treeSingleReadList[l]->OpenForInput() && ok;
+    }
+    if(!ok)
+        cout << "#ERROR: Input file " << GetInputFile(index) << " does not contain the same trees as the first file of the chain!" << endl;
+    return ok;
+}
+
 Bool_t  GTreeManager::TraverseValidEvents_AcquTreeFile()
 {
-    for(Int_t l=0; l<readSingleReadList.GetEntriesFast(); l++)
+    // a chain is written to one output file, so the setup parameters are filled once
+    for(Int_t l=0; l<readSingleReadList.GetEntries(); l++)
     {
-        ((GTree*)readSingleReadList[l])->GetEntryFast(0);
-        ((GTree*)readSingleReadList[l])->Fill();
+        readSingleReadList[l]->GetEntryFast(0);
+        if(!chainInput || chainFile==0)
+            readSingleReadList[l]->Fill();
         if(!tagger->HasEnergy()) tagger->SetCalibration(setupParameters->GetNTagger(),setupParameters->GetTaggerPhotonEnergy());
     }
 
     if(!scalers->IsOpenForInput())
     {
         cout << "No Scaler tree available. Expect MC data. Loop over all events" << endl;
-        cout << "\tProcess events from " << 0 << " to " << GetNEntries() << "."<< endl;
-        TraverseEntries(0, GetNEntries());
-        return true;
+        return TraverseMCEvents();
     }
     if(scalers->GetNEntries()==0)
     {
         cout << "No Scaler tree available. Expect MC data. Loop over all events" << endl;
-        cout << "\tProcess events from " << 0 << " to " << GetNEntries() << "."<< endl;
-        TraverseEntries(0, GetNEntries());
-        return true;
+        return TraverseMCEvents();
     }
 
     if(scalers->GetNEntries()<2)
@@ -289,83 +598,142 @@ Bool_t  GTreeManager::TraverseValidEvents_AcquTreeFile()
         shift   = scalers->GetEventNumber() - scalers->GetEventID();
     }
 
-    outputFile->cd();
-    TH1I*   accepted    = new TH1I("CountScalerValid", "Events with correct scalers (all=0,accepted=1,rejected=2)", 3, 0, 3);
-    accepted->SetBinContent(1, GetNEntries());
+    // restrict to the requested scaler reads (the shift above always uses the full scaler tree)
+    Int_t   firstRead   = 1;
+    Int_t   lastRead    = GetNScalerEntries()-1;
+    if(GetFirstScaler()>firstRead)                          firstRead   = GetFirstScaler();
+    if(GetLastScaler()>=0 && GetLastScaler()<lastRead)      lastRead    = GetLastScaler();
+    if(firstRead>lastRead)
+    {
+        cout << "#ERROR: Scaler range " << GetFirstScaler() << " to " << GetLastScaler() << " contains no scaler reads!" << endl;
+        return kFALSE;
+    }
 
-    scalers->GetEntry(scalers->GetNEntries()-1);
-    Int_t start = scalers->GetEventNumber();
-    scalers->GetEntry(0);
-    cout << "Checking scaler reads! Valid events from " << scalers->GetEventNumber() << " to " << start << endl;
+    // a block starts at the last scaler read with a correct shift before the range
+    Int_t start;
+    scalers->GetEntryFast(0);
     start = scalers->GetEventNumber();
+    for(Int_t l=firstRead-1; l>0; l--)
+    {
+        scalers->GetEntryFast(l);
+        if(scalers->GetEventNumber() - scalers->GetEventID() == shift)
+        {
+            start = scalers->GetEventNumber();
+            break;
+        }
+    }
+
+    // counts of consecutive chunks add up to the count of the full file
+    Int_t   allMin  = 0;
+    Int_t   allMax  = GetNEntries();
+    if(HasScalerRange())
+    {
+        scalers->GetEntryFast(firstRead-1);
+        if(firstRead>1)                         allMin  = scalers->GetEventNumber();
+        scalers->GetEntryFast(lastRead);
+        if(lastRead<GetNScalerEntries()-1)      allMax  = scalers->GetEventNumber();
+    }
+
+    // accumulated over all files of a chain, written by TraverseValidEvents
+    outputFile->cd();
+    if(!countScalerValid)
+        countScalerValid    = new TH1I("CountScalerValid", "Events with correct scalers (all=0,accepted=1,rejected=2)", 3, 0, 3);
+    TH1I*   accepted    = countScalerValid;
+    Double_t    allBefore   = accepted->GetBinContent(1);
+
+    scalers->GetEntry(lastRead);
+    cout << "Checking scaler reads " << firstRead << " to " << lastRead << "! Valid events from " << start << " to " << scalers->GetEventNumber() << endl;
 
-    for(Int_t i=1; i<GetNScalerEntries(); i++)
+    for(Int_t i=firstRead; i<=lastRead; i++)
     {
-        for(Int_t l=0; l<readCorreleatedToScalerReadList.GetEntriesFast(); l++)
-            ((GTree*)readCorreleatedToScalerReadList[l])->GetEntry(i);
+        for(Int_t l=0; l<readCorreleatedToScalerReadList.GetEntries(); l++)
+            readCorreleatedToScalerReadList[l]->GetEntry(i);
         if(scalers->GetEventNumber() - scalers->GetEventID() == shift)
         {
             currentScalerEntry = i;
             accepted->SetBinContent(2, accepted->GetBinContent(2) + (scalers->GetEventNumber()-start));
+            if(!SampleScalerBlock())
+            {
+                start = scalers->GetEventNumber();
+                continue;
+            }
             TraverseEntries(start, scalers->GetEventNumber());
             ProcessScalerRead();
-            for(Int_t l=0; l<readCorreleatedToScalerReadList.GetEntriesFast(); l++)
-                ((GTree*)readCorreleatedToScalerReadList[l])->Fill();
+            scalers->SetEventNumber(scalers->GetEventNumber() + eventNumberOffset);
+            for(Int_t l=0; l<readCorreleatedToScalerReadList.GetEntries(); l++)
+                readCorreleatedToScalerReadList[l]->Fill();
+            scalers->SetEventNumber(scalers->GetEventNumber() - eventNumberOffset);
             start = scalers->GetEventNumber();
+            if(IsEventLimitReached())
+            {
+                cout << "Event limit reached. Stop at scaler read " << i << " (event " << start << ")." << endl;
+                allMax  = start;
+                break;
+            }
         }
     }
 
-    accepted->SetBinContent(3, accepted->GetBinContent(1) - accepted->GetBinContent(2));
-
-    if(!Write(accepted))  return kFALSE;
-
-    if(accepted)    delete accepted;
+    accepted->SetBinContent(1, allBefore + allMax - allMin);
     return kTRUE;
 }
 
 Bool_t  GTreeManager::TraverseValidEvents_GoATTreeFile()
 {
-    for(Int_t l=0; l<readSingleReadList.GetEntriesFast(); l++)
+    for(Int_t l=0; l<readSingleReadList.GetEntries(); l++)
     {
-        ((GTree*)readSingleReadList[l])->GetEntryFast(0);
+        readSingleReadList[l]->GetEntryFast(0);
         if(!tagger->HasEnergy()) tagger->SetCalibration(setupParameters->GetNTagger(),setupParameters->GetTaggerPhotonEnergy());
     }
 
     if(!scalers->IsOpenForInput())
     {
         cout << "No Scaler tree available. Expect MC data. Loop over all events" << endl;
-        cout << "\tProcess events from " << 0 << " to " << GetNEntries() << "."<< endl;
-        TraverseEntries(0, GetNEntries());
-        return true;
+        return TraverseMCEvents();
     }
     if(scalers->GetNEntries()==0)
     {
         cout << "No Scaler tree available. Expect MC data. Loop over all events" << endl;
-        cout << "\tProcess events from " << 0 << " to " << GetNEntries() << "."<< endl;
-        TraverseEntries(0, GetNEntries());
-        return true;
+        return TraverseMCEvents();
     }
 
     Int_t   event       = 0;
     Int_t   start       = 0;
     Int_t   maxEvent    = GetNEntries();
-    for(Int_t l=0; l<readList.GetEntriesFast(); l++)
-        ((GTree*)readList[l])->GetEntryFast(event);
+    Int_t   nScalerRead = 0;
+    Long64_t    eventsBefore    = nEventsRead;
+    for(Int_t l=0; l<readList.GetEntries(); l++)
+        readList[l]->GetEntryFast(event);
 
     cout << GetNScalerEntries() << " scaler reads. " << maxEvent << " events." << endl;
 
     for(Int_t i=0; i<GetNScalerEntries(); i++)
     {
-        for(Int_t l=0; l<readCorreleatedToScalerReadList.GetEntriesFast(); l++)
-            ((GTree*)readCorreleatedToScalerReadList[l])->GetEntry(i);
+        for(Int_t l=0; l<readCorreleatedToScalerReadList.GetEntries(); l++)
+            readCorreleatedToScalerReadList[l]->GetEntry(i);
+        if(!SampleScalerBlock())
+        {
+            // only the event numbers are read to find the next block
+            while(eventParameters->GetEventNumber()<scalers->GetEventNumber())
+            {
+                event++;
+                if(event>=maxEvent)
+                    break;
+                eventParameters->GetEntryFast(event);
+            }
+            continue;
+        }
         while(eventParameters->GetEventNumber()<scalers->GetEventNumber())
         {
             event++;
             if(event>=maxEvent)
                 break;
-            for(Int_t l=0; l<readList.GetEntriesFast(); l++)
-                ((GTree*)readList[l])->GetEntryFast(event);
+            for(Int_t l=0; l<readList.GetEntries(); l++)
+                readList[l]->GetEntryFast(event);
+            eventArena.Reset();
+            eventParameters->SetEventNumber(eventParameters->GetEventNumber() + eventNumberOffset);
             ProcessEvent();
+            eventParameters->SetEventNumber(eventParameters->GetEventNumber() - eventNumberOffset);
+            nEventsRead++;
         }
         if(i!=0)
         {
@@ -375,43 +743,85 @@ Bool_t  GTreeManager::TraverseValidEvents_GoATTreeFile()
                 start   = event;
             }
         }
+        scalers->SetEventNumber(scalers->GetEventNumber() + eventNumberOffset);
         ProcessScalerRead();
+        scalers->SetEventNumber(scalers->GetEventNumber() - eventNumberOffset);
+        nScalerRead++;
+        if(IsEventLimitReached())
+        {
+            cout << "Event limit reached. Stop at scaler read " << i << "." << endl;
+            break;
+        }
+    }
+    cout << "\t" << nScalerRead << " Scaler reads processed. Events from " << start << " to " << event << "." << endl;
+    cout << "\t" << nEventsRead - eventsBefore << " events processed." << endl;
+    return kTRUE;
+}
+
+Bool_t  GTreeManager::TraverseMCEvents()
+{
+    UInt_t  min = 0;
+    UInt_t  max = GetNEntries();
+    if(GetFirstEvent()>0)
+        min = GetFirstEvent();
+    if(GetLastEvent()>=0 && (UInt_t)GetLastEvent()<max)
+        max = GetLastEvent()+1;
+    if(min>=max)
+    {
+        cout << "#ERROR: Event range " << GetFirstEvent() << " to " << GetLastEvent() << " contains no events!" << endl;
+        return kFALSE;
     }
-    cout << "\t" << GetNScalerEntries() << " Scaler reads processed. Events from " << start << " to " << event << "." << endl;
+
+    cout << "\tProcess events from " << min << " to " << max << "."<< endl;
+    if(maxEventsAccepted<=0 && maxEventsRead<=0)
+        return TraverseEntries(min, max);
+
+    // no scaler reads in MC data, so the limit is checked after every event
+    for(UInt_t i=min; i<max; i++)
+    {
+        if(!TraverseEntries(i, i+1))
+            return kFALSE;
+        if(IsEventLimitReached())
+        {
+            cout << "Event limit reached. Stop at event " << i << "." << endl;
+            break;
+        }
+    }
+    return kTRUE;
 }
 
 UInt_t  GTreeManager::GetNEntries()       const
 {
-    for(Int_t l=1; l<readList.GetEntriesFast(); l++)
+    for(Int_t l=1; l<readList.GetEntries(); l++)
     {
-        if(((GTree*)readList[l])->GetNEntries() != ((GTree*)readList[l-1])->GetNEntries())
+        if(readList[l]->GetNEntries() != readList[l-1]->GetNEntries())
         {
             cout << "ERROR: input trees have different number of entries!"<< endl;
             return 0;
         }
     }
 
-    if(readList.GetEntriesFast() == 0)
+    if(readList.GetEntries() == 0)
         return 0;
 
-    return  ((GTree*)readList[0])->GetNEntries();
+    return  readList[0]->GetNEntries();
 }
 
 UInt_t  GTreeManager::GetNScalerEntries()       const
 {
-    for(Int_t l=1; l<readCorreleatedToScalerReadList.GetEntriesFast(); l++)
+    for(Int_t l=1; l<readCorreleatedToScalerReadList.GetEntries(); l++)
     {
-        if(((GTree*)readCorreleatedToScalerReadList[l])->GetNEntries() != ((GTree*)readCorreleatedToScalerReadList[l-1])->GetNEntries())
+        if(readCorreleatedToScalerReadList[l]->GetNEntries() != readCorreleatedToScalerReadList[l-1]->GetNEntries())
         {
             cout << "ERROR: input trees have different number of entries!"<< endl;
             return 0;
         }
     }
 
-    if(readCorreleatedToScalerReadList.GetEntriesFast() == 0)
+    if(readCorreleatedToScalerReadList.GetEntries() == 0)
         return 0;
 
-    return  ((GTree*)readCorreleatedToScalerReadList[0])->GetNEntries();
+    return  readCorreleatedToScalerReadList[0]->GetNEntries();
 }
 
 void    GTreeManager::SetAsGoATFile()
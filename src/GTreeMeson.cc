@@ -3,16 +3,14 @@
 
 
 GTreeMeson::GTreeMeson(GTreeManager *Manager, const TString& _Name)    :
-    GTreeParticle(Manager, _Name)
+    GTreeParticle(Manager, _Name),
+    hasFit(kFALSE),
+    pdgPhoton(Manager->pdgDB->GetParticle("gamma")->PdgCode()),
+    pdgChargedPion(Manager->pdgDB->GetParticle("pi+")->PdgCode())
 {
-    for(Int_t i=0; i<GTreeTrack_MAX; i++)
-    {
-        nSubParticles[i]  = 0;
-        nSubRootinos[i]   = 0;
-        nSubPhotons[i]    = 0;
-        nSubChargedPions[i]  = 0;
-        trackIndex[i]     = 0;
-    }
+    GTreeMeson_COLUMNS(GTREE_RESERVE_COLUMN, capacity)
+    GTreeMeson_FIT_COLUMNS(GTREE_RESERVE_COLUMN, capacity)
+    trackIndex.Fill(0);
 }
 
 GTreeMeson::~GTreeMeson()
@@ -27,33 +25,89 @@ void    GTreeMeson::Clear()
 void    GTreeMeson::SetBranchAdresses()
 {
     GTreeParticle::SetBranchAdresses();
-    inputTree->SetBranchAddress("nSubParticles", nSubParticles);
-    inputTree->SetBranchAddress("nSubRootinos", nSubRootinos);
-    inputTree->SetBranchAddress("nSubPhotons", nSubPhotons);
-    inputTree->SetBranchAddress("nSubChargedPions", nSubChargedPions);
+    GTreeMeson_COLUMNS(GTREE_BIND_COLUMN, inputTree)
+    if(inputTree->GetBranch("fitChi2"))
+    {
+        GTreeMeson_FIT_COLUMNS(GTREE_BIND_COLUMN, inputTree)
+        hasFit = kTRUE;
+    }
 }
 
 void    GTreeMeson::SetBranches()
 {
     GTreeParticle::SetBranches();
-    outputTree->Branch("nSubParticles", nSubParticles, "nSubParticles[nParticles]/I");
-    outputTree->Branch("nSubRootinos", nSubRootinos,"nSubRootinos[nParticles]/I");
-    outputTree->Branch("nSubPhotons", nSubPhotons,"nSubParticles[nParticles]/I");
-    outputTree->Branch("nSubChargedPions", nSubChargedPions,"nSubParticles[nParticles]/I");
+    GTreeMeson_COLUMNS(GTREE_BRANCH_COLUMN, "nParticles")
+    if(hasFit)
+    {
+        GTreeMeson_FIT_COLUMNS(GTREE_BRANCH_COLUMN, "nParticles")
+    }
+}
+
+void    GTreeMeson::SetOutputAddresses()
+{
+    GTreeParticle::SetOutputAddresses();
+    GTreeMeson_COLUMNS(GTREE_OUTPUT_COLUMN, outputTree)
+    if(hasFit)
+    {
+        GTreeMeson_FIT_COLUMNS(GTREE_OUTPUT_COLUMN, outputTree)
+    }
+}
+
+void    GTreeMeson::ReserveColumns(const Int_t n)
+{
+    GTreeParticle::ReserveColumns(n);
+    GTreeMeson_COLUMNS(GTREE_RESERVE_COLUMN, n)
+    GTreeMeson_FIT_COLUMNS(GTREE_RESERVE_COLUMN, n)
 }
 
-void    GTreeMeson::AddParticle(const Int_t _NSubRootinos, const Int_t _NSubPhotons, const Int_t _NSubChargedPions, Int_t* subParticles_index, TLorentzVector* subParticles_list)
+void    GTreeMeson::ConvertInput()
 {
+    GTreeParticle::ConvertInput();
+    if(hasFit)
+    {
+        GTreeMeson_FIT_COLUMNS(GTREE_CONVERT_COLUMN, nParticles)
+    }
+}
+
+void    GTreeMeson::ResetFit(const Int_t meson)
+{
+    fitChi2[meson]          = -1;
+    fitPullEnergy0[meson]   = 0;
+    fitPullTheta0[meson]    = 0;
+    fitPullPhi0[meson]      = 0;
+    fitPullEnergy1[meson]   = 0;
+    fitPullTheta1[meson]    = 0;
+    fitPullPhi1[meson]      = 0;
+    fitEventChi2[meson]     = -1;
+    fitEventTagger[meson]   = -1;
+}
+
+// pulls of energy, theta and phi of the sub particle with the lower, then
+// of the one with the higher track index
+void    GTreeMeson::SetFit(const Int_t meson, const Double_t chi2, const Double_t* pulls)
+{
+    fitChi2[meson]          = chi2;
+    fitPullEnergy0[meson]   = pulls[0];
+    fitPullTheta0[meson]    = pulls[1];
+    fitPullPhi0[meson]      = pulls[2];
+    fitPullEnergy1[meson]   = pulls[3];
+    fitPullTheta1[meson]    = pulls[4];
+    fitPullPhi1[meson]      = pulls[5];
+}
+
+void    GTreeMeson::AddParticle(const Int_t _NSubRootinos, const Int_t _NSubPhotons, const Int_t _NSubChargedPions, Int_t* subParticles_index, const GP4* subParticles_list)
+{
+    Reserve(nParticles+1);
     nSubParticles[nParticles]  = _NSubRootinos + _NSubPhotons + _NSubChargedPions;
     nSubRootinos[nParticles]   = _NSubRootinos;
     nSubPhotons[nParticles]    = _NSubPhotons;
     nSubChargedPions[nParticles]  = _NSubChargedPions;
 
-    TLorentzVector sum;
+    GP4 total;
 
     for(Int_t i=0; i<_NSubRootinos; i++)
     {
-        sum += subParticles_list[i];
+        total += subParticles_list[i];
         detectors[nParticles]    = detectors[nParticles] | manager->rootinos->GetDetectors(subParticles_index[i]);
         time[nParticles]         += manager->rootinos->GetTime(subParticles_index[i]);
         clusterSize[nParticles]  += manager->rootinos->GetClusterSize(subParticles_index[i]);
@@ -64,7 +118,7 @@ void    GTreeMeson::AddParticle(const Int_t _NSubRootinos, const Int_t _NSubPhot
     }
     for(Int_t i=_NSubRootinos; i<_NSubRootinos+_NSubPhotons; i++)
     {
-        sum += subParticles_list[i];
+        total += subParticles_list[i];
         detectors[nParticles]    = detectors[nParticles] | manager->photons->GetDetectors(subParticles_index[i]);
         time[nParticles]         += manager->photons->GetTime(subParticles_index[i]);
         clusterSize[nParticles]  += manager->photons->GetClusterSize(subParticles_index[i]);
@@ -75,7 +129,7 @@ void    GTreeMeson::AddParticle(const Int_t _NSubRootinos, const Int_t _NSubPhot
     }
     for(Int_t i=_NSubRootinos+_NSubPhotons; i<_NSubRootinos+_NSubPhotons+_NSubChargedPions; i++)
     {
-        sum += subParticles_list[i];
+        total += subParticles_list[i];
         detectors[nParticles]    = detectors[nParticles] | manager->chargedPions->GetDetectors(subParticles_index[i]);
         time[nParticles]         += manager->chargedPions->GetTime(subParticles_index[i]);
         clusterSize[nParticles]  += manager->chargedPions->GetClusterSize(subParticles_index[i]);
@@ -85,26 +139,30 @@ void    GTreeMeson::AddParticle(const Int_t _NSubRootinos, const Int_t _NSubPhot
         trackIndex[nParticles]   += 1<<(manager->chargedPions->GetTrackIndex(subParticles_index[i]));
     }
 
+    TLorentzVector sum = total.ToTLorentzVector();
     clusterEnergy[nParticles] = sum.E()-sum.M();
     theta[nParticles] = sum.Theta()*TMath::RadToDeg();
     phi[nParticles] = sum.Phi()*TMath::RadToDeg();
     mass[nParticles] = sum.M();
     time[nParticles]         /= nSubParticles[nParticles];
+    ResetFit(nParticles);
     nParticles++;
+    Modified();
     manager->countReconstructed++;
 }
 
 
-void    GTreeMeson::AddParticle(const Int_t subParticle_index0, const TLorentzVector subParticle0, const Int_t pdg0, const Int_t subParticle_index1, const TLorentzVector subParticle1, const Int_t pdg1)
+void    GTreeMeson::AddParticle(const Int_t subParticle_index0, const GP4& subParticle0, const Int_t pdg0, const Int_t subParticle_index1, const GP4& subParticle1, const Int_t pdg1)
 {
+    Reserve(nParticles+1);
     nSubParticles[nParticles]  = 2;
     nSubRootinos[nParticles]   = 0;
     nSubPhotons[nParticles]    = 0;
     nSubChargedPions[nParticles]  = 0;
 
-    TLorentzVector sum = subParticle0 + subParticle1;
+    TLorentzVector sum = (subParticle0 + subParticle1).ToTLorentzVector();
 
-    if(pdg0 == manager->pdgDB->GetParticle("gamma")->PdgCode())
+    if(pdg0 == pdgPhoton)
     {
         detectors[nParticles]    = manager->photons->GetDetectors(subParticle_index0);
         time[nParticles]         = manager->photons->GetTime(subParticle_index0);
@@ -115,7 +173,7 @@ void    GTreeMeson::AddParticle(const Int_t subParticle_index0, const TLorentzVe
         trackIndex[nParticles]   = 1<<(manager->photons->GetTrackIndex(subParticle_index0));
         nSubPhotons[nParticles]++;
     }
-    else if(pdg0 == manager->pdgDB->GetParticle("pi+")->PdgCode())
+    else if(pdg0 == pdgChargedPion)
     {
         detectors[nParticles]    = manager->chargedPions->GetDetectors(subParticle_index0);
         time[nParticles]         = manager->chargedPions->GetTime(subParticle_index0);
@@ -138,7 +196,7 @@ void    GTreeMeson::AddParticle(const Int_t subParticle_index0, const TLorentzVe
         nSubRootinos[nParticles]++;
     }
     
-    if(pdg1 == manager->pdgDB->GetParticle("gamma")->PdgCode())
+    if(pdg1 == pdgPhoton)
     {
         detectors[nParticles]    = detectors[nParticles] | manager->photons->GetDetectors(subParticle_index1);
         time[nParticles]         += manager->photons->GetTime(subParticle_index1);
@@ -149,7 +207,7 @@ void    GTreeMeson::AddParticle(const Int_t subParticle_index0, const TLorentzVe
         trackIndex[nParticles]   += 1<<(manager->photons->GetTrackIndex(subParticle_index1));
         nSubPhotons[nParticles]++;
     }
-    else if(pdg1 == manager->pdgDB->GetParticle("pi+")->PdgCode())
+    else if(pdg1 == pdgChargedPion)
     {
         detectors[nParticles]    = detectors[nParticles] | manager->chargedPions->GetDetectors(subParticle_index1);
         time[nParticles]         += manager->chargedPions->GetTime(subParticle_index1);
@@ -177,7 +235,9 @@ void    GTreeMeson::AddParticle(const Int_t subParticle_index0, const TLorentzVe
     phi[nParticles] = sum.Phi()*TMath::RadToDeg();
     mass[nParticles] = sum.M();
     time[nParticles]         /= 2;
+    ResetFit(nParticles);
     nParticles++;
+    Modified();
     manager->countReconstructed++;
 }
 
@@ -192,8 +252,3 @@ void    GTreeMeson::Print() const
         cout << "nSubParticles: " << nSubParticles[i] << "   nSubRootinos: " << nSubRootinos[i] << "   nSubPhotons: " << nSubPhotons[i] << "   nSubChargedPions: " << nSubChargedPions[i] << endl;
     }
 }
-
-Int_t               nSubParticles[GTreeTrack_MAX];
-Int_t               nSubRootinos[GTreeTrack_MAX];
-Int_t               nSubPhotons[GTreeTrack_MAX];
-Int_t               nSubChargedPions[GTreeTrack_MAX];
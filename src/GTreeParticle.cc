@@ -7,14 +7,12 @@ using namespace std;
 
 
 GTreeParticle::GTreeParticle(GTreeManager *Manager, const TString& _Name)    :
-    GTreeTrack(Manager,_Name),
-    nParticles(0)
+    GTreeTrack(Manager,_Name,kFALSE),
+    nParticles(0),
+    source(0)
 {
-    for(Int_t i=0; i<GTreeTrack_MAX; i++)
-    {
-        mass[i]       = 0;
-        trackIndex[i] = -1;
-    }
+    trackIndex.Fill(-1);
+    Reserve(GTreeTrack_INITIAL);
 }
 
 GTreeParticle::~GTreeParticle()
@@ -23,39 +21,38 @@ GTreeParticle::~GTreeParticle()
 
 void    GTreeParticle::SetBranchAdresses()
 {
+    source  = 0;
+    ReserveFromInput("nParticles");
     inputTree->SetBranchAddress("nParticles",&nParticles);
-    inputTree->SetBranchAddress("clusterEnergy",  clusterEnergy);
-    inputTree->SetBranchAddress("theta", theta);
-    inputTree->SetBranchAddress("phi",  phi);
-    inputTree->SetBranchAddress("mass", mass);
-    inputTree->SetBranchAddress("time", time);
-    inputTree->SetBranchAddress("clusterSize", clusterSize);
-    inputTree->SetBranchAddress("centralCrystal", centralCrystal);
-    inputTree->SetBranchAddress("centralVeto", centralVeto);
-    inputTree->SetBranchAddress("detectors", detectors);
-    inputTree->SetBranchAddress("vetoEnergy", vetoEnergy);
-    inputTree->SetBranchAddress("MWPC0Energy", MWPC0Energy);
-    inputTree->SetBranchAddress("MWPC1Energy", MWPC1Energy);
-    inputTree->SetBranchAddress("trackIndex", trackIndex);
+    GTreeTrack_COLUMNS(GTREE_BIND_COLUMN, inputTree)
+    GTreeParticle_COLUMNS(GTREE_BIND_COLUMN, inputTree)
 }
 
 void    GTreeParticle::SetBranches()
 {
     outputTree->Branch("nParticles",&nParticles, "nParticles/I");
-    outputTree->Branch("clusterEnergy", clusterEnergy, "clusterEnergy[nParticles]/D");
-    outputTree->Branch("theta", theta, "theta[nParticles]/D");
-    outputTree->Branch("phi", phi, "phi[nParticles]/D");
-    outputTree->Branch("mass", mass, "mass[nParticles]/D");
-    outputTree->Branch("time", time, "time[nParticles]/D");
-    outputTree->Branch("clusterSize", clusterSize, "clusterSize[nParticles]/I");
-    outputTree->Branch("centralCrystal", centralCrystal, "centralCrystal[nParticles]/I");
-    outputTree->Branch("centralVeto", centralVeto, "centralVeto[nParticles]/I");
-    outputTree->Branch("detectors", detectors, "detectors[nParticles]/I");
-    outputTree->Branch("vetoEnergy", vetoEnergy, "vetoEnergy[nParticles]/D");
-    outputTree->Branch("MWPC0Energy", MWPC0Energy, "MWPC0Energy[nParticles]/D");
-    outputTree->Branch("MWPC1Energy", MWPC1Energy, "MWPC1Energy[nParticles]/D");
-    outputTree->Branch("trackIndex", trackIndex, "trackIndex[nParticles]/I");
+    GTreeTrack_COLUMNS(GTREE_BRANCH_COLUMN, "nParticles")
+    GTreeParticle_COLUMNS(GTREE_BRANCH_COLUMN, "nParticles")
+}
 
+void    GTreeParticle::SetOutputAddresses()
+{
+    GTreeTrack_COLUMNS(GTREE_OUTPUT_COLUMN, outputTree)
+    GTreeParticle_COLUMNS(GTREE_OUTPUT_COLUMN, outputTree)
+}
+
+void    GTreeParticle::ReserveColumns(const Int_t n)
+{
+    // the pseudo vertex columns are not part of particle trees
+    GTreeTrack_COLUMNS(GTREE_RESERVE_COLUMN, n)
+    GTreeParticle_COLUMNS(GTREE_RESERVE_COLUMN, n)
+    ReserveKinematics(n);
+}
+
+void    GTreeParticle::ConvertInput()
+{
+    GTreeTrack_COLUMNS(GTREE_CONVERT_COLUMN, nParticles)
+    GTreeParticle_COLUMNS(GTREE_CONVERT_COLUMN, nParticles)
 }
 
 
@@ -82,6 +79,8 @@ Bool_t	GTreeParticle::Write()
 
 void    GTreeParticle::AddParticle(const Double_t _clusterEnergy, const Double_t _theta, const Double_t _phi, const Double_t _mass, const Double_t _time, const Int_t _clusterSize, const Int_t _centralCrystal, const Int_t _centralVeto, const Int_t _detectors, const Double_t _vetoEnergy, const Double_t _MWPC0Energy, const Double_t _MWPC1Energy, const Int_t _trackIndex)
 {
+    Materialise();
+    Reserve(nParticles+1);
     clusterEnergy[nParticles]  = _clusterEnergy;
     theta[nParticles]          = _theta;
     phi[nParticles]            = _phi;
@@ -96,10 +95,46 @@ void    GTreeParticle::AddParticle(const Double_t _clusterEnergy, const Double_t
     MWPC1Energy[nParticles]    = _MWPC1Energy;
     trackIndex[nParticles]     = _trackIndex;
     nParticles++;
+    Modified();
     manager->countReconstructed++;
 }
 
 
+void    GTreeParticle::AddTrack(const GTreeTrack* tracks, const Int_t track, const Double_t _mass)
+{
+    if(nParticles>0 && source!=tracks)
+    {
+        // appending to copied particles or to a view of other tracks
+        AddParticle(tracks->GetClusterEnergy(track), tracks->GetTheta(track), tracks->GetPhi(track), _mass, tracks->GetTime(track), tracks->GetClusterSize(track), tracks->GetCentralCrystal(track), tracks->GetCentralVeto(track), tracks->GetDetectors(track), tracks->GetVetoEnergy(track), tracks->GetMWPC0Energy(track), tracks->GetMWPC1Energy(track), track);
+        return;
+    }
+    Reserve(nParticles+1);
+    source                  = tracks;
+    mass[nParticles]        = _mass;
+    trackIndex[nParticles]  = track;
+    nParticles++;
+    Modified();
+    manager->countReconstructed++;
+}
+
+#define GTREE_COPY_FROM_TRACK(INDEX, TYPE, NAME)    self->NAME[i] = tracks->NAME[INDEX];
+
+void    GTreeParticle::Materialise() const
+{
+    if(!source)
+        return;
+
+    GTreeParticle*      self    = const_cast<GTreeParticle*>(this);
+    const GTreeTrack*   tracks  = source;
+    self->source    = 0;
+    for(Int_t i=0; i<nParticles; i++)
+    {
+        Int_t   t   = trackIndex[i];
+        GTreeTrack_COLUMNS(GTREE_COPY_FROM_TRACK, t)
+    }
+}
+
+
 void    GTreeParticle::RemoveAllParticles()
 {
     manager->countReconstructed -= nParticles;
@@ -109,12 +144,17 @@ void    GTreeParticle::RemoveAllParticles()
 
 void    GTreeParticle::RemoveParticles(const Int_t nIndices, const Int_t* indices)
 {
-    Int_t*  sort    = new Int_t[nIndices];
+    Int_t*  sort    = manager->eventArena.Alloc<Int_t>(nIndices);
     TMath::Sort(nIndices, indices, sort);
     for(Int_t i=0; i<nIndices; i++)
     {
         nParticles--;
-        if(sort[i] != nParticles)
+        if(sort[i] != nParticles && source)
+        {
+            mass[sort[i]]           = mass[nParticles];
+            trackIndex[sort[i]]     = trackIndex[nParticles];
+        }
+        else if(sort[i] != nParticles)
         {
             clusterEnergy[sort[i]]  = clusterEnergy[nParticles];
             theta[sort[i]]          = theta[nParticles];
@@ -132,6 +172,7 @@ void    GTreeParticle::RemoveParticles(const Int_t nIndices, const Int_t* indice
         }
     }
     manager->countReconstructed -= nIndices;
+    Modified();
 }
 
 
@@ -139,8 +180,8 @@ void    GTreeParticle::PrintParticle(const Int_t i) const
 {
     cout << "\tParticle " << i << ": " << endl;
     cout << "\tPx: " << Particle(i).Px() << "   Py: " << Particle(i).Py() << "   Pz: " << Particle(i).Pz() << "   E: " << Particle(i).E() << endl;
-    cout << "\tDetectors: " << detectors[i] << "   clusterSize: " << clusterSize[i]  << endl;
-    cout << "\tvetoEnergy: " << vetoEnergy[i] << "   MWPC0Energy: " << MWPC0Energy[i] << "   MWPC1Energy: " << MWPC1Energy[i]  << endl;
+    cout << "\tDetectors: " << GetDetectors(i) << "   clusterSize: " << GetClusterSize(i)  << endl;
+    cout << "\tvetoEnergy: " << GetVetoEnergy(i) << "   MWPC0Energy: " << GetMWPC0Energy(i) << "   MWPC1Energy: " << GetMWPC1Energy(i)  << endl;
 }
 
 void    GTreeParticle::Print() const
@@ -0,0 +1,97 @@
+#include "GTreeRegistry.h"
+
+#include <iostream>
+#include <stdlib.h>
+
+using namespace std;
+
+
+void    GTreeSet::Set(GTree* const* slots, ULong64_t mask)
+{
+    nTrees  = 0;
+    while(mask)
+    {
+        Int_t   slot    = __builtin_ctzll(mask);
+        trees[nTrees++] = slots[slot];
+        mask    &= mask - 1;
+    }
+}
+
+
+
+GTreeRegistry::GTreeRegistry()  :
+    usedMask(0),
+    readMask(0),
+    writeMask(0)
+{
+    for(Int_t i=0; i<GTreeRegistry_MAX; i++)
+        slots[i]    = 0;
+    for(Int_t k=0; k<KIND_COUNT; k++)
+        kindMask[k] = 0;
+}
+
+void    GTreeRegistry::Update()
+{
+    for(Int_t k=0; k<KIND_COUNT; k++)
+    {
+        trees[k].Set(slots, kindMask[k]);
+        read[k].Set(slots, kindMask[k] & readMask);
+    }
+    write.Set(slots, writeMask);
+}
+
+Int_t   GTreeRegistry::Add(GTree* tree, const Int_t kind)
+{
+    // an unregistered tree would silently be neither read nor written
+    if(~usedMask == 0)
+    {
+        cout << "#ERROR: GTreeRegistry: more than " << GTreeRegistry_MAX << " trees. Raise GTreeRegistry_MAX." << endl;
+        exit(1);
+    }
+    Int_t   slot    = __builtin_ctzll(~usedMask);
+    slots[slot]     = tree;
+    usedMask        |= 1ULL << slot;
+    kindMask[kind]  |= 1ULL << slot;
+    Update();
+    return slot;
+}
+
+void    GTreeRegistry::Remove(const Int_t slot)
+{
+    if(slot < 0)
+        return;
+    ULong64_t   clear   = ~(1ULL << slot);
+    usedMask    &= clear;
+    readMask    &= clear;
+    writeMask   &= clear;
+    for(Int_t k=0; k<KIND_COUNT; k++)
+        kindMask[k] &= clear;
+    slots[slot] = 0;
+    Update();
+}
+
+void    GTreeRegistry::SetRead(const Int_t slot, const Bool_t on)
+{
+    if(slot < 0)
+        return;
+    ULong64_t   old = readMask;
+    if(on)
+        readMask    |= 1ULL << slot;
+    else
+        readMask    &= ~(1ULL << slot);
+    if(readMask != old)
+        Update();
+}
+
+void    GTreeRegistry::SetWrite(const Int_t slot, const Bool_t on)
+{
+    if(slot < 0)
+        return;
+    ULong64_t   old = writeMask;
+    if(on)
+        writeMask   |= 1ULL << slot;
+    else
+        writeMask   &= ~(1ULL << slot);
+    if(writeMask != old)
+        Update();
+}
@@ -9,8 +9,7 @@ GTreeScaler::GTreeScaler(GTreeManager *Manager)    :
     eventID(0),
     nScalers(0)
 {
-    for(Int_t i=0; i<GTreeScaler_MAX; i++)
-        scalers[i] = 0;
+    scalers.Reserve(1);
 }
 
 GTreeScaler::~GTreeScaler()
@@ -23,17 +22,16 @@ void    GTreeScaler::SetBranchAdresses()
     inputTree->SetBranchAddress("eventNumber", &eventNumber);
     inputTree->SetBranchAddress("eventID", &eventID);
     nScalers = inputTree->GetLeaf("scalers")->GetLen();
-    if(nScalers<=GTreeScaler_MAX)
-        inputTree->SetBranchAddress("scalers", scalers);
+    scalers.Reserve(nScalers);
+    scalers.SetBranchAddress(inputTree, "scalers");
 }
 
 void    GTreeScaler::SetBranches()
 {
     outputTree->Branch("eventNumber", &eventNumber, "eventNumber/I");
     outputTree->Branch("eventID", &eventID, "eventID/I");
-    Char_t str[256];
-    sprintf(str, "scalers[%d]/i", nScalers);
-    outputTree->Branch("scalers", scalers, str);
+    scalers.Reserve(nScalers);
+    scalers.Branch(outputTree, "scalers", TString::Format("%d", nScalers));
 }
 
 
@@ -60,10 +58,12 @@ UInt_t  GTreeScaler::GetScalerEntry(const Int_t number)
 void    GTreeScaler::SetNScalers(const Int_t number)
 {
     nScalers = number;
-    if(nScalers>GTreeScaler_MAX)
+    if(scalers.Reserve(nScalers))
     {
-        std::cout << "#ERROR# GTreeScaler::SetNScaler(const Int_t num): Can not handle " << number << " Scalers! Set to max (" << GTreeScaler_MAX << ")." << std::endl;
-        nScalers = GTreeScaler_MAX;
+        if(IsOpenForInput())
+            scalers.SetBranchAddress(inputTree, "scalers");
+        if(IsOpenForOutput())
+            scalers.SetOutputAddress(outputTree, "scalers");
     }
 }
 
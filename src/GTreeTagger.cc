@@ -6,12 +6,7 @@ GTreeTagger::GTreeTagger(GTreeManager *Manager)    :
     nTagged(0),
     hasEnergy(0)
 {
-    for(Int_t i=0; i<GTreeTagger_MAX; i++)
-    {
-        taggedChannel[i] = 0;
-        taggedTime[i]    = 0;
-        taggedEnergy[i]  = 0;
-    }
+    Reserve(GTreeTagger_INITIAL);
     for(Int_t i=0; i<352; i++) calibration[i] = 0;
 }
 
@@ -22,12 +17,12 @@ GTreeTagger::~GTreeTagger()
 
 void    GTreeTagger::SetBranchAdresses()
 {
+    ReserveFromInput("nTagged");
     inputTree->SetBranchAddress("nTagged", 	   &nTagged);
-    inputTree->SetBranchAddress("taggedChannel", taggedChannel);
-    inputTree->SetBranchAddress("taggedTime",    taggedTime);
+    GTreeTagger_COLUMNS(GTREE_BIND_COLUMN, inputTree)
     if(inputTree->GetBranch("taggedEnergy"))
     {
-        inputTree->SetBranchAddress("taggedEnergy",  taggedEnergy);
+        convertInput |= taggedEnergy.SetBranchAddress(inputTree, "taggedEnergy");
         hasEnergy = true;
     }
 
@@ -36,9 +31,26 @@ void    GTreeTagger::SetBranchAdresses()
 void    GTreeTagger::SetBranches()
 {
     outputTree->Branch("nTagged",       &nTagged,      "nTagged/I");
-    outputTree->Branch("taggedChannel", taggedChannel, "taggedChannel[nTagged]/I");
-    outputTree->Branch("taggedTime",    taggedTime,    "taggedTime[nTagged]/D");
-    if(hasEnergy) outputTree->Branch("taggedEnergy",  taggedEnergy,  "taggedEnergy[nTagged]/D");
+    GTreeTagger_COLUMNS(GTREE_BRANCH_COLUMN, "nTagged")
+    if(hasEnergy) taggedEnergy.Branch(outputTree, "taggedEnergy", "nTagged");
+}
+
+void    GTreeTagger::SetOutputAddresses()
+{
+    GTreeTagger_COLUMNS(GTREE_OUTPUT_COLUMN, outputTree)
+    if(hasEnergy) taggedEnergy.SetOutputAddress(outputTree, "taggedEnergy");
+}
+
+void    GTreeTagger::ReserveColumns(const Int_t n)
+{
+    GTreeTagger_COLUMNS(GTREE_RESERVE_COLUMN, n)
+    taggedEnergy.Reserve(n);
+}
+
+void    GTreeTagger::ConvertInput()
+{
+    GTreeTagger_COLUMNS(GTREE_CONVERT_COLUMN, nTagged)
+    if(hasEnergy) taggedEnergy.Convert(nTagged);
 }
 
 void    GTreeTagger::SetCalibration(const Int_t nChan, const Double_t *energy)
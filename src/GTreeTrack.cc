@@ -1,67 +1,126 @@
 #include "GTreeTrack.h"
 
-GTreeTrack::GTreeTrack(GTreeManager *Manager, const TString& _Name)    :
+// Derived trees pass reserve = kFALSE and reserve in their own
+// constructor, ReserveColumns called here would not reach their override.
+GTreeTrack::GTreeTrack(GTreeManager *Manager, const TString& _Name, const Bool_t reserve)    :
     GTree(Manager,_Name),
-    nTracks(0)
+    nTracks(0),
+    kinematics(0)
 {
-    for(Int_t i=0; i<GTreeTrack_MAX; i++)
-    {
-        clusterEnergy[i] = 0;
-        theta[i] = 0;
-        phi[i] = 0;
-        time[i] = 0;
-        clusterSize[i] = 0;
-        centralCrystal[i] = -1;
-        centralVeto[i] = -1;
-        detectors[i] = 0;
-        //Charged detector energies
-        vetoEnergy[i] = 0;
-        MWPC0Energy[i] = 0;
-        MWPC1Energy[i] = 0;
-    }
+    centralCrystal.Fill(-1);
+    centralVeto.Fill(-1);
+    if(reserve)
+        Reserve(GTreeTrack_INITIAL);
 }
 
 GTreeTrack::~GTreeTrack()
 {
-
+    free(kinematics);
 }
 
 void    GTreeTrack::SetBranchAdresses()
 {
+    ReserveFromInput("nTracks");
     inputTree->SetBranchAddress("nTracks",&nTracks);
-    inputTree->SetBranchAddress("clusterEnergy",  clusterEnergy);
-    inputTree->SetBranchAddress("theta", theta);
-    inputTree->SetBranchAddress("phi",  phi);
-    inputTree->SetBranchAddress("time", time);
-    inputTree->SetBranchAddress("clusterSize", clusterSize);
-    inputTree->SetBranchAddress("centralCrystal", centralCrystal);
-    inputTree->SetBranchAddress("centralVeto", centralVeto);
-    inputTree->SetBranchAddress("detectors", detectors);
-    inputTree->SetBranchAddress("vetoEnergy", vetoEnergy);
-    inputTree->SetBranchAddress("MWPC0Energy", MWPC0Energy);
-    inputTree->SetBranchAddress("MWPC1Energy", MWPC1Energy);
-    inputTree->SetBranchAddress("pseudoVertexX", pseudoVertexX);
-    inputTree->SetBranchAddress("pseudoVertexY", pseudoVertexY);
-    inputTree->SetBranchAddress("pseudoVertexZ", pseudoVertexZ);
+    GTreeTrack_COLUMNS(GTREE_BIND_COLUMN, inputTree)
+    GTreeTrack_VERTEX_COLUMNS(GTREE_BIND_COLUMN, inputTree)
 }
 
 void    GTreeTrack::SetBranches()
 {
     outputTree->Branch("nTracks",&nTracks,"nTracks/I");
-    outputTree->Branch("clusterEnergy",  clusterEnergy,  "clusterEnergy[nTracks]/D");
-    outputTree->Branch("theta",  theta,  "theta[nTracks]/D");
-    outputTree->Branch("phi",  phi,  "phi[nTracks]/D");
-    outputTree->Branch("time", time, "time[nTracks]/D");
-    outputTree->Branch("clusterSize", clusterSize, "clusterSize[nTracks]/I");
-    outputTree->Branch("centralCrystal", centralCrystal, "centralCrystal[nTracks]/I");
-    outputTree->Branch("centralVeto", centralVeto, "centralVeto[nTracks]/I");
-    outputTree->Branch("detectors", detectors, "detectors[nTracks]/I");
-    outputTree->Branch("vetoEnergy", vetoEnergy, "vetoEnergy[nTracks]/D");
-    outputTree->Branch("MWPC0Energy", MWPC0Energy, "MWPC0Energy[nTracks]/D");
-    outputTree->Branch("MWPC1Energy", MWPC1Energy, "MWPC1Energy[nTracks]/D");
-    outputTree->Branch("pseudoVertexX", pseudoVertexX, "pseudoVertexX[nTracks]/D");
-    outputTree->Branch("pseudoVertexY", pseudoVertexY, "pseudoVertexY[nTracks]/D");
-    outputTree->Branch("pseudoVertexZ", pseudoVertexZ, "pseudoVertexZ[nTracks]/D");
+    GTreeTrack_COLUMNS(GTREE_BRANCH_COLUMN, "nTracks")
+    GTreeTrack_VERTEX_COLUMNS(GTREE_BRANCH_COLUMN, "nTracks")
+}
+
+void    GTreeTrack::SetOutputAddresses()
+{
+    GTreeTrack_COLUMNS(GTREE_OUTPUT_COLUMN, outputTree)
+    GTreeTrack_VERTEX_COLUMNS(GTREE_OUTPUT_COLUMN, outputTree)
+}
+
+void    GTreeTrack::ReserveColumns(const Int_t n)
+{
+    GTreeTrack_COLUMNS(GTREE_RESERVE_COLUMN, n)
+    GTreeTrack_VERTEX_COLUMNS(GTREE_RESERVE_COLUMN, n)
+    ReserveKinematics(n);
+}
+
+void    GTreeTrack::ReserveKinematics(const Int_t n)
+{
+    // the cache is rebuilt on demand, so nothing has to be copied
+    free(kinematics);
+    kinematics  = GTreeColumnAlloc<Kinematics>(n);
+    for(Int_t i=0; i<n; i++)
+    {
+        kinematics[i].directionGeneration   = generation - 1;
+        kinematics[i].p4Generation          = generation - 1;
+    }
+}
+
+// Adds the cluster of track from to track into, e.g. a split-off, and
+// removes track from. The direction is the energy weighted mean, time
+// and central crystal stay the ones of track into.
+void    GTreeTrack::MergeTrack(const Int_t into, const Int_t from)
+{
+    const Double_t  e0  = clusterEnergy[into];
+    const Double_t  e1  = clusterEnergy[from];
+    const GP4       u0  = GetDirection(into);
+    const GP4       u1  = GetDirection(from);
+    const Double_t  x   = e0*u0.px + e1*u1.px;
+    const Double_t  y   = e0*u0.py + e1*u1.py;
+    const Double_t  z   = e0*u0.pz + e1*u1.pz;
+
+    clusterEnergy[into] = e0 + e1;
+    theta[into]         = TMath::ATan2(TMath::Sqrt(x*x + y*y), z) * TMath::RadToDeg();
+    phi[into]           = TMath::ATan2(y, x) * TMath::RadToDeg();
+    clusterSize[into]   += clusterSize[from];
+    detectors[into]     |= detectors[from];
+    if(vetoEnergy[into] == 0)
+    {
+        vetoEnergy[into]    = vetoEnergy[from];
+        centralVeto[into]   = centralVeto[from];
+    }
+    if(MWPC0Energy[into] == 0)  MWPC0Energy[into]   = MWPC0Energy[from];
+    if(MWPC1Energy[into] == 0)  MWPC1Energy[into]   = MWPC1Energy[from];
+
+    for(Int_t i=from; i<nTracks-1; i++)
+    {
+        GTreeTrack_COLUMNS(GTREE_SHIFT_COLUMN, i)
+        GTreeTrack_VERTEX_COLUMNS(GTREE_SHIFT_COLUMN, i)
+    }
+    nTracks--;
+    Modified();
+}
+
+#define GTREETRACK_COPY_COLUMN(INDEX, TYPE, NAME)   NAME[nTracks] = NAME[INDEX];
+
+// appends a copy of a track, returns its index
+Int_t   GTreeTrack::CopyTrack(const Int_t index)
+{
+    Reserve(nTracks+1);
+    GTreeTrack_COLUMNS(GTREETRACK_COPY_COLUMN, index)
+    GTreeTrack_VERTEX_COLUMNS(GTREETRACK_COPY_COLUMN, index)
+    nTracks++;
+    Modified();
+    return nTracks-1;
+}
+
+// crystal is the central crystal number within the detector of the track
+void    GTreeTrack::SetCluster(const Int_t index, const Double_t energy, const Double_t _Theta, const Double_t _Phi, const Int_t crystal, const Int_t size)
+{
+    clusterEnergy[index]    = energy;
+    theta[index]            = _Theta;
+    phi[index]              = _Phi;
+    centralCrystal[index]   = crystal;
+    clusterSize[index]      = size;
+    Modified();
+}
+
+void    GTreeTrack::ConvertInput()
+{
+    GTreeTrack_COLUMNS(GTREE_CONVERT_COLUMN, nTracks)
+    GTreeTrack_VERTEX_COLUMNS(GTREE_CONVERT_COLUMN, nTracks)
 }
 
 void    GTreeTrack::Print(const Bool_t All) const
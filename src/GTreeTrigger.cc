@@ -7,20 +7,15 @@ GTreeTrigger::GTreeTrigger(GTreeManager* Manager)    :
     energySum(0),
     multiplicity(0),
     nTriggerPattern(0),
-    helicity(0),
     nErrors(0),
-    MC_evt_id(-1),
-    MC_rnd_id(-1),
+    helicity(0),
+    mc_evt_id(-1),
+    mc_rnd_id(-1),
     hasHelicity(0),
     hasMCID(0)
 {
-    for(Int_t i=0; i<GTreeTrigger_MAX; i++)
-    {
-        triggerPattern[i] = 0;
-        errorModuleID[i] = 0;
-        errorModuleIndex[i] = 0;
-        errorCode[i] = 0;
-    }
+    GTreeTrigger_PATTERN_COLUMNS(GTREE_RESERVE_COLUMN, GTreeTrigger_MAX)
+    GTreeTrigger_ERROR_COLUMNS(GTREE_RESERVE_COLUMN, GTreeTrigger_MAX)
 }
 
 GTreeTrigger::~GTreeTrigger()
@@ -30,40 +25,38 @@ GTreeTrigger::~GTreeTrigger()
 
 void    GTreeTrigger::SetBranchAdresses()
 {
-    inputTree->SetBranchAddress("energySum", 	      &energySum);
-    inputTree->SetBranchAddress("multiplicity", 	  &multiplicity);
-    inputTree->SetBranchAddress("nTriggerPattern",  &nTriggerPattern);
-    inputTree->SetBranchAddress("triggerPattern",   triggerPattern);
-    inputTree->SetBranchAddress("nErrors", 	      &nErrors);
-    inputTree->SetBranchAddress("errorModuleID",    errorModuleID);
-    inputTree->SetBranchAddress("errorModuleIndex", errorModuleIndex);
-    inputTree->SetBranchAddress("errorCode",        errorCode);
+    GTreeTrigger_SCALARS(GTREE_BIND_SCALAR, inputTree)
+    GTreeTrigger_PATTERN_COLUMNS(GTREE_BIND_COLUMN, inputTree)
+    GTreeTrigger_ERROR_COLUMNS(GTREE_BIND_COLUMN, inputTree)
     if(inputTree->GetBranch("helicity"))
     {
-        inputTree->SetBranchAddress("helicity",  &helicity);
+        GTreeTrigger_HELICITY_SCALARS(GTREE_BIND_SCALAR, inputTree)
         hasHelicity = true;
     }
     if(inputTree->GetBranch("mc_evt_id"))
     {
-        inputTree->SetBranchAddress("mc_evt_id", &MC_evt_id);
-        inputTree->SetBranchAddress("mc_rnd_id", &MC_rnd_id);
+        GTreeTrigger_MCID_SCALARS(GTREE_BIND_SCALAR, inputTree)
         hasMCID = true;
     }
 }
 
 void    GTreeTrigger::SetBranches()
 {
-    outputTree->Branch("energySum",        &energySum,       "energySum/D");
-    outputTree->Branch("multiplicity",     &multiplicity,    "multiplicity/I");
-    outputTree->Branch("nTriggerPattern",  &nTriggerPattern, "nTriggerPattern/I");
-    outputTree->Branch("triggerPattern",   triggerPattern,   "triggerPattern[nTriggerPattern]/I");
-    outputTree->Branch("nErrors",          &nErrors,         "nErrors/I");
-    outputTree->Branch("errorModuleID",    errorModuleID,    "errorModuleID[nErrors]/I");
-    outputTree->Branch("errorModuleIndex", errorModuleIndex, "errorModuleIndex[nErrors]/I");
-    outputTree->Branch("errorCode",        errorCode,        "errorCode[nErrors]/I");
-    if(hasHelicity) outputTree->Branch("helicity",         &helicity,        "helicity/O");
-    if(hasMCID)     outputTree->Branch("mc_evt_id",        &MC_evt_id,       "mc_evt_id/L");
-    if(hasMCID)     outputTree->Branch("mc_rnd_id",        &MC_rnd_id,       "mc_rnd_id/L");
+    GTreeTrigger_SCALARS(GTREE_BRANCH_SCALAR, outputTree)
+    GTreeTrigger_PATTERN_COLUMNS(GTREE_BRANCH_COLUMN, "nTriggerPattern")
+    GTreeTrigger_ERROR_COLUMNS(GTREE_BRANCH_COLUMN, "nErrors")
+    if(hasHelicity)
+    {
+        GTreeTrigger_HELICITY_SCALARS(GTREE_BRANCH_SCALAR, outputTree)
+    }
+    if(hasMCID)
+    {
+        GTreeTrigger_MCID_SCALARS(GTREE_BRANCH_SCALAR, outputTree)
+    }
 }
 
-
+void    GTreeTrigger::ConvertInput()
+{
+    GTreeTrigger_PATTERN_COLUMNS(GTREE_CONVERT_COLUMN, nTriggerPattern)
+    GTreeTrigger_ERROR_COLUMNS(GTREE_CONVERT_COLUMN, nErrors)
+}
@@ -0,0 +1,264 @@
+#include "GWorkerPool.h"
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+
+#include <TFile.h>
+
+using namespace std;
+
+
+static  Bool_t  LargerChunk(const std::pair<Double_t, Int_t>& a, const std::pair<Double_t, Int_t>& b)
+{
+    return a.first > b.first;
+}
+
+
+GWorkerPool::GWorkerPool(GChunkPlanner* Planner, const std::string& Executable, const Int_t NWorkers, const Int_t MaxRetries)  :
+    planner(Planner),
+    executable(Executable),
+    merger("goat-merge"),
+    nWorkers(NWorkers),
+    maxRetries(MaxRetries),
+    tasks(),
+    workers()
+{
+    if(nWorkers<1)
+        nWorkers    = 1;
+}
+
+GWorkerPool::~GWorkerPool()
+{
+}
+
+void    GWorkerPool::Distribute()
+{
+    // largest first, each to the worker with the least queued events
+    std::vector< std::pair<Double_t, Int_t> >   order;
+    for(Int_t t=0; t<(Int_t)tasks.size(); t++)
+        order.push_back(std::make_pair(tasks[t].chunk.nEvents, t));
+    std::stable_sort(order.begin(), order.end(), LargerChunk);
+
+    workers.assign(nWorkers, Worker());
+    for(Int_t w=0; w<nWorkers; w++)
+    {
+        workers[w].load = 0;
+        workers[w].pid  = 0;
+        workers[w].task = -1;
+    }
+    for(size_t i=0; i<order.size(); i++)
+    {
+        Int_t   best    = 0;
+        for(Int_t w=1; w<nWorkers; w++)
+        {
+            if(workers[w].load < workers[best].load)
+                best    = w;
+        }
+        workers[best].queue.push_back(order[i].second);
+        workers[best].load  += order[i].first;
+    }
+}
+
+Int_t   GWorkerPool::NextTask(const Int_t worker)
+{
+    Worker& own = workers[worker];
+    if(!own.queue.empty())
+    {
+        Int_t   task    = own.queue.front();
+        own.queue.pop_front();
+        own.load    -= tasks[task].chunk.nEvents;
+        return task;
+    }
+
+    // steal the smallest chunk of the most loaded queue
+    Int_t   victim  = -1;
+    for(Int_t w=0; w<nWorkers; w++)
+    {
+        if(workers[w].queue.empty())
+            continue;
+        if(victim<0 || workers[w].load > workers[victim].load)
+            victim  = w;
+    }
+    if(victim<0)
+        return -1;
+
+    Int_t   task    = workers[victim].queue.back();
+    workers[victim].queue.pop_back();
+    workers[victim].load    -= tasks[task].chunk.nEvents;
+    cout << "Worker " << worker << " steals chunk " << task << " from worker " << victim << "." << endl;
+    return task;
+}
+
+Int_t   GWorkerPool::Execute(const std::string& program, const std::vector<std::string>& args, const std::string& logFile)
+{
+    Int_t   pid = fork();
+    if(pid != 0)
+        return pid;
+
+    // child: redirect output to the log file and replace the process
+    Int_t   log = open(logFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(log >= 0)
+    {
+        dup2(log, 1);
+        dup2(log, 2);
+        close(log);
+    }
+    std::vector<char*>  argv;
+    argv.push_back((char*)program.c_str());
+    for(size_t a=0; a<args.size(); a++)
+        argv.push_back((char*)args[a].c_str());
+    argv.push_back(0);
+    execvp(argv[0], &argv[0]);
+    perror(program.c_str());
+    _exit(127);
+}
+
+Bool_t  GWorkerPool::Verify(const std::string& fileName)
+{
+    TFile*  file    = TFile::Open(fileName.c_str());
+    if(!file)
+        return kFALSE;
+    Bool_t  ok  = !file->IsZombie() && (file->Get("GoAT_File") || file->Get("Physics_File"));
+    file->Close();
+    delete file;
+    return ok;
+}
+
+Bool_t  GWorkerPool::Run()
+{
+    std::vector<GChunk> chunks;
+    if(!planner->MakeChunks(chunks))
+        return kFALSE;
+
+    tasks.clear();
+    for(size_t c=0; c<chunks.size(); c++)
+    {
+        Task    task;
+        task.chunk      = chunks[c];
+        task.attempts   = 0;
+        task.success    = kFALSE;
+        tasks.push_back(task);
+    }
+    Distribute();
+    cout << "Running " << tasks.size() << " chunks on " << nWorkers << " workers." << endl;
+
+    std::map<Int_t, Int_t>      running;
+    std::vector<std::string>    args;
+    Int_t   nDone   = 0;
+    Int_t   nFailed = 0;
+    while(kTRUE)
+    {
+        for(Int_t w=0; w<nWorkers; w++)
+        {
+            if(workers[w].pid != 0)
+                continue;
+            Int_t   t   = NextTask(w);
+            if(t<0)
+                continue;
+            planner->GetArguments(tasks[t].chunk, args);
+            tasks[t].attempts++;
+            Int_t   pid = Execute(executable, args, tasks[t].chunk.outputFile + ".log");
+            if(pid<0)
+            {
+                cout << "#ERROR: Can not start worker process!" << endl;
+                workers[w].queue.push_front(t);
+                workers[w].load += tasks[t].chunk.nEvents;
+                break;
+            }
+            workers[w].pid  = pid;
+            workers[w].task = t;
+            running[pid]    = w;
+        }
+        if(running.empty())
+            break;
+
+        Int_t   status;
+        Int_t   pid = waitpid(-1, &status, 0);
+        if(pid<0)
+            break;
+        if(running.find(pid) == running.end())
+            continue;
+        Int_t   w   = running[pid];
+        Int_t   t   = workers[w].task;
+        running.erase(pid);
+        workers[w].pid  = 0;
+        workers[w].task = -1;
+
+        if(WIFEXITED(status) && WEXITSTATUS(status)==0 && Verify(tasks[t].chunk.outputFile))
+        {
+            tasks[t].success    = kTRUE;
+            nDone++;
+            cout << "[" << nDone+nFailed << "/" << tasks.size() << "] " << tasks[t].chunk.outputFile << " done." << endl;
+        }
+        else if(tasks[t].attempts <= maxRetries)
+        {
+            cout << "Chunk " << tasks[t].chunk.outputFile << " failed (attempt " << tasks[t].attempts << "), retrying. See " << tasks[t].chunk.outputFile << ".log" << endl;
+            workers[w].queue.push_front(t);
+            workers[w].load += tasks[t].chunk.nEvents;
+        }
+        else
+        {
+            nFailed++;
+            cout << "#ERROR: Chunk " << tasks[t].chunk.outputFile << " failed " << tasks[t].attempts << " times. See " << tasks[t].chunk.outputFile << ".log" << endl;
+        }
+    }
+
+    cout << nDone << " chunks done, " << nFailed << " failed." << endl;
+    if(!Merge())
+        return kFALSE;
+    return (nFailed == 0);
+}
+
+Bool_t  GWorkerPool::Merge()
+{
+    std::map< std::string, std::vector<Int_t> > parts;
+    for(Int_t t=0; t<(Int_t)tasks.size(); t++)
+    {
+        if(tasks[t].chunk.outputFile != tasks[t].chunk.finalOutputFile)
+            parts[tasks[t].chunk.finalOutputFile].push_back(t);
+    }
+
+    Bool_t  ok  = kTRUE;
+    for(std::map< std::string, std::vector<Int_t> >::iterator it=parts.begin(); it!=parts.end(); it++)
+    {
+        Bool_t  complete    = kTRUE;
+        std::vector<std::string>    args;
+        args.push_back("-j");
+        args.push_back(std::to_string((long long)nWorkers));
+        args.push_back(it->first);
+        for(size_t p=0; p<it->second.size(); p++)
+        {
+            if(!tasks[it->second[p]].success)
+                complete    = kFALSE;
+            args.push_back(tasks[it->second[p]].chunk.outputFile);
+        }
+        if(!complete)
+        {
+            cout << "#ERROR: Not all parts of " << it->first << " are done. Parts are not merged." << endl;
+            ok  = kFALSE;
+            continue;
+        }
+
+        cout << "Merging " << it->second.size() << " parts into " << it->first << endl;
+        Int_t   pid = Execute(merger, args, it->first + ".log");
+        Int_t   status  = -1;
+        if(pid>0)
+            waitpid(pid, &status, 0);
+        if(pid>0 && WIFEXITED(status) && WEXITSTATUS(status)==0)
+        {
+            for(size_t p=0; p<it->second.size(); p++)
+                unlink(tasks[it->second[p]].chunk.outputFile.c_str());
+        }
+        else
+        {
+            cout << "#ERROR: Merging into " << it->first << " failed. Parts are kept." << endl;
+            ok  = kFALSE;
+        }
+    }
+    return ok;
+}
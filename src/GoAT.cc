@@ -2,13 +2,16 @@
 
 
 GoAT::GoAT() :
+    usePeriodMacro(0),
     useParticleReconstruction(0),
-    nEventsWritten(0)
+    nEventsWritten(0),
+    reclustering(0)
 { 
 }
 
 GoAT::~GoAT()
 {
+    if(reclustering) delete reclustering;
 }
 
 Bool_t	GoAT::Init()
@@ -73,6 +76,53 @@ Bool_t	GoAT::Init()
         }
     }
 
+    Double_t maxEnergy=0, maxAngle=0, minSplitEnergy=0;
+    config = ReadConfig("Recluster-Merge");
+    if (strcmp(config.c_str(), "nokey") != 0)
+    {
+        if(sscanf( config.c_str(), "%lf %lf\n", &maxEnergy, &maxAngle) == 2)
+            cout << "Merging neutral clusters below " << maxEnergy << " MeV into a neighbouring cluster within " << maxAngle << " deg" << endl;
+        else
+        {
+            cout << "#ERROR: Recluster-Merge needs the maximum energy (MeV) and angle (deg) of a split-off" << endl;
+            maxEnergy   = 0;
+        }
+    }
+
+    config = ReadConfig("Recluster-Split");
+    if (strcmp(config.c_str(), "nokey") != 0)
+    {
+        if(sscanf( config.c_str(), "%lf\n", &minSplitEnergy) == 1 && minSplitEnergy > 0)
+            cout << "Splitting neutral clusters at local maxima above " << minSplitEnergy << " MeV where the crystal energies are known (a2geant)" << endl;
+        else
+        {
+            cout << "#ERROR: Recluster-Split needs the minimum energy (MeV) of a local maximum" << endl;
+            minSplitEnergy  = 0;
+        }
+    }
+
+    if(maxEnergy > 0 || minSplitEnergy > 0)
+    {
+        if(!reclustering) reclustering = new GReclustering(maxEnergy, maxAngle, minSplitEnergy);
+        cout << "The tracks tree is written reclustered, detectorHits clusters are relabelled to match" << endl;
+    }
+
+    config = ReadConfig("Block-Size");
+    if (strcmp(config.c_str(), "nokey") != 0)
+    {
+        Int_t size=0;
+        if(sscanf( config.c_str(), "%d\n", &size) == 1 && size > 1)
+        {
+            if(reclustering)
+                cout << "#ERROR: Block-Size can not be combined with Recluster-Merge, processing event by event" << endl;
+            else
+            {
+                SetBlockSize(size);
+                cout << "Processing blocks of " << size << " events" << endl;
+            }
+        }
+    }
+
 	cout << endl;	
 
 	cout << "Initialisation complete." << endl;
@@ -89,47 +139,93 @@ void	GoAT::ProcessEvent()
             cout << "Event: " << GetEventNumber() << "  Events Accepted: " << nEventsWritten << endl;
     }
 
+    if(reclustering && GetDetectorHits()->IsOpenForInput())
+    {
+        // a2geant crystal energies are in GeV
+        reclustering->ClearEnergies();
+        if(GetGeant()->IsOpenForInput())
+        {
+            reclustering->SetEnergies(GetGeant()->GetNCBHits(), GetGeant()->GetCBHitIndices(), GetGeant()->GetCBHitEnergies(), 0, GDetectorGeometry::N_NaI, 1000);
+            reclustering->SetEnergies(GetGeant()->GetNTAPSHits(), GetGeant()->GetTAPSHitIndices(), GetGeant()->GetTAPSHitEnergiesLong(), GDetectorGeometry::TAPS_OFFSET, GDetectorGeometry::N_TAPS, 1000);
+        }
+        reclustering->Run(*GetTracks(), *GetDetectorHits());
+    }
+
     if(SortAnalyseEvent())
+        ProcessSortedEvent(0);
+}
+
+// Block mode: only the tracks and the trigger are read for the whole block,
+// the raw sort runs over all of them and only the surviving events are
+// read completely and reconstructed.
+void	GoAT::ProcessBlock(const UInt_t min, const UInt_t max)
+{
+    block.Clear();
+    for(UInt_t i=min; i<max; i++)
     {
-        if(useParticleReconstruction)
+        ReadEntry(i, GetTracks());
+        ReadEntry(i, GetTrigger());
+        CountEntry(i);
+        if(usePeriodMacro == 1)
         {
-            if(useMesonReconstruction)
-            {
-                if(!GParticleReconstruction::ProcessEventWithoutFilling())  return;
-                if(!GMesonReconstruction::ProcessEventWithoutFilling())  return;
-                if(!SortFillEvent())    return;
-                GetElectrons()->Fill();
-                GetProtons()->Fill();
-                GetNeutrons()->Fill();
-                GetNeutralPions()->Fill();
-                GetEtas()->Fill();
-                GetEtaPrimes()->Fill();
-            }
-            else
-            {
-                if(!GParticleReconstruction::ProcessEventWithoutFilling())  return;
-                if(!SortFillEvent())    return;
-                GetElectrons()->Fill();
-                GetProtons()->Fill();
-                GetNeutrons()->Fill();
-            }
+            if(GetEventNumber() % period == 0)
+                cout << "Event: " << GetEventNumber() << "  Events Accepted: " << nEventsWritten << endl;
         }
-        else if(useMesonReconstruction)
+        block.AddEvent(i, *GetTracks(), GetTrigger()->GetEnergySum());
+    }
+
+    if(useParticleReconstruction)
+        ClassifyTracks(block.GetNTracks(), block.GetDetectors(), block.GetTime(), block.GetVetoEnergy(), block.GetMWPC0Energy(), block.GetMWPC1Energy(), block.GetFlags());
+    SortAnalyseBlock(block);
+
+    for(Int_t e=0; e<block.GetNEvents(); e++)
+    {
+        ReadCountedEntry(block.GetEntry(e));
+        ProcessSortedEvent(useParticleReconstruction ? block.GetFlags(e) : 0);
+    }
+}
+
+void	GoAT::ProcessSortedEvent(const Int_t* trackFlags)
+{
+    if(useParticleReconstruction)
+    {
+        if(useMesonReconstruction)
         {
-            GMesonReconstruction::ProcessEventWithoutFilling();
+            if(!GParticleReconstruction::ProcessEventWithoutFilling(trackFlags))  return;
+            if(!GMesonReconstruction::ProcessEventWithoutFilling())  return;
             if(!SortFillEvent())    return;
+            GetElectrons()->Fill();
+            GetProtons()->Fill();
+            GetNeutrons()->Fill();
             GetNeutralPions()->Fill();
             GetEtas()->Fill();
             GetEtaPrimes()->Fill();
         }
-        GetEventParameters()->SetNReconstructed(GetNReconstructed());
-        GetEventParameters()->Fill();
-        GetRootinos()->Fill();
-        GetPhotons()->Fill();
-        GetChargedPions()->Fill();
-        FillReadList();
-        nEventsWritten++;
+        else
+        {
+            if(!GParticleReconstruction::ProcessEventWithoutFilling(trackFlags))  return;
+            if(!SortFillEvent())    return;
+            GetElectrons()->Fill();
+            GetProtons()->Fill();
+            GetNeutrons()->Fill();
+        }
     }
+    else if(useMesonReconstruction)
+    {
+        GMesonReconstruction::ProcessEventWithoutFilling();
+        if(!SortFillEvent())    return;
+        GetNeutralPions()->Fill();
+        GetEtas()->Fill();
+        GetEtaPrimes()->Fill();
+    }
+    GetEventParameters()->SetNReconstructed(GetNReconstructed());
+    GetEventParameters()->Fill();
+    GetRootinos()->Fill();
+    GetPhotons()->Fill();
+    GetChargedPions()->Fill();
+    FillReadList();
+    nEventsWritten++;
+    AcceptEvent();
 }
 
 Bool_t	GoAT::Start()
@@ -139,7 +235,6 @@ Bool_t	GoAT::Start()
         cout << "ERROR: Input File is not a Acqu file." << endl;
         return kFALSE;
     }
-    SetAsGoATFile();
 
     if(useParticleReconstruction)
     {
@@ -173,6 +268,11 @@ Bool_t	GoAT::Start()
     }
 
     if(!TraverseValidEvents())		return kFALSE;
+    if(usePeriodMacro == 1)
+        cout << "Event arena: " << GetEventArena().GetNAllocations() << " allocations, " << GetEventArena().GetNHeapAllocations() << " from the heap, peak " << GetEventArena().GetPeak() << " bytes per event." << endl;
+
+    // only a completely processed file is flagged, goat-run verifies its outputs by the flag
+    SetAsGoATFile();
 
     return kTRUE;
 }
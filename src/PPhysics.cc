@@ -67,18 +67,19 @@ void PPhysics::FillMissingMass(const GTreeParticle& tree, TH1* Hprompt, TH1* Hra
 {
     for (Int_t i = 0; i < tree.GetNParticles(); i++)
     {
-    for (Int_t j = 0; j < GetTagger()->GetNTagged(); j++)
-	{
-        	FillMissingMass(tree, i, j, Hprompt, Hrandom);
-	}
+        FillMissingMass(tree, i, Hprompt, Hrandom);
     }
 }
 
 void PPhysics::FillMissingMass(const GTreeParticle& tree, Int_t particle_index, TH1* Hprompt, TH1* Hrandom)
 {
+    const Double_t* mm = CalcMissingMasses(tree, particle_index);
     for (Int_t i = 0; i < GetTagger()->GetNTagged(); i++)
 	{
-        	FillMissingMass(tree, particle_index, i, Hprompt, Hrandom);
+        time = GetTagger()->GetTaggedTime(i) - tree.GetTime(particle_index);
+
+        if (GHistBGSub::IsPrompt(time)) Hprompt->Fill(mm[i]);
+        if (GHistBGSub::IsRandom(time)) Hrandom->Fill(mm[i]);
 	}
 }
 
@@ -207,18 +208,23 @@ void PPhysics::FillMissingMass(const GTreeParticle& tree, GH1* gHist, Bool_t Tag
 {
 	for (Int_t i = 0; i < tree.GetNParticles(); i++)
 	{
-        for (Int_t j = 0; j < GetTagger()->GetNTagged(); j++)
-		{
-			FillMissingMass(tree, i, j, gHist, TaggerBinning);
-		}
+		FillMissingMass(tree, i, gHist, TaggerBinning);
 	}
 }
 
 void PPhysics::FillMissingMass(const GTreeParticle& tree, Int_t particle_index, GH1* gHist, Bool_t TaggerBinning)
 {
+    const Double_t* mm = CalcMissingMasses(tree, particle_index);
     for (Int_t i = 0; i < GetTagger()->GetNTagged(); i++)
 	{
-        FillMissingMass(tree, particle_index, i, gHist, TaggerBinning);
+        // Is tagger channel rejected by user?
+        if(GetTagger()->GetTaggedChannel(i) < TC_cut_min) continue;
+        if(GetTagger()->GetTaggedChannel(i) > TC_cut_max) continue;
+
+        time = GetTagger()->GetTaggedTime(i) - tree.GetTime(particle_index);
+
+        if(TaggerBinning)   gHist->Fill(mm[i],time, GetTagger()->GetTaggedChannel(i));
+        else gHist->Fill(mm[i],time);
 	}
 }
 
@@ -256,13 +262,24 @@ Double_t PPhysics::CalcMissingEnergy(const GTreeParticle& tree, Int_t particle_i
 
 TLorentzVector PPhysics::CalcMissingP4(const GTreeParticle& tree, Int_t particle_index, Int_t tagger_index)
 {
-    particle	= tree.Particle(particle_index);
-    beam 		= TLorentzVector(0.,0.,GetTagger()->GetTaggedEnergy(tagger_index),GetTagger()->GetTaggedEnergy(tagger_index));
-	missingp4 	= beam + target - particle;						
+    missingp4 	= GKinematics::MissingP4(GetTagger()->GetTaggedEnergy(tagger_index), target.E(), tree.ParticleP4(particle_index)).ToTLorentzVector();
 
 	return missingp4;
 }
 
+const Double_t* PPhysics::CalcMissingMasses(const GTreeParticle& tree, Int_t particle_index)
+{
+    Int_t       nTagged = GetTagger()->GetNTagged();
+    Double_t*   beamE   = GetEventArena().Alloc<Double_t>(nTagged);
+    Double_t*   mm      = GetEventArena().Alloc<Double_t>(nTagged);
+
+    for (Int_t i = 0; i < nTagged; i++)
+        beamE[i] = GetTagger()->GetTaggedEnergy(i);
+    GKinematics::MissingMass(nTagged, beamE, target.E(), tree.ParticleP4(particle_index), mm);
+
+    return mm;
+}
+
 void PPhysics::FillBeamAsymmetry(const GTreeParticle& tree, Int_t particle_index, GH1* gHist, Bool_t TaggerBinning, Double_t MM_min, Double_t MM_max)
 {
     for (Int_t i = 0; i < GetTagger()->GetNTagged(); i++)
@@ -79,6 +79,10 @@ void	PPi0Example::ProcessEvent()
 
     }
 
+    // events with a pi0 count towards Max-Accepted-Events
+    if(GetNeutralPions()->GetNParticles()>0)
+        AcceptEvent();
+
 }
 
 void	PPi0Example::ProcessScalerRead()
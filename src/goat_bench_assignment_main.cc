@@ -0,0 +1,175 @@
+#ifndef __CINT__
+
+#include "GMesonAssignment.h"
+#include <TRandom3.h>
+#include <TStopwatch.h>
+#include <TMath.h>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+using namespace std;
+
+#define BENCH_MAX_PARTICLES     12
+#define BENCH_MAX_CANDIDATES    (BENCH_MAX_PARTICLES*(BENCH_MAX_PARTICLES-1)/2)
+#define BENCH_CHECK_PARTICLES   8       // events up to this size are also solved by brute force
+
+struct  GBenchEvent
+{
+    Int_t       nParticles;
+    Int_t       nCandidates;
+    Int_t       first[BENCH_MAX_CANDIDATES];
+    Int_t       second[BENCH_MAX_CANDIDATES];
+    Double_t    diff[BENCH_MAX_CANDIDATES];
+    Bool_t      greedy[BENCH_MAX_CANDIDATES];
+    Bool_t      exact[BENCH_MAX_CANDIDATES];
+};
+
+/**
+ * @brief greedy choice of GMesonReconstruction: candidates by increasing
+ *        distance, each taken if both particles are still free
+ */
+static void Greedy(const GBenchEvent& event, Int_t* sortIndex, Bool_t* chosen)
+{
+    UInt_t  used    = 0;
+    TMath::Sort(event.nCandidates, event.diff, sortIndex, kFALSE);
+    for(Int_t c=0; c<event.nCandidates; c++)
+        chosen[c]   = kFALSE;
+    for(Int_t i=0; i<event.nCandidates; i++)
+    {
+        const Int_t     c   = sortIndex[i];
+        const UInt_t    bits = (1u << event.first[c]) | (1u << event.second[c]);
+        if(used & bits) continue;
+        used        |= bits;
+        chosen[c]   = kTRUE;
+    }
+}
+
+static void Score(const GBenchEvent& event, const Bool_t* chosen, Int_t& nPairs, Double_t& chi2)
+{
+    nPairs  = 0;
+    chi2    = 0;
+    for(Int_t c=0; c<event.nCandidates; c++)
+    {
+        if(!chosen[c])  continue;
+        nPairs++;
+        chi2    += event.diff[c]*event.diff[c];
+    }
+}
+
+/**
+ * @brief every disjoint subset of the candidates, best by the most pairs
+ *        and then the smallest chi2
+ */
+static void BruteForce(const GBenchEvent& event, const Int_t c, const UInt_t used, const Int_t nPairs, const Double_t chi2, Int_t& bestPairs, Double_t& bestChi2)
+{
+    if(c == event.nCandidates)
+    {
+        if(nPairs > bestPairs || (nPairs == bestPairs && chi2 < bestChi2))
+        {
+            bestPairs   = nPairs;
+            bestChi2    = chi2;
+        }
+        return;
+    }
+    BruteForce(event, c+1, used, nPairs, chi2, bestPairs, bestChi2);
+    const UInt_t    bits    = (1u << event.first[c]) | (1u << event.second[c]);
+    if(!(used & bits))
+        BruteForce(event, c+1, used | bits, nPairs+1, chi2 + event.diff[c]*event.diff[c], bestPairs, bestChi2);
+}
+
+/**
+ * @brief greedy against exact choice of the 2 particle mesons on random
+ *        candidate lists
+ * @param argc number of parameters
+ * @param argv [number of events] [probability of a pair to be a candidate]
+ * @return exit code, 1 if an exact choice is not the best one
+ */
+int main(int argc, char *argv[])
+{
+    Long64_t    nEvents     = argc>1 ? atoll(argv[1]) : 200000;
+    Double_t    probability = argc>2 ? atof(argv[2]) : 0.3;
+
+    // random candidate lists with 2 to BENCH_MAX_PARTICLES particles
+    TRandom3                random(4357);
+    vector<GBenchEvent>     events(nEvents);
+    for(Long64_t e=0; e<nEvents; e++)
+    {
+        GBenchEvent&    event   = events[e];
+        event.nParticles    = 2 + random.Integer(BENCH_MAX_PARTICLES-1);
+        event.nCandidates   = 0;
+        for(Int_t i=0; i<event.nParticles; i++)
+        {
+            for(Int_t j=i+1; j<event.nParticles; j++)
+            {
+                if(random.Uniform() >= probability)  continue;
+                event.first[event.nCandidates]  = i;
+                event.second[event.nCandidates] = j;
+                event.diff[event.nCandidates]   = random.Uniform();
+                event.nCandidates++;
+            }
+        }
+    }
+
+    Int_t               sortIndex[BENCH_MAX_CANDIDATES];
+    GMesonAssignment    assignment;
+    TStopwatch          watch;
+
+    watch.Start();
+    for(Long64_t e=0; e<nEvents; e++)
+        Greedy(events[e], sortIndex, events[e].greedy);
+    watch.Stop();
+    Double_t    greedyTime  = watch.RealTime();
+
+    watch.Start();
+    for(Long64_t e=0; e<nEvents; e++)
+        assignment.Run(events[e].nParticles, events[e].nCandidates, events[e].first, events[e].second, events[e].diff, events[e].exact);
+    watch.Stop();
+    Double_t    exactTime   = watch.RealTime();
+
+    Long64_t    nMorePairs  = 0;
+    Long64_t    nLowerChi2  = 0;
+    Long64_t    nWorse      = 0;
+    Long64_t    nChecked    = 0;
+    Long64_t    nFailed     = 0;
+    Long64_t    nGreedyPairs    = 0;
+    Long64_t    nExactPairs     = 0;
+    for(Long64_t e=0; e<nEvents; e++)
+    {
+        Int_t       greedyPairs, exactPairs;
+        Double_t    greedyChi2,  exactChi2;
+        Score(events[e], events[e].greedy, greedyPairs, greedyChi2);
+        Score(events[e], events[e].exact,  exactPairs,  exactChi2);
+        nGreedyPairs    += greedyPairs;
+        nExactPairs     += exactPairs;
+        if(exactPairs > greedyPairs)
+            nMorePairs++;
+        else if(exactPairs == greedyPairs && exactChi2 < greedyChi2 - 1e-12)
+            nLowerChi2++;
+        else if(exactPairs < greedyPairs || exactChi2 > greedyChi2 + 1e-12)
+            nWorse++;
+
+        if(events[e].nParticles > BENCH_CHECK_PARTICLES)
+            continue;
+        Int_t       bestPairs   = 0;
+        Double_t    bestChi2    = 0;
+        BruteForce(events[e], 0, 0, 0, 0, bestPairs, bestChi2);
+        nChecked++;
+        if(bestPairs != exactPairs || TMath::Abs(bestChi2 - exactChi2) > 1e-12)
+        {
+            if(nFailed < 10)
+                cout << "ERROR: exact choice of event " << e << " has " << exactPairs << " pairs, chi2 " << exactChi2 << ", best is " << bestPairs << " pairs, chi2 " << bestChi2 << "!" << endl;
+            nFailed++;
+        }
+    }
+
+    cout << nEvents << " events with 2 to " << BENCH_MAX_PARTICLES << " particles, pair candidate probability " << probability << ":" << endl;
+    cout << "\tgreedy: " << 1e9*greedyTime/nEvents << " ns per event, " << nGreedyPairs << " mesons" << endl;
+    cout << "\texact:  " << 1e9*exactTime/nEvents  << " ns per event, " << nExactPairs  << " mesons" << endl;
+    cout << "\texact choice has more mesons in " << nMorePairs << " events, a smaller chi2 in " << nLowerChi2 << " events, is worse in " << nWorse << " events" << endl;
+    cout << nFailed << " of " << nChecked << " events up to " << BENCH_CHECK_PARTICLES << " particles differ from the brute force choice." << endl;
+
+    return (nFailed || nWorse) ? 1 : 0;
+}
+
+#endif
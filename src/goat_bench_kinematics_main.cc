@@ -0,0 +1,109 @@
+#ifndef __CINT__
+
+#include "GKinematics.h"
+#include <TRandom3.h>
+#include <TStopwatch.h>
+#include <TMath.h>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+using namespace std;
+
+#define BENCH_PARTICLES 8
+#define BENCH_PAIRS     (BENCH_PARTICLES*(BENCH_PARTICLES-1)/2)
+#define BENCH_TAGGER    64
+
+/**
+ * @brief pair and missing masses with GKinematics against TLorentzVector
+ * @param argc number of parameters
+ * @param argv [number of events]
+ * @return exit code, 1 if any mass differs
+ */
+int main(int argc, char *argv[])
+{
+    Long64_t    nEvents     = argc>1 ? atoll(argv[1]) : 200000;
+    Double_t    targetMass  = 938.272046;
+
+    // random photons and tagger energies, the same for both
+    TRandom3                random(4357);
+    vector<TLorentzVector>  p4(nEvents*BENCH_PARTICLES);
+    vector<GP4>             gp4(nEvents*BENCH_PARTICLES);
+    for(Long64_t i=0; i<nEvents*BENCH_PARTICLES; i++)
+    {
+        Double_t    energy  = random.Uniform(20, 600);
+        Double_t    cosTh   = random.Uniform(-1, 1);
+        Double_t    sinTh   = TMath::Sqrt(1 - cosTh*cosTh);
+        Double_t    phi     = random.Uniform(0, TMath::TwoPi());
+        p4[i].SetPxPyPzE(energy*sinTh*TMath::Cos(phi), energy*sinTh*TMath::Sin(phi), energy*cosTh, energy);
+        gp4[i]  = GP4(p4[i]);
+    }
+    Double_t    beamEnergy[BENCH_TAGGER];
+    for(Int_t t=0; t<BENCH_TAGGER; t++)
+        beamEnergy[t]   = random.Uniform(100, 1500);
+
+    vector<Double_t>    oldPair(nEvents*BENCH_PAIRS),   newPair(nEvents*BENCH_PAIRS);
+    vector<Double_t>    oldMissing(nEvents*BENCH_TAGGER), newMissing(nEvents*BENCH_TAGGER);
+    TStopwatch  watch;
+
+    // all pair masses of every event
+    watch.Start();
+    for(Long64_t e=0; e<nEvents; e++)
+    {
+        const TLorentzVector*   p   = &p4[e*BENCH_PARTICLES];
+        Double_t*               out = &oldPair[e*BENCH_PAIRS];
+        for(Int_t i=0; i<BENCH_PARTICLES; i++)
+            for(Int_t j=i+1; j<BENCH_PARTICLES; j++)
+                *out++  = (p[i] + p[j]).M();
+    }
+    watch.Stop();
+    Double_t    oldPairTime = watch.RealTime();
+
+    watch.Start();
+    for(Long64_t e=0; e<nEvents; e++)
+        GKinematics::PairMasses(BENCH_PARTICLES, &gp4[e*BENCH_PARTICLES], &newPair[e*BENCH_PAIRS]);
+    watch.Stop();
+    Double_t    newPairTime = watch.RealTime();
+
+    // missing mass of the first particle of every event for all tagger hits
+    const TLorentzVector    target(0, 0, 0, targetMass);
+    watch.Start();
+    for(Long64_t e=0; e<nEvents; e++)
+    {
+        const TLorentzVector&   p   = p4[e*BENCH_PARTICLES];
+        Double_t*               out = &oldMissing[e*BENCH_TAGGER];
+        for(Int_t t=0; t<BENCH_TAGGER; t++)
+        {
+            TLorentzVector  beam(0, 0, beamEnergy[t], beamEnergy[t]);
+            out[t]  = (beam + target - p).M();
+        }
+    }
+    watch.Stop();
+    Double_t    oldMissingTime  = watch.RealTime();
+
+    watch.Start();
+    for(Long64_t e=0; e<nEvents; e++)
+        GKinematics::MissingMass(BENCH_TAGGER, beamEnergy, targetMass, gp4[e*BENCH_PARTICLES], &newMissing[e*BENCH_TAGGER]);
+    watch.Stop();
+    Double_t    newMissingTime  = watch.RealTime();
+
+    Long64_t    nPairDiffer     = 0;
+    Long64_t    nMissingDiffer  = 0;
+    for(Long64_t i=0; i<nEvents*BENCH_PAIRS; i++)
+        nPairDiffer     += oldPair[i] != newPair[i];
+    for(Long64_t i=0; i<nEvents*BENCH_TAGGER; i++)
+        nMissingDiffer  += oldMissing[i] != newMissing[i];
+
+    Double_t    nPairs      = Double_t(nEvents)*BENCH_PAIRS;
+    Double_t    nMissing    = Double_t(nEvents)*BENCH_TAGGER;
+    cout << nEvents << " events with " << BENCH_PARTICLES << " photons, " << BENCH_PAIRS << " pair masses each:" << endl;
+    cout << "\tTLorentzVector: " << 1e9*oldPairTime/nPairs << " ns per mass" << endl;
+    cout << "\tGKinematics:    " << 1e9*newPairTime/nPairs << " ns per mass, " << nPairDiffer << " differ" << endl;
+    cout << nEvents << " events with " << BENCH_TAGGER << " tagger hits, one missing mass each:" << endl;
+    cout << "\tTLorentzVector: " << 1e9*oldMissingTime/nMissing << " ns per mass" << endl;
+    cout << "\tGKinematics:    " << 1e9*newMissingTime/nMissing << " ns per mass, " << nMissingDiffer << " differ" << endl;
+
+    return (nPairDiffer || nMissingDiffer) ? 1 : 0;
+}
+
+#endif
@@ -0,0 +1,395 @@
+#ifndef __CINT__
+
+#include "GParticleReconstruction.h"
+#include <TFile.h>
+#include <TTree.h>
+#include <TRandom3.h>
+#include <TStopwatch.h>
+#include <TSystem.h>
+#include <iostream>
+#include <stdlib.h>
+
+using namespace std;
+
+#define BENCH_MAX_TRACKS    8
+
+/**
+ * @brief Particle identification of the rule programs against the per
+ *        track code they replaced.
+ *
+ *   Start() reads every event of the input file three times: only the
+ *   tracks, with the old identification and with the rule programs of
+ *   GParticleReconstruction. The old identification is the loop before
+ *   the rule programs, with PDG codes looked up per track. The species of
+ *   every track have to be identical.
+ */
+class  GBenchPID : public GParticleReconstruction
+{
+private:
+    // cuts and options of one detector for the old identification
+    struct  OldRules
+    {
+        TCutG*      proton;
+        TCutG*      pion;
+        TCutG*      electron;
+        TCutG*      timeOfFlight;
+        TCutG*      clusterSize;
+        Bool_t      allPhotons;
+        Bool_t      allProtons;
+        Double_t    timeCut[2];
+    };
+
+    OldRules    rulesCB;
+    OldRules    rulesTAPS;
+    Bool_t      ignorePID;
+    Bool_t      ignoreMWPC0;
+    Bool_t      ignoreMWPC1;
+    Bool_t      ignoreVETO;
+    Int_t       pdgSpecies[SpeciesCount];
+
+    Long64_t    nEvents;
+    Long64_t    nTracks;
+    Long64_t    nDiffer;
+
+    TCutG*  LoadCut(const char* key);
+    void    LoadRules(OldRules& rules, const char* detector);
+    Int_t   OldSpecies(const OldRules& rules, const Int_t i, Int_t* identified, const Bool_t cb);
+    Bool_t  OldIdentify(Int_t* identified);
+    Bool_t  NewIdentify(Int_t* identified);
+
+protected:
+    virtual Bool_t  Start();
+
+public:
+    GBenchPID();
+    virtual ~GBenchPID()    {}
+
+            Bool_t      InitBench();
+            Long64_t    GetNDiffer()    const   {return nDiffer;}
+};
+
+GBenchPID::GBenchPID()  :
+    ignorePID(kFALSE),
+    ignoreMWPC0(kFALSE),
+    ignoreMWPC1(kFALSE),
+    ignoreVETO(kFALSE),
+    nEvents(0),
+    nTracks(0),
+    nDiffer(0)
+{
+}
+
+TCutG*  GBenchPID::LoadCut(const char* key)
+{
+    std::string config  = ReadConfig(key);
+    char    cutFile[256];
+    char    cutName[256];
+    if(strcmp(config.c_str(), "nokey") == 0 || sscanf(config.c_str(), "%s %s\n", cutFile, cutName) != 2)
+        return 0;
+
+    TCutG*  cut = 0;
+    TFile   file(cutFile, "READ");
+    if(file.IsOpen())
+        file.GetObject(cutName, cut);
+    return cut;
+}
+
+void    GBenchPID::LoadRules(OldRules& rules, const char* detector)
+{
+    rules.proton        = LoadCut(TString::Format("Cut-dE-E-%s-Proton", detector).Data());
+    rules.pion          = LoadCut(TString::Format("Cut-dE-E-%s-Pion", detector).Data());
+    rules.electron      = LoadCut(TString::Format("Cut-dE-E-%s-Electron", detector).Data());
+    rules.timeOfFlight  = LoadCut(TString::Format("Cut-%s-TOF", detector).Data());
+    rules.clusterSize   = LoadCut(TString::Format("Cut-%s-ClustSize", detector).Data());
+    rules.allPhotons    = strcmp(ReadConfig(TString::Format("%s-all-photons", detector).Data()).c_str(), "nokey") != 0;
+    rules.allProtons    = strcmp(ReadConfig(TString::Format("%s-all-GetProtons()", detector).Data()).c_str(), "nokey") != 0;
+    if(rules.allProtons)
+        rules.allPhotons    = kFALSE;   // read last, so it replaced the photon option
+    rules.timeCut[0]    = -1000000.0;
+    rules.timeCut[1]    = 1000000.0;
+    std::string config  = ReadConfig(TString::Format("%s-PARTICLE-TIME-CUT", detector).Data());
+    if(strcmp(config.c_str(), "nokey") != 0)
+        sscanf(config.c_str(), "%lf %lf\n", &rules.timeCut[0], &rules.timeCut[1]);
+}
+
+Bool_t  GBenchPID::InitBench()
+{
+    if(!Init())
+        return kFALSE;
+
+    LoadRules(rulesCB, "CB");
+    LoadRules(rulesTAPS, "TAPS");
+    ignorePID   = strcmp(ReadConfig("charge-ignore-PID").c_str(), "nokey") != 0;
+    ignoreMWPC0 = strcmp(ReadConfig("charge-ignore-MWPC0").c_str(), "nokey") != 0;
+    ignoreMWPC1 = strcmp(ReadConfig("charge-ignore-MWPC1").c_str(), "nokey") != 0;
+    ignoreVETO  = strcmp(ReadConfig("charge-ignore-VETO").c_str(), "nokey") != 0;
+
+    pdgSpecies[SpeciesRootino]      = PDG_ROOTINO;
+    pdgSpecies[SpeciesPhoton]       = pdgDB->GetParticle("gamma")->PdgCode();
+    pdgSpecies[SpeciesProton]       = pdgDB->GetParticle("proton")->PdgCode();
+    pdgSpecies[SpeciesChargedPion]  = pdgDB->GetParticle("pi+")->PdgCode();
+    pdgSpecies[SpeciesElectron]     = pdgDB->GetParticle("e-")->PdgCode();
+    pdgSpecies[SpeciesNeutron]      = pdgDB->GetParticle("neutron")->PdgCode();
+    return kTRUE;
+}
+
+// one detector of the old per track loop: 0 => next track, 1 => next
+// detector, 2 => break the track loop, 3 => reject the event
+Int_t   GBenchPID::OldSpecies(const OldRules& rules, const Int_t i, Int_t* identified, const Bool_t cb)
+{
+    GTreeTrack* tracks  = GetTracks();
+    if(tracks->GetTime(i)<rules.timeCut[0] || tracks->GetTime(i)>rules.timeCut[1])
+        return 3;
+
+    identified[i]   = PDG_ROOTINO;
+    Int_t   charge  = 0;
+    Int_t   hadron  = 0;
+
+    if(rules.allPhotons)
+    {
+        identified[i]   = pdgDB->GetParticle("gamma")->PdgCode();
+        return 0;
+    }
+    if(rules.allProtons)
+    {
+        identified[i]   = pdgDB->GetParticle("proton")->PdgCode();
+        return 0;
+    }
+
+    if(cb)
+    {
+        if ((!ignorePID) && (tracks->GetVetoEnergy(i) > 0.0))      charge = 1;
+        if ((!ignoreMWPC0) && (tracks->GetMWPC0Energy(i) > 0.0))   charge = 1;
+        if ((!ignoreMWPC1) && (tracks->GetMWPC1Energy(i) > 0.0))   charge = 1;
+    }
+    else if ((!ignoreVETO) && (tracks->GetVetoEnergy(i) > 0.0))    charge = 1;
+
+    if(rules.timeOfFlight && rules.timeOfFlight->IsInside(tracks->GetClusterEnergy(i), tracks->GetTime(i)))
+        hadron  = 1;
+    if(rules.clusterSize && rules.clusterSize->IsInside(tracks->GetClusterEnergy(i), tracks->GetClusterSize(i)))
+        hadron  = 1;
+
+    if (charge == 0)
+    {
+        if(hadron == 0) identified[i] = pdgDB->GetParticle("gamma")->PdgCode();
+        else identified[i] = pdgDB->GetParticle("neutron")->PdgCode();
+        return 0;
+    }
+
+    // default charged theta range, goat does not configure it
+    if (tracks->GetTheta(i) < 0)   return 2;
+    if (tracks->GetTheta(i) > 180) return 2;
+
+    if(hadron == 1)
+    {
+        identified[i]   = pdgDB->GetParticle("proton")->PdgCode();
+        return 0;
+    }
+
+    if(rules.proton && rules.proton->IsInside(tracks->GetClusterEnergy(i), tracks->GetVetoEnergy(i)))
+        identified[i]   = pdgDB->GetParticle("proton")->PdgCode();
+    if(rules.pion && rules.pion->IsInside(tracks->GetClusterEnergy(i), tracks->GetVetoEnergy(i)))
+        identified[i]   = pdgDB->GetParticle("pi+")->PdgCode();
+    if(rules.electron && rules.electron->IsInside(tracks->GetClusterEnergy(i), tracks->GetVetoEnergy(i)))
+        identified[i]   = pdgDB->GetParticle("e-")->PdgCode();
+    return 1;
+}
+
+// PDG code per track, tracks after a break stay rootinos like in the rule programs
+Bool_t  GBenchPID::OldIdentify(Int_t* identified)
+{
+    GTreeTrack* tracks  = GetTracks();
+    for(Int_t i=0; i<tracks->GetNTracks(); i++)
+        identified[i]   = PDG_ROOTINO;
+
+    for(Int_t i=0; i<tracks->GetNTracks(); i++)
+    {
+        Int_t   result  = 1;
+        if(tracks->HasCB(i))
+            result  = OldSpecies(rulesCB, i, identified, kTRUE);
+        if(result == 1 && tracks->HasTAPS(i))
+            result  = OldSpecies(rulesTAPS, i, identified, kFALSE);
+
+        if(result == 3) return kFALSE;
+        if(result == 2) break;
+    }
+    return kTRUE;
+}
+
+// PDG code per track from the species trees filled by the rule programs
+Bool_t  GBenchPID::NewIdentify(Int_t* identified)
+{
+    GetEventArena().Reset();
+    if(!ProcessEventWithoutFilling())
+        return kFALSE;
+
+    GTreeParticle*  speciesTree[SpeciesCount] = {GetRootinos(), GetPhotons(), GetProtons(), GetChargedPions(), GetElectrons(), GetNeutrons()};
+    for(Int_t s=0; s<SpeciesCount; s++)
+    {
+        for(Int_t p=0; p<speciesTree[s]->GetNParticles(); p++)
+            identified[speciesTree[s]->GetTrackIndex(p)]    = pdgSpecies[s];
+    }
+    return kTRUE;
+}
+
+Bool_t  GBenchPID::Start()
+{
+    GTreeTrack* tracks  = GetTracks();
+    if(!tracks->IsOpenForInput())
+        return kFALSE;
+    nEvents = tracks->GetNEntries();
+    nTracks = 0;
+
+    Int_t       oldIdentified[BENCH_MAX_TRACKS];
+    Int_t       newIdentified[BENCH_MAX_TRACKS];
+    Long64_t    oldAccepted = 0;
+    Long64_t    newAccepted = 0;
+    TStopwatch  watch;
+
+    watch.Start();
+    for(Long64_t e=0; e<nEvents; e++)
+    {
+        tracks->GetEntry(e);
+        nTracks += tracks->GetNTracks();
+    }
+    watch.Stop();
+    Double_t    readTime    = watch.RealTime();
+
+    watch.Start();
+    for(Long64_t e=0; e<nEvents; e++)
+    {
+        tracks->GetEntry(e);
+        oldAccepted += OldIdentify(oldIdentified);
+    }
+    watch.Stop();
+    Double_t    oldTime     = watch.RealTime() - readTime;
+
+    watch.Start();
+    for(Long64_t e=0; e<nEvents; e++)
+    {
+        tracks->GetEntry(e);
+        newAccepted += NewIdentify(newIdentified);
+    }
+    watch.Stop();
+    Double_t    newTime     = watch.RealTime() - readTime;
+
+    // species of every track, outside the timed loops
+    nDiffer = 0;
+    for(Long64_t e=0; e<nEvents; e++)
+    {
+        tracks->GetEntry(e);
+        Bool_t  oldOk   = OldIdentify(oldIdentified);
+        Bool_t  newOk   = NewIdentify(newIdentified);
+        if(oldOk != newOk)
+        {
+            nDiffer++;
+            continue;
+        }
+        if(!oldOk)
+            continue;
+        for(Int_t i=0; i<tracks->GetNTracks(); i++)
+            nDiffer += oldIdentified[i] != newIdentified[i];
+    }
+
+    cout << nEvents << " events, " << nTracks << " tracks:" << endl;
+    cout << "\told identification: " << nTracks/oldTime << " tracks/s, " << oldAccepted << " events accepted" << endl;
+    cout << "\trule programs:      " << nTracks/newTime << " tracks/s, " << newAccepted << " events accepted" << endl;
+    cout << "\t" << nDiffer << " tracks or events with a different result" << endl;
+    return kTRUE;
+}
+
+// tracks tree of random CB and TAPS tracks
+static Bool_t   WriteTracks(const char* fileName, const Long64_t nEvents)
+{
+    TFile   file(fileName, "RECREATE");
+    if(!file.IsOpen())
+        return kFALSE;
+
+    Int_t       nTracks;
+    Double_t    clusterEnergy[BENCH_MAX_TRACKS], theta[BENCH_MAX_TRACKS], phi[BENCH_MAX_TRACKS], time[BENCH_MAX_TRACKS];
+    Int_t       clusterSize[BENCH_MAX_TRACKS], centralCrystal[BENCH_MAX_TRACKS], centralVeto[BENCH_MAX_TRACKS], detectors[BENCH_MAX_TRACKS];
+    Double_t    vetoEnergy[BENCH_MAX_TRACKS], MWPC0Energy[BENCH_MAX_TRACKS], MWPC1Energy[BENCH_MAX_TRACKS];
+    Double_t    pseudoVertexX[BENCH_MAX_TRACKS], pseudoVertexY[BENCH_MAX_TRACKS], pseudoVertexZ[BENCH_MAX_TRACKS];
+
+    TTree*  tree    = new TTree("tracks", "tracks");
+    tree->Branch("nTracks", &nTracks, "nTracks/I");
+    tree->Branch("clusterEnergy", clusterEnergy, "clusterEnergy[nTracks]/D");
+    tree->Branch("theta", theta, "theta[nTracks]/D");
+    tree->Branch("phi", phi, "phi[nTracks]/D");
+    tree->Branch("time", time, "time[nTracks]/D");
+    tree->Branch("clusterSize", clusterSize, "clusterSize[nTracks]/I");
+    tree->Branch("centralCrystal", centralCrystal, "centralCrystal[nTracks]/I");
+    tree->Branch("centralVeto", centralVeto, "centralVeto[nTracks]/I");
+    tree->Branch("detectors", detectors, "detectors[nTracks]/I");
+    tree->Branch("vetoEnergy", vetoEnergy, "vetoEnergy[nTracks]/D");
+    tree->Branch("MWPC0Energy", MWPC0Energy, "MWPC0Energy[nTracks]/D");
+    tree->Branch("MWPC1Energy", MWPC1Energy, "MWPC1Energy[nTracks]/D");
+    tree->Branch("pseudoVertexX", pseudoVertexX, "pseudoVertexX[nTracks]/D");
+    tree->Branch("pseudoVertexY", pseudoVertexY, "pseudoVertexY[nTracks]/D");
+    tree->Branch("pseudoVertexZ", pseudoVertexZ, "pseudoVertexZ[nTracks]/D");
+
+    TRandom3    random(4357);
+    for(Long64_t e=0; e<nEvents; e++)
+    {
+        nTracks = 1 + random.Integer(BENCH_MAX_TRACKS);
+        for(Int_t i=0; i<nTracks; i++)
+        {
+            Bool_t  cb          = random.Rndm() < 0.7;
+            Bool_t  charged     = random.Rndm() < 0.5;
+            detectors[i]        = cb ? (GTreeTrack::DETECTOR_NaI | (charged ? GTreeTrack::DETECTOR_PID : 0)) : (GTreeTrack::DETECTOR_BaF2 | (charged ? GTreeTrack::DETECTOR_Veto : 0));
+            clusterEnergy[i]    = random.Uniform(0, 800);
+            theta[i]            = cb ? random.Uniform(20, 160) : random.Uniform(2, 20);
+            phi[i]              = random.Uniform(-180, 180);
+            time[i]             = random.Uniform(-20, 20);
+            clusterSize[i]      = 1 + random.Integer(12);
+            centralCrystal[i]   = cb ? random.Integer(720) : random.Integer(438);
+            centralVeto[i]      = charged ? random.Integer(cb ? 24 : 438) : -1;
+            vetoEnergy[i]       = charged ? random.Uniform(0, cb ? 10 : 8) : 0;
+            MWPC0Energy[i]      = 0;
+            MWPC1Energy[i]      = 0;
+            pseudoVertexX[i]    = 0;
+            pseudoVertexY[i]    = 0;
+            pseudoVertexZ[i]    = 0;
+        }
+        tree->Fill();
+    }
+    file.Write();
+    file.Close();
+    return kTRUE;
+}
+
+/**
+ * @brief times the particle identification and checks the species
+ * @param argc number of parameters
+ * @param argv [config file with the cuts, default configfiles/GoAT-Pi0.dat] [number of events]
+ * @return exit code, 1 if any species differs
+ */
+int main(int argc, char *argv[])
+{
+    const char* configFile  = argc>1 ? argv[1] : "configfiles/GoAT-Pi0.dat";
+    Long64_t    nEvents     = argc>2 ? atoll(argv[2]) : 1000000;
+    TString     inputFile   = TString::Format("%s/goat-bench-pid-%d-in.root", gSystem->TempDirectory(), gSystem->GetPid());
+    TString     outputFile  = TString::Format("%s/goat-bench-pid-%d-out.root", gSystem->TempDirectory(), gSystem->GetPid());
+
+    GBenchPID   bench;
+    bench.SetConfigFile(configFile);
+    if(!bench.InitBench())
+    {
+        cout << "ERROR: can not set up the particle identification of " << configFile << "!" << endl;
+        return 1;
+    }
+    if(!WriteTracks(inputFile.Data(), nEvents))
+    {
+        cout << "ERROR: can not write " << inputFile << "!" << endl;
+        return 1;
+    }
+    Bool_t  ok  = bench.StartFile(inputFile.Data(), outputFile.Data());
+    gSystem->Unlink(inputFile.Data());
+    gSystem->Unlink(outputFile.Data());
+
+    if(!ok)
+        return 1;
+    return bench.GetNDiffer() ? 1 : 0;
+}
+
+#endif
@@ -0,0 +1,281 @@
+#ifndef __CINT__
+
+#include "GTreeManager.h"
+#include <TFile.h>
+#include <TTree.h>
+#include <TObjArray.h>
+#include <TRandom3.h>
+#include <TStopwatch.h>
+#include <TSystem.h>
+#include <iostream>
+#include <stdlib.h>
+
+using namespace std;
+
+#define BENCH_MAX_TRACKS    2
+#define BENCH_MAX_TAGGED    4
+#define BENCH_MAX_HITS      16
+
+/**
+ * @brief Per event read and fill loops of GTreeManager on a real input
+ *        file, the tree registry against the TObjArray lists it replaced.
+ *
+ *   Start() runs both loops over all entries of the input file, several
+ *   passes in alternating order. The old loops are the ones of
+ *   TraverseEntries() and FillReadList() before the registry: every tree
+ *   taken from a TObjArray and cast back to GTree per event.
+ */
+class  GBenchRegistry : public GTreeManager
+{
+private:
+    Int_t       nPasses;
+    TObjArray   oldReadList;
+    Double_t    oldReadTime;
+    Double_t    oldFillTime;
+    Double_t    newReadTime;
+    Double_t    newFillTime;
+    Long64_t    nEvents;
+
+    void    OldLoop(const Bool_t fill);
+    void    NewLoop(const Bool_t fill);
+
+protected:
+    virtual void    ProcessEvent()  {}
+    virtual Bool_t  Start();
+
+public:
+    GBenchRegistry(const Int_t passes);
+    virtual ~GBenchRegistry()   {}
+};
+
+GBenchRegistry::GBenchRegistry(const Int_t passes)  :
+    nPasses(passes),
+    oldReadTime(0),
+    oldFillTime(0),
+    newReadTime(0),
+    newFillTime(0),
+    nEvents(0)
+{
+}
+
+void    GBenchRegistry::OldLoop(const Bool_t fill)
+{
+    for(Long64_t i=0; i<nEvents; i++)
+    {
+        for(Int_t l=0; l<oldReadList.GetEntriesFast(); l++)
+            ReadEntry(i, (GTree*)oldReadList[l]);
+        GetEventParameters()->SetEventNumber(i);
+        if(fill)
+        {
+            for(Int_t l=0; l<oldReadList.GetEntriesFast(); l++)
+                ((GTree*)oldReadList[l])->Fill();
+        }
+    }
+}
+
+void    GBenchRegistry::NewLoop(const Bool_t fill)
+{
+    for(Long64_t i=0; i<nEvents; i++)
+    {
+        ReadEntry(i);
+        if(fill)
+            FillReadList();
+    }
+}
+
+Bool_t  GBenchRegistry::Start()
+{
+    // the trees open for input, in the order of the registry
+    oldReadList.Clear();
+    for(Int_t l=0; l<GetTreeList().GetEntries(); l++)
+    {
+        if(GetTreeList()[l]->IsOpenForInput())
+            oldReadList.Add((TObject*)GetTreeList()[l]);
+    }
+    if(oldReadList.GetEntriesFast() == 0)
+    {
+        cout << "ERROR: no event tree in the input file!" << endl;
+        return kFALSE;
+    }
+    nEvents = ((GTree*)oldReadList[0])->GetNEntries();
+
+    TStopwatch  watch;
+    for(Int_t p=0; p<nPasses; p++)
+    {
+        for(Int_t k=0; k<2; k++)
+        {
+            Bool_t  old = (p+k) % 2 == 0;
+            watch.Start();
+            old ? OldLoop(kFALSE) : NewLoop(kFALSE);
+            watch.Stop();
+            (old ? oldReadTime : newReadTime)   += watch.RealTime();
+
+            watch.Start();
+            old ? OldLoop(kTRUE) : NewLoop(kTRUE);
+            watch.Stop();
+            (old ? oldFillTime : newFillTime)   += watch.RealTime();
+        }
+    }
+
+    Double_t    n   = Double_t(nEvents)*nPasses;
+    cout << nEvents << " events, " << oldReadList.GetEntriesFast() << " trees read, " << nPasses << " passes:" << endl;
+    cout << "\tread:        lists " << 1e9*oldReadTime/n << " ns, registry " << 1e9*newReadTime/n << " ns per event" << endl;
+    cout << "\tread + fill: lists " << 1e9*oldFillTime/n << " ns, registry " << 1e9*newFillTime/n << " ns per event" << endl;
+    return kTRUE;
+}
+
+// small events like a 1 or 2 particle MC file: tracks, tagger, trigger and detectorHits
+static Bool_t   WriteEvents(const char* fileName, const Long64_t nEvents)
+{
+    TFile   file(fileName, "RECREATE");
+    if(!file.IsOpen())
+        return kFALSE;
+
+    Int_t       nTracks;
+    Double_t    clusterEnergy[BENCH_MAX_TRACKS], theta[BENCH_MAX_TRACKS], phi[BENCH_MAX_TRACKS], time[BENCH_MAX_TRACKS];
+    Int_t       clusterSize[BENCH_MAX_TRACKS], centralCrystal[BENCH_MAX_TRACKS], centralVeto[BENCH_MAX_TRACKS], detectors[BENCH_MAX_TRACKS];
+    Double_t    vetoEnergy[BENCH_MAX_TRACKS], MWPC0Energy[BENCH_MAX_TRACKS], MWPC1Energy[BENCH_MAX_TRACKS];
+    Double_t    pseudoVertexX[BENCH_MAX_TRACKS], pseudoVertexY[BENCH_MAX_TRACKS], pseudoVertexZ[BENCH_MAX_TRACKS];
+    TTree*  tracks  = new TTree("tracks", "tracks");
+    tracks->Branch("nTracks", &nTracks, "nTracks/I");
+    tracks->Branch("clusterEnergy", clusterEnergy, "clusterEnergy[nTracks]/D");
+    tracks->Branch("theta", theta, "theta[nTracks]/D");
+    tracks->Branch("phi", phi, "phi[nTracks]/D");
+    tracks->Branch("time", time, "time[nTracks]/D");
+    tracks->Branch("clusterSize", clusterSize, "clusterSize[nTracks]/I");
+    tracks->Branch("centralCrystal", centralCrystal, "centralCrystal[nTracks]/I");
+    tracks->Branch("centralVeto", centralVeto, "centralVeto[nTracks]/I");
+    tracks->Branch("detectors", detectors, "detectors[nTracks]/I");
+    tracks->Branch("vetoEnergy", vetoEnergy, "vetoEnergy[nTracks]/D");
+    tracks->Branch("MWPC0Energy", MWPC0Energy, "MWPC0Energy[nTracks]/D");
+    tracks->Branch("MWPC1Energy", MWPC1Energy, "MWPC1Energy[nTracks]/D");
+    tracks->Branch("pseudoVertexX", pseudoVertexX, "pseudoVertexX[nTracks]/D");
+    tracks->Branch("pseudoVertexY", pseudoVertexY, "pseudoVertexY[nTracks]/D");
+    tracks->Branch("pseudoVertexZ", pseudoVertexZ, "pseudoVertexZ[nTracks]/D");
+
+    Int_t       nTagged;
+    Int_t       taggedChannel[BENCH_MAX_TAGGED];
+    Double_t    taggedTime[BENCH_MAX_TAGGED];
+    TTree*  tagger  = new TTree("tagger", "tagger");
+    tagger->Branch("nTagged", &nTagged, "nTagged/I");
+    tagger->Branch("taggedChannel", taggedChannel, "taggedChannel[nTagged]/I");
+    tagger->Branch("taggedTime", taggedTime, "taggedTime[nTagged]/D");
+
+    Double_t    energySum;
+    Int_t       multiplicity;
+    Int_t       nTriggerPattern = 0;
+    Int_t       triggerPattern[1];
+    Int_t       nErrors = 0;
+    Int_t       errorModuleID[1], errorModuleIndex[1], errorCode[1];
+    TTree*  trigger = new TTree("trigger", "trigger");
+    trigger->Branch("energySum", &energySum, "energySum/D");
+    trigger->Branch("multiplicity", &multiplicity, "multiplicity/I");
+    trigger->Branch("nTriggerPattern", &nTriggerPattern, "nTriggerPattern/I");
+    trigger->Branch("triggerPattern", triggerPattern, "triggerPattern[nTriggerPattern]/I");
+    trigger->Branch("nErrors", &nErrors, "nErrors/I");
+    trigger->Branch("errorModuleID", errorModuleID, "errorModuleID[nErrors]/I");
+    trigger->Branch("errorModuleIndex", errorModuleIndex, "errorModuleIndex[nErrors]/I");
+    trigger->Branch("errorCode", errorCode, "errorCode[nErrors]/I");
+
+    Int_t       nNaIHits, nPIDHits = 0, nMWPCHits = 0, nBaF2Hits, nVetoHits = 0;
+    Int_t       NaIHits[BENCH_MAX_HITS], NaICluster[BENCH_MAX_HITS], BaF2Hits[BENCH_MAX_HITS], BaF2Cluster[BENCH_MAX_HITS];
+    Int_t       PIDHits[1], MWPCHits[1], VetoHits[1];
+    TTree*  hits    = new TTree("detectorHits", "detectorHits");
+    hits->Branch("nNaIHits", &nNaIHits, "nNaIHits/I");
+    hits->Branch("NaIHits", NaIHits, "NaIHits[nNaIHits]/I");
+    hits->Branch("NaICluster", NaICluster, "NaICluster[nNaIHits]/I");
+    hits->Branch("nPIDHits", &nPIDHits, "nPIDHits/I");
+    hits->Branch("PIDHits", PIDHits, "PIDHits[nPIDHits]/I");
+    hits->Branch("nMWPCHits", &nMWPCHits, "nMWPCHits/I");
+    hits->Branch("MWPCHits", MWPCHits, "MWPCHits[nMWPCHits]/I");
+    hits->Branch("nBaF2Hits", &nBaF2Hits, "nBaF2Hits/I");
+    hits->Branch("BaF2Hits", BaF2Hits, "BaF2Hits[nBaF2Hits]/I");
+    hits->Branch("BaF2Cluster", BaF2Cluster, "BaF2Cluster[nBaF2Hits]/I");
+    hits->Branch("nVetoHits", &nVetoHits, "nVetoHits/I");
+    hits->Branch("VetoHits", VetoHits, "VetoHits[nVetoHits]/I");
+
+    TRandom3    random(4357);
+    for(Long64_t e=0; e<nEvents; e++)
+    {
+        nTracks     = 1 + random.Integer(BENCH_MAX_TRACKS);
+        nNaIHits    = 0;
+        nBaF2Hits   = 0;
+        energySum   = 0;
+        for(Int_t i=0; i<nTracks; i++)
+        {
+            Bool_t  cb          = random.Rndm() < 0.8;
+            detectors[i]        = cb ? GTreeTrack::DETECTOR_NaI : GTreeTrack::DETECTOR_BaF2;
+            clusterEnergy[i]    = random.Uniform(20, 800);
+            theta[i]            = cb ? random.Uniform(20, 160) : random.Uniform(2, 20);
+            phi[i]              = random.Uniform(-180, 180);
+            time[i]             = random.Uniform(-5, 5);
+            clusterSize[i]      = 1 + random.Integer(BENCH_MAX_HITS/BENCH_MAX_TRACKS);
+            centralCrystal[i]   = cb ? random.Integer(720) : random.Integer(438);
+            centralVeto[i]      = -1;
+            vetoEnergy[i]       = 0;
+            MWPC0Energy[i]      = 0;
+            MWPC1Energy[i]      = 0;
+            pseudoVertexX[i]    = 0;
+            pseudoVertexY[i]    = 0;
+            pseudoVertexZ[i]    = 0;
+            energySum           += clusterEnergy[i];
+            for(Int_t h=0; h<clusterSize[i]; h++)
+            {
+                if(cb)
+                {
+                    NaIHits[nNaIHits]       = (centralCrystal[i] + h) % 720;
+                    NaICluster[nNaIHits++]  = centralCrystal[i];
+                }
+                else
+                {
+                    BaF2Hits[nBaF2Hits]     = (centralCrystal[i] + h) % 438;
+                    BaF2Cluster[nBaF2Hits++]    = centralCrystal[i];
+                }
+            }
+        }
+        multiplicity    = nTracks;
+        nTagged         = 1 + random.Integer(BENCH_MAX_TAGGED);
+        for(Int_t t=0; t<nTagged; t++)
+        {
+            taggedChannel[t]    = random.Integer(352);
+            taggedTime[t]       = random.Uniform(-50, 50);
+        }
+        tracks->Fill();
+        tagger->Fill();
+        trigger->Fill();
+        hits->Fill();
+    }
+    file.Write();
+    file.Close();
+    return kTRUE;
+}
+
+/**
+ * @brief times the per event read and fill loops, registry against the old lists
+ * @param argc number of parameters
+ * @param argv [number of events, default 1000000] [passes, default 3] [input file instead of generated events]
+ * @return exit code
+ */
+int main(int argc, char *argv[])
+{
+    Long64_t    nEvents     = argc>1 ? atoll(argv[1]) : 1000000;
+    Int_t       nPasses     = argc>2 ? atoi(argv[2]) : 3;
+    TString     inputFile   = argc>3 ? TString(argv[3]) : TString::Format("%s/goat-bench-registry-%d-in.root", gSystem->TempDirectory(), gSystem->GetPid());
+    TString     outputFile  = TString::Format("%s/goat-bench-registry-%d-out.root", gSystem->TempDirectory(), gSystem->GetPid());
+
+    if(argc<=3 && !WriteEvents(inputFile.Data(), nEvents))
+    {
+        cout << "ERROR: can not write " << inputFile << "!" << endl;
+        return 1;
+    }
+
+    GBenchRegistry  bench(nPasses);
+    Bool_t  ok  = bench.StartFile(inputFile.Data(), outputFile.Data());
+    if(argc<=3)
+        gSystem->Unlink(inputFile.Data());
+    gSystem->Unlink(outputFile.Data());
+
+    return ok ? 0 : 1;
+}
+
+#endif
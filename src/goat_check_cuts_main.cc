@@ -0,0 +1,156 @@
+#ifndef __CINT__
+
+#include "GCutRaster.h"
+#include <TFile.h>
+#include <TKey.h>
+#include <TSystemDirectory.h>
+#include <TSystemFile.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+#define CHECK_GRID          1001    // points per axis of the dense grid
+#define CHECK_EDGE_POINTS   64      // points per polygon edge
+
+/**
+ * @brief GCutRaster::IsInside against TCutG::IsInside for one cut
+ * @return number of points with a different answer
+ */
+static Long64_t CheckCut(TCutG* cut, Long64_t& nPoints)
+{
+    GCutRaster  raster(cut);
+    Int_t       n       = cut->GetN();
+    Double_t*   x       = cut->GetX();
+    Double_t*   y       = cut->GetY();
+    Long64_t    nDiffer = 0;
+    if(n < 1)
+        return 0;
+
+    Double_t    xMin    = x[0],  xMax   = x[0];
+    Double_t    yMin    = y[0],  yMax   = y[0];
+    for(Int_t i=1; i<n; i++)
+    {
+        if(x[i] < xMin) xMin    = x[i];
+        if(x[i] > xMax) xMax    = x[i];
+        if(y[i] < yMin) yMin    = y[i];
+        if(y[i] > yMax) yMax    = y[i];
+    }
+    Double_t    width   = xMax - xMin;
+    Double_t    height  = yMax - yMin;
+
+    // dense grid over the bounding box and a margin around it
+    for(Int_t iy=0; iy<CHECK_GRID; iy++)
+    {
+        Double_t    py  = yMin - 0.05*height + 1.1*height*iy/(CHECK_GRID-1);
+        for(Int_t ix=0; ix<CHECK_GRID; ix++)
+        {
+            Double_t    px  = xMin - 0.05*width + 1.1*width*ix/(CHECK_GRID-1);
+            nDiffer += raster.IsInside(px, py) != (cut->IsInside(px, py) != 0);
+            nPoints++;
+        }
+    }
+
+    // corners of the raster cells
+    for(Int_t iy=0; iy<=GCutRaster_CELLS; iy++)
+    {
+        Double_t    py  = yMin + height*iy/GCutRaster_CELLS;
+        for(Int_t ix=0; ix<=GCutRaster_CELLS; ix++)
+        {
+            Double_t    px  = xMin + width*ix/GCutRaster_CELLS;
+            nDiffer += raster.IsInside(px, py) != (cut->IsInside(px, py) != 0);
+            nPoints++;
+        }
+    }
+
+    // vertices and points on and next to every edge, including the closing one
+    const Double_t  dx  = 1e-9*width;
+    const Double_t  dy  = 1e-9*height;
+    for(Int_t i=0, j=n-1; i<n; j=i++)
+    {
+        for(Int_t k=0; k<=CHECK_EDGE_POINTS; k++)
+        {
+            Double_t    t   = Double_t(k)/CHECK_EDGE_POINTS;
+            Double_t    px  = x[j] + t*(x[i] - x[j]);
+            Double_t    py  = y[j] + t*(y[i] - y[j]);
+            for(Int_t oy=-1; oy<=1; oy++)
+            {
+                for(Int_t ox=-1; ox<=1; ox++)
+                {
+                    nDiffer += raster.IsInside(px + ox*dx, py + oy*dy) != (cut->IsInside(px + ox*dx, py + oy*dy) != 0);
+                    nPoints++;
+                }
+            }
+        }
+    }
+    return nDiffer;
+}
+
+/**
+ * @brief checks the rasterised cuts of the given files
+ * @param argc number of parameters
+ * @param argv cut files, default all files in configfiles/cuts
+ * @return exit code, 1 if any point differs
+ */
+int main(int argc, char *argv[])
+{
+    std::vector<std::string>    files;
+    for(Int_t i=1; i<argc; i++)
+        files.push_back(argv[i]);
+    if(files.empty())
+    {
+        TSystemDirectory    directory("cuts", "configfiles/cuts");
+        TList*  fileList    = directory.GetListOfFiles();
+        if(fileList)
+        {
+            fileList->Sort();
+            TIter       next(fileList);
+            TSystemFile*    systemFile;
+            while((systemFile=(TSystemFile*)next()))
+            {
+                std::string name    = systemFile->GetName();
+                if(name.length() > 5 && name.substr(name.length()-5) == ".root")
+                    files.push_back("configfiles/cuts/" + name);
+            }
+        }
+    }
+    if(files.empty())
+    {
+        cout << "Usage: goat-check-cuts [cut files], default configfiles/cuts/*.root" << endl;
+        return 1;
+    }
+
+    Int_t       nCuts   = 0;
+    Long64_t    nFailed = 0;
+    for(UInt_t f=0; f<files.size(); f++)
+    {
+        TFile*  file    = TFile::Open(files[f].c_str());
+        if(!file)
+        {
+            cout << "ERROR: can not open " << files[f] << "!" << endl;
+            nFailed++;
+            continue;
+        }
+        TIter   next(file->GetListOfKeys());
+        TKey*   key;
+        while((key=(TKey*)next()))
+        {
+            TCutG*  cut = dynamic_cast<TCutG*>(key->ReadObj());
+            if(!cut)
+                continue;
+            Long64_t    nPoints = 0;
+            Long64_t    nDiffer = CheckCut(cut, nPoints);
+            cout << files[f] << " " << cut->GetName() << ": " << cut->GetN() << " vertices, " << nPoints << " points, " << nDiffer << " differ" << endl;
+            nFailed += nDiffer;
+            nCuts++;
+        }
+        file->Close();
+        delete file;
+    }
+
+    cout << nCuts << " cuts checked, " << nFailed << " differences." << endl;
+    return nFailed ? 1 : 0;
+}
+
+#endif
@@ -0,0 +1,207 @@
+#ifndef __CINT__
+
+#include "GMesonFit.h"
+#include <TRandom3.h>
+#include <TStopwatch.h>
+#include <TMath.h>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+using namespace std;
+
+#define CHECK_MAX_BEAM      16
+#define CHECK_MAX_PULL_MEAN 0.1     // allowed |mean| of a pull
+#define CHECK_MAX_PULL_RMS  0.1     // allowed |sigma - 1| of a pull
+#define CHECK_MIN_CONVERGED 0.99    // allowed fraction of converged fits
+
+// p boosted by the velocity b
+static GP4  Boost(const GP4& p, const Double_t bx, const Double_t by, const Double_t bz)
+{
+    const Double_t  b2      = bx*bx + by*by + bz*bz;
+    if(b2 <= 0)
+        return p;
+    const Double_t  gamma   = 1/sqrt(1 - b2);
+    const Double_t  bp      = bx*p.px + by*p.py + bz*p.pz;
+    const Double_t  f       = (gamma - 1)*bp/b2 + gamma*p.e;
+    return GP4(p.px + f*bx, p.py + f*by, p.pz + f*bz, gamma*(p.e + bp));
+}
+
+// isotropic 2 body decay of a particle of mass m at rest
+static void Decay(TRandom3& random, const Double_t m, const Double_t m1, const Double_t m2, GP4& p1, GP4& p2)
+{
+    const Double_t  e1      = (m*m + m1*m1 - m2*m2)/(2*m);
+    const Double_t  p       = sqrt(TMath::Max(e1*e1 - m1*m1, 0.0));
+    const Double_t  cosT    = 2*random.Uniform() - 1;
+    const Double_t  sinT    = sqrt(1 - cosT*cosT);
+    const Double_t  phi     = random.Uniform(TMath::TwoPi());
+    p1  = GP4( p*sinT*cos(phi),  p*sinT*sin(phi),  p*cosT, e1);
+    p2  = GP4(-p*sinT*cos(phi), -p*sinT*sin(phi), -p*cosT, m - e1);
+}
+
+struct  GCheckEvent
+{
+    Double_t    measured[6];
+    Double_t    sigma[6];
+    Double_t    beam[CHECK_MAX_BEAM];   // the true tagger hit first
+};
+
+struct  GCheckPull
+{
+    Long64_t    n;
+    Double_t    sum;
+    Double_t    sum2;
+
+    GCheckPull()    : n(0), sum(0), sum2(0) {}
+    void        Add(const Double_t pull)    {n++; sum += pull; sum2 += pull*pull;}
+    Double_t    Mean()  const   {return n ? sum/n : 0;}
+    Double_t    Sigma() const   {return n ? sqrt(TMath::Max(sum2/n - Mean()*Mean(), 0.0)) : 0;}
+    Bool_t      Good()  const   {return n > 0 && TMath::Abs(Mean()) < CHECK_MAX_PULL_MEAN && TMath::Abs(Sigma() - 1) < CHECK_MAX_PULL_RMS;}
+};
+
+// prints the pulls, returns the number out of tolerance
+static Int_t    PrintPulls(const Int_t n, const GCheckPull* pull)
+{
+    const Char_t*   name[] = {"E", "theta", "phi"};
+    Int_t           nBad   = 0;
+    for(Int_t i=0; i<n; i++)
+    {
+        cout << "\t\tpull " << (i < n - n%6 ? name[i%3] : "beam") << " " << i << ": mean " << pull[i].Mean() << ", sigma " << pull[i].Sigma();
+        if(!pull[i].Good())
+        {
+            cout << "   #ERROR: out of tolerance!";
+            nBad++;
+        }
+        cout << endl;
+    }
+    return nBad;
+}
+
+/**
+ * @brief GMesonFit on smeared gamma p -> pi0 p, pi0 -> 2 gamma events: the
+ *        pulls of the pi0 mass fit and of the event fit with the true tagger
+ *        hit must have mean 0 and sigma 1, and the fits must converge. Also
+ *        times the fits per hypothesis (meson or tagger hit).
+ * @param argc number of parameters
+ * @param argv [number of events] [tagger hits per event]
+ * @return exit code, 1 if a pull or the convergence is out of tolerance
+ */
+int main(int argc, char *argv[])
+{
+    Long64_t    nEvents = argc>1 ? atoll(argv[1]) : 100000;
+    Int_t       nBeam   = argc>2 ? atoi(argv[2]) : 8;
+    if(nEvents < 1 || nBeam < 1 || nBeam > CHECK_MAX_BEAM)
+    {
+        cout << "#ERROR: at least 1 event and 1 to " << CHECK_MAX_BEAM << " tagger hits per event!" << endl;
+        return 1;
+    }
+
+    GMesonFit   fitter;
+    TRandom3    random(4357);
+    TStopwatch  watch;
+    Double_t    massPi0     = MASS_PI0;
+    Double_t    target      = fitter.GetTargetMass();
+
+    // gamma p -> pi0 p, isotropic in the centre of mass, both photons in
+    // Crystal Ball or TAPS and smeared by their resolutions
+    vector<GCheckEvent> events;
+    events.reserve(nEvents);
+    while((Long64_t)events.size() < nEvents)
+    {
+        const Double_t  beamEnergy  = random.Uniform(200, 1400);
+        const Double_t  sqrtS       = sqrt(target*target + 2*beamEnergy*target);
+        if(sqrtS < massPi0 + target)
+            continue;
+        GP4     pi0, recoil;
+        Decay(random, sqrtS, massPi0, target, pi0, recoil);
+        pi0     = Boost(pi0, 0, 0, beamEnergy/(beamEnergy + target));
+
+        GP4     photon[2];
+        Decay(random, massPi0, 0, 0, photon[0], photon[1]);
+
+        GCheckEvent event;
+        Bool_t      accepted    = kTRUE;
+        for(Int_t d=0; d<2; d++)
+        {
+            photon[d]   = Boost(photon[d], pi0.px/pi0.e, pi0.py/pi0.e, pi0.pz/pi0.e);
+            const Double_t  p       = sqrt(photon[d].px*photon[d].px + photon[d].py*photon[d].py + photon[d].pz*photon[d].pz);
+            const Double_t  theta   = acos(photon[d].pz/p);
+            const Double_t  phi     = atan2(photon[d].py, photon[d].px);
+            if(photon[d].e < 20 || theta < 2*TMath::DegToRad() || theta > 160*TMath::DegToRad())
+                accepted    = kFALSE;
+            GMesonFit::Resolution(photon[d].e, theta, theta < 20*TMath::DegToRad(), event.sigma + 3*d);
+            event.measured[3*d]     = photon[d].e + random.Gaus(0, event.sigma[3*d]);
+            event.measured[3*d+1]   = theta + random.Gaus(0, event.sigma[3*d+1]);
+            event.measured[3*d+2]   = phi + random.Gaus(0, event.sigma[3*d+2]);
+        }
+        if(!accepted)
+            continue;
+
+        event.beam[0]   = beamEnergy + random.Gaus(0, fitter.GetBeamResolution());
+        for(Int_t t=1; t<nBeam; t++)
+            event.beam[t]   = random.Uniform(200, 1400);
+        events.push_back(event);
+    }
+
+    // pulls, chi2 and convergence
+    GCheckPull  mesonPull[6];
+    GCheckPull  eventPull[7];
+    Long64_t    nMesonConverged     = 0;
+    Long64_t    nMesonIterations    = 0;
+    Double_t    mesonChi2           = 0;
+    Long64_t    nEventConverged     = 0;
+    Double_t    eventChi2           = 0;
+    Double_t    pulls[7];
+    Double_t    chi2;
+    for(Long64_t e=0; e<nEvents; e++)
+    {
+        if(fitter.FitMeson(massPi0, events[e].measured, events[e].sigma))
+        {
+            const GKinFit<6, 0, 1>& fit = fitter.GetMesonFit();
+            nMesonConverged++;
+            nMesonIterations    += fit.GetNIterations();
+            mesonChi2           += fit.GetChi2();
+            for(Int_t i=0; i<6; i++)
+                mesonPull[i].Add(fit.GetPull(i));
+        }
+        if(fitter.FitEvent(1, &massPi0, events[e].measured, events[e].sigma, 1, events[e].beam, chi2, pulls) == 0)
+        {
+            nEventConverged++;
+            eventChi2   += chi2;
+            for(Int_t i=0; i<7; i++)
+                eventPull[i].Add(pulls[i]);
+        }
+    }
+
+    // time per hypothesis
+    Long64_t    nConverged  = 0;
+    watch.Start();
+    for(Long64_t e=0; e<nEvents; e++)
+        nConverged  += fitter.FitMeson(massPi0, events[e].measured, events[e].sigma);
+    watch.Stop();
+    Double_t    mesonTime   = watch.RealTime();
+
+    Long64_t    nBestTrue   = 0;
+    watch.Start();
+    for(Long64_t e=0; e<nEvents; e++)
+        nBestTrue   += fitter.FitEvent(1, &massPi0, events[e].measured, events[e].sigma, nBeam, events[e].beam, chi2) == 0;
+    watch.Stop();
+    Double_t    eventTime   = watch.RealTime();
+
+    cout << nEvents << " smeared gamma p -> pi0 p, pi0 -> 2 gamma events, target mass " << target << " MeV:" << endl;
+    cout << "\tpi0 mass fit: " << nMesonConverged << " converged, mean chi2 " << (nMesonConverged ? mesonChi2/nMesonConverged : 0) << " (1 dof), "
+         << (nMesonConverged ? Double_t(nMesonIterations)/nMesonConverged : 0) << " iterations, " << 1e6*mesonTime/nEvents << " us per fit" << endl;
+    Int_t   nBad    = PrintPulls(6, mesonPull);
+    cout << "\tevent fit with the true tagger hit: " << nEventConverged << " converged, mean chi2 " << (nEventConverged ? eventChi2/nEventConverged : 0) << " (2 dof)" << endl;
+    nBad    += PrintPulls(7, eventPull);
+    cout << "\tevent fit with " << nBeam << " tagger hits: " << 1e6*eventTime/(Double_t(nEvents)*nBeam) << " us per tagger hit, true hit chosen in " << nBestTrue << " events" << endl;
+
+    if(nMesonConverged < CHECK_MIN_CONVERGED*nEvents || nEventConverged < CHECK_MIN_CONVERGED*nEvents)
+    {
+        cout << "#ERROR: less than " << 100*CHECK_MIN_CONVERGED << "% of the fits converged!" << endl;
+        nBad++;
+    }
+    return nBad ? 1 : 0;
+}
+
+#endif
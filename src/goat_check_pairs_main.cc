@@ -0,0 +1,162 @@
+#ifndef __CINT__
+
+#include "GMesonReconstruction.h"
+#include <TRandom3.h>
+#include <TMath.h>
+#include <iostream>
+#include <stdlib.h>
+
+using namespace std;
+
+#define CHECK_MAX_PARTICLES 10
+#define CHECK_MAX_PAIRS     (CHECK_MAX_PARTICLES*(CHECK_MAX_PARTICLES-1)/2)
+
+/**
+ * @brief 2 particle meson candidates of GMesonReconstruction against the
+ *        TLorentzVector pair loop they replaced.
+ */
+class  GCheckPairs : public GMesonReconstruction
+{
+private:
+    Double_t    massPi0;
+    Double_t    massEta;
+    Double_t    massEtaP;
+
+    // candidates of the pair loop before the flat passes
+    Int_t   OldCandidates(const Int_t n, const TLorentzVector* p4, Double_t* mass, Int_t* index1, Int_t* index2, Int_t* type, Double_t* diff)   const;
+    // candidates of the flat passes in ReconstructMesons
+    Int_t   NewCandidates(const Int_t n, const TLorentzVector* p4, Double_t* mass, Int_t* index1, Int_t* index2, Int_t* type, Double_t* diff)   const;
+
+public:
+    GCheckPairs();
+    virtual ~GCheckPairs()  {}
+
+    // returns the number of differing values
+    Int_t   Compare(const Int_t n, const TLorentzVector* p4)   const;
+};
+
+GCheckPairs::GCheckPairs()  :
+    massPi0(pdgDB->GetParticle("pi0" )->Mass()*1000),
+    massEta(pdgDB->GetParticle("eta" )->Mass()*1000),
+    massEtaP(pdgDB->GetParticle("eta'")->Mass()*1000)
+{
+    SetNeutralPionWidth(DEFAULT_WIDTH_NEUTRAL_PION);
+    SetEtaWidth(DEFAULT_WIDTH_ETA);
+    SetEtaPrimeWidth(DEFAULT_WIDTH_ETA_PRIME);
+}
+
+Int_t   GCheckPairs::OldCandidates(const Int_t n, const TLorentzVector* p4, Double_t* mass, Int_t* index1, Int_t* index2, Int_t* type, Double_t* diff)   const
+{
+    Int_t k = 0;
+    Int_t p = 0;
+    for (Int_t i = 0; i < n; i++)
+    {
+        for (Int_t j = i+1; j < n; j++, p++)
+        {
+            mass[p] = (p4[i] + p4[j]).M();
+            Double_t diff_pi0  = TMath::Abs( mass[p] - massPi0  )/DEFAULT_WIDTH_NEUTRAL_PION;
+            Double_t diff_eta  = TMath::Abs( mass[p] - massEta  )/DEFAULT_WIDTH_ETA;
+            Double_t diff_etap = TMath::Abs( mass[p] - massEtaP )/DEFAULT_WIDTH_ETA_PRIME;
+
+            if ((diff_pi0 <= 1.0) && (diff_pi0 < diff_eta) && (diff_pi0 < diff_etap))
+            {
+                diff[k]     = diff_pi0;
+                type[k]     = MESON_PI0;
+                index1[k]   = i;
+                index2[k]   = j;
+                k++;
+            }
+            else if ((diff_eta <= 1.0) && (diff_eta < diff_pi0) && (diff_eta < diff_etap))
+            {
+                diff[k]     = diff_eta;
+                type[k]     = MESON_ETA;
+                index1[k]   = i;
+                index2[k]   = j;
+                k++;
+            }
+            else if ((diff_etap <= 1.0) && (diff_etap < diff_pi0) && (diff_etap < diff_eta))
+            {
+                diff[k]     = diff_etap;
+                type[k]     = MESON_ETA_PRIME;
+                index1[k]   = i;
+                index2[k]   = j;
+                k++;
+            }
+        }
+    }
+    return k;
+}
+
+Int_t   GCheckPairs::NewCandidates(const Int_t n, const TLorentzVector* p4, Double_t* mass, Int_t* index1, Int_t* index2, Int_t* type, Double_t* diff)   const
+{
+    GP4         daughter_p4[CHECK_MAX_PARTICLES];
+    Int_t       pair_type[CHECK_MAX_PAIRS];
+    Double_t    pair_diff[CHECK_MAX_PAIRS];
+    for (Int_t i = 0; i < n; i++)
+        daughter_p4[i]  = GP4(p4[i]);
+
+    GKinematics::PairMasses(n, daughter_p4, mass);
+    ClassifyPairs(n*(n-1)/2, mass, pair_type, pair_diff);
+    return CompactPairs(n, pair_type, pair_diff, index1, index2, type, diff);
+}
+
+Int_t   GCheckPairs::Compare(const Int_t n, const TLorentzVector* p4)   const
+{
+    Double_t    oldMass[CHECK_MAX_PAIRS],   newMass[CHECK_MAX_PAIRS];
+    Int_t       oldIndex1[CHECK_MAX_PAIRS], newIndex1[CHECK_MAX_PAIRS];
+    Int_t       oldIndex2[CHECK_MAX_PAIRS], newIndex2[CHECK_MAX_PAIRS];
+    Int_t       oldType[CHECK_MAX_PAIRS],   newType[CHECK_MAX_PAIRS];
+    Double_t    oldDiff[CHECK_MAX_PAIRS],   newDiff[CHECK_MAX_PAIRS];
+
+    Int_t   oldK    = OldCandidates(n, p4, oldMass, oldIndex1, oldIndex2, oldType, oldDiff);
+    Int_t   newK    = NewCandidates(n, p4, newMass, newIndex1, newIndex2, newType, newDiff);
+
+    Int_t   nDiffer = 0;
+    for (Int_t p = 0; p < n*(n-1)/2; p++)
+        nDiffer += oldMass[p] != newMass[p];
+    if(oldK != newK)
+        return nDiffer + 1;
+    for (Int_t k = 0; k < oldK; k++)
+        nDiffer += oldIndex1[k] != newIndex1[k] || oldIndex2[k] != newIndex2[k] || oldType[k] != newType[k] || oldDiff[k] != newDiff[k];
+    return nDiffer;
+}
+
+/**
+ * @brief compares the candidate lists on random events
+ * @param argc number of parameters
+ * @param argv [number of events]
+ * @return exit code, 1 if any candidate list differs
+ */
+int main(int argc, char *argv[])
+{
+    Long64_t    nEvents = argc>1 ? atoll(argv[1]) : 200000;
+
+    GCheckPairs     check;
+    TRandom3        random(4357);
+    TLorentzVector  p4[CHECK_MAX_PARTICLES];
+    Long64_t        nFailed = 0;
+    for(Long64_t e=0; e<nEvents; e++)
+    {
+        // photons with 2 to CHECK_MAX_PARTICLES per event, pair masses cover all windows
+        Int_t   n   = 2 + random.Integer(CHECK_MAX_PARTICLES-1);
+        for(Int_t i=0; i<n; i++)
+        {
+            Double_t    energy  = random.Uniform(20, 600);
+            Double_t    cosTh   = random.Uniform(-1, 1);
+            Double_t    sinTh   = TMath::Sqrt(1 - cosTh*cosTh);
+            Double_t    phi     = random.Uniform(0, TMath::TwoPi());
+            p4[i].SetPxPyPzE(energy*sinTh*TMath::Cos(phi), energy*sinTh*TMath::Sin(phi), energy*cosTh, energy);
+        }
+        if(check.Compare(n, p4) != 0)
+        {
+            if(nFailed < 10)
+                cout << "ERROR: candidates of event " << e << " with " << n << " photons differ!" << endl;
+            nFailed++;
+        }
+    }
+
+    cout << nFailed << " of " << nEvents << " events with differing pair masses or candidates." << endl;
+    return nFailed ? 1 : 0;
+}
+
+#endif
@@ -0,0 +1,406 @@
+#ifndef __CINT__
+
+#include "GTreeManager.h"
+#include "GReclustering.h"
+#include <TFile.h>
+#include <TTree.h>
+#include <TSystem.h>
+#include <TMath.h>
+#include <iostream>
+#include <stdlib.h>
+
+using namespace std;
+
+#define CHECK_MAX_TRACKS    2
+#define CHECK_MAX_HITS      4
+#define CHECK_MAX_ENERGY    150     // merge limit (MeV), above the smaller part of the split event
+#define CHECK_MAX_ANGLE     30      // merge limit (deg)
+#define CHECK_SPLIT_ENERGY  20      // minimum energy of a local maximum (MeV)
+
+// the known events, in the order of the input file
+enum
+{
+    EVENT_MERGE     = 0,    // a neutral split-off next to a neutral cluster
+    EVENT_CHARGED,          // the same with a veto hit on the split-off
+    EVENT_SEPARATE,         // two clusters in different crystal regions
+    EVENT_SPLIT,            // one cluster with two local maxima
+    N_EVENTS
+};
+
+// crystals of the known events, all in Crystal Ball
+struct  GCheckCrystals
+{
+    Int_t   a;      // central crystal
+    Int_t   b;      // closest crystal to a
+    Int_t   d;      // neighbour of b, but not of a
+    Int_t   f;      // far from a
+};
+
+// direction of a track with the angles of a crystal
+static GP4  Direction(const Int_t crystal)
+{
+    const Double_t  theta   = GDetectorGeometry::GetTheta(crystal)*TMath::DegToRad();
+    const Double_t  phi     = GDetectorGeometry::GetPhi(crystal)*TMath::DegToRad();
+    return GKinematics::FromAngles(1.0, 0.0, TMath::Sin(theta), TMath::Cos(theta), TMath::Sin(phi), TMath::Cos(phi));
+}
+
+// energies of the split event (MeV)
+static const Double_t   splitEnergy[3]  = {200, 20, 100};   // a, b, d
+static const Double_t   splitCluster    = 400;
+
+/**
+ * @brief Neighbour tables and the known events of GReclustering, run
+ *        through GTreeManager on a small generated input file.
+ */
+class  GCheckRecluster : public GTreeManager
+{
+private:
+    GReclustering&  reclustering;
+    GCheckCrystals  crystal;
+    Int_t           nFailed;
+
+    void    Fail(const Int_t event, const char* what);
+    void    Expect(const Int_t event, const char* what, const Double_t value, const Double_t expected);
+    Bool_t  AllLabelled(const Int_t cluster)    const;
+
+protected:
+    virtual void    ProcessEvent()  {}
+    virtual Bool_t  Start();
+
+public:
+    GCheckRecluster(GReclustering& _Reclustering, const GCheckCrystals& _Crystal);
+    virtual ~GCheckRecluster()  {}
+
+            Int_t   GetNFailed()    const   {return nFailed;}
+};
+
+GCheckRecluster::GCheckRecluster(GReclustering& _Reclustering, const GCheckCrystals& _Crystal)  :
+    reclustering(_Reclustering),
+    crystal(_Crystal),
+    nFailed(0)
+{
+}
+
+void    GCheckRecluster::Fail(const Int_t event, const char* what)
+{
+    cout << "ERROR: event " << event << ": " << what << "!" << endl;
+    nFailed++;
+}
+
+void    GCheckRecluster::Expect(const Int_t event, const char* what, const Double_t value, const Double_t expected)
+{
+    if(TMath::Abs(value - expected) <= 1e-6*(1 + TMath::Abs(expected)))
+        return;
+    cout << "ERROR: event " << event << ": " << what << " is " << value << ", expected " << expected << "!" << endl;
+    nFailed++;
+}
+
+Bool_t  GCheckRecluster::AllLabelled(const Int_t cluster)   const
+{
+    for(Int_t i=0; i<GetDetectorHits()->GetNNaIHits(); i++)
+    {
+        if(GetDetectorHits()->GetNaICluster(i) != cluster)
+            return kFALSE;
+    }
+    return kTRUE;
+}
+
+Bool_t  GCheckRecluster::Start()
+{
+    if(!GetTracks()->IsOpenForInput() || !GetDetectorHits()->IsOpenForInput() || GetTracks()->GetNEntries() != N_EVENTS)
+    {
+        cout << "ERROR: the input file does not hold the known events!" << endl;
+        return kFALSE;
+    }
+
+    for(Int_t e=0; e<N_EVENTS; e++)
+    {
+        ReadEntry(e);
+        reclustering.ClearEnergies();
+        if(e == EVENT_SPLIT)
+        {
+            const Int_t     crystals[3] = {crystal.a, crystal.b, crystal.d};
+            const Float_t   energies[3] = {Float_t(splitEnergy[0]), Float_t(splitEnergy[1]), Float_t(splitEnergy[2])};
+            reclustering.SetEnergies(3, crystals, energies, 0, GDetectorGeometry::N_NaI, 1);
+        }
+        const Int_t change  = reclustering.Run(*GetTracks(), *GetDetectorHits());
+        const GTreeTrack*   tracks  = GetTracks();
+
+        switch(e)
+        {
+        case EVENT_MERGE:
+        {
+            // energy weighted direction of the two tracks
+            const GP4       u   = Direction(crystal.a);
+            const GP4       v   = Direction(crystal.b);
+            const Double_t  x   = 300*u.px + 10*v.px;
+            const Double_t  y   = 300*u.py + 10*v.py;
+            const Double_t  z   = 300*u.pz + 10*v.pz;
+            Expect(e, "change of the number of tracks", change, -1);
+            Expect(e, "number of tracks", tracks->GetNTracks(), 1);
+            if(tracks->GetNTracks() != 1)   break;
+            Expect(e, "cluster energy", tracks->GetClusterEnergy(0), 310);
+            Expect(e, "theta", tracks->GetTheta(0), TMath::ATan2(TMath::Sqrt(x*x + y*y), z)*TMath::RadToDeg());
+            Expect(e, "phi", tracks->GetPhi(0), TMath::ATan2(y, x)*TMath::RadToDeg());
+            Expect(e, "central crystal", tracks->GetCentralCrystal(0), crystal.a);
+            Expect(e, "cluster size", tracks->GetClusterSize(0), 3);
+            if(!AllLabelled(crystal.a))
+                Fail(e, "the hits of the split-off are not relabelled to the merged cluster");
+            break;
+        }
+        case EVENT_CHARGED:
+        case EVENT_SEPARATE:
+            Expect(e, "change of the number of tracks", change, 0);
+            Expect(e, "number of tracks", tracks->GetNTracks(), 2);
+            if(tracks->GetNTracks() != 2)   break;
+            Expect(e, "cluster energy 0", tracks->GetClusterEnergy(0), 300);
+            Expect(e, "cluster energy 1", tracks->GetClusterEnergy(1), 10);
+            break;
+        case EVENT_SPLIT:
+        {
+            // b climbs to a, d is a maximum of its own
+            const Double_t  total   = splitEnergy[0] + splitEnergy[1] + splitEnergy[2];
+            const Double_t  x       = splitEnergy[0]*GDetectorGeometry::UnitX[crystal.a] + splitEnergy[1]*GDetectorGeometry::UnitX[crystal.b];
+            const Double_t  y       = splitEnergy[0]*GDetectorGeometry::UnitY[crystal.a] + splitEnergy[1]*GDetectorGeometry::UnitY[crystal.b];
+            const Double_t  z       = splitEnergy[0]*GDetectorGeometry::UnitZ[crystal.a] + splitEnergy[1]*GDetectorGeometry::UnitZ[crystal.b];
+            Expect(e, "change of the number of tracks", change, 1);
+            Expect(e, "number of tracks", tracks->GetNTracks(), 2);
+            if(tracks->GetNTracks() != 2)   break;
+            Expect(e, "cluster energy 0", tracks->GetClusterEnergy(0), splitCluster*(splitEnergy[0] + splitEnergy[1])/total);
+            Expect(e, "cluster energy 1", tracks->GetClusterEnergy(1), splitCluster*splitEnergy[2]/total);
+            Expect(e, "theta 0", tracks->GetTheta(0), TMath::ATan2(TMath::Sqrt(x*x + y*y), z)*TMath::RadToDeg());
+            Expect(e, "phi 0", tracks->GetPhi(0), TMath::ATan2(y, x)*TMath::RadToDeg());
+            Expect(e, "theta 1", tracks->GetTheta(1), TMath::ATan2(TMath::Sqrt(GDetectorGeometry::UnitX[crystal.d]*GDetectorGeometry::UnitX[crystal.d] + GDetectorGeometry::UnitY[crystal.d]*GDetectorGeometry::UnitY[crystal.d]), GDetectorGeometry::UnitZ[crystal.d])*TMath::RadToDeg());
+            Expect(e, "phi 1", tracks->GetPhi(1), TMath::ATan2(GDetectorGeometry::UnitY[crystal.d], GDetectorGeometry::UnitX[crystal.d])*TMath::RadToDeg());
+            Expect(e, "central crystal 0", tracks->GetCentralCrystal(0), crystal.a);
+            Expect(e, "central crystal 1", tracks->GetCentralCrystal(1), crystal.d);
+            Expect(e, "cluster size 0", tracks->GetClusterSize(0), 2);
+            Expect(e, "cluster size 1", tracks->GetClusterSize(1), 1);
+            for(Int_t i=0; i<GetDetectorHits()->GetNNaIHits(); i++)
+            {
+                const Int_t expected    = GetDetectorHits()->GetNaIHits(i) == crystal.d ? crystal.d : crystal.a;
+                if(GetDetectorHits()->GetNaICluster(i) != expected)
+                    Fail(e, "a hit is not labelled with the central crystal of its part");
+            }
+            break;
+        }
+        }
+    }
+    return kTRUE;
+}
+
+/**
+ * @brief the tables must be symmetric, within one detector and hold the
+ *        closest crystal
+ * @return number of errors
+ */
+static Int_t    CheckNeighbours(const GReclustering& reclustering, const Int_t first, const Int_t n, const char* name)
+{
+    Int_t   nFailed = 0;
+    Int_t   minN    = GReclustering::MAX_NEIGHBOURS;
+    Int_t   maxN    = 0;
+    Long64_t    sumN    = 0;
+    for(Int_t i=first; i<first+n; i++)
+    {
+        const Int_t     nNb = reclustering.GetNNeighbours(i);
+        const Short_t*  nb  = reclustering.GetNeighbours(i);
+        minN    = TMath::Min(minN, nNb);
+        maxN    = TMath::Max(maxN, nNb);
+        sumN    += nNb;
+
+        Int_t       closest     = -1;
+        Double_t    closestCos  = -2;
+        for(Int_t j=first; j<first+n; j++)
+        {
+            if(j != i && GDetectorGeometry::GetCosAngle(i, j) > closestCos)
+            {
+                closestCos  = GDetectorGeometry::GetCosAngle(i, j);
+                closest     = j;
+            }
+        }
+        Bool_t  good    = nNb > 0 && reclustering.IsNeighbour(i, closest);
+        for(Int_t k=0; k<nNb; k++)
+        {
+            if(nb[k] == i || nb[k] < first || nb[k] >= first+n || !reclustering.IsNeighbour(nb[k], i))
+                good    = kFALSE;
+        }
+        if(!good)
+        {
+            if(nFailed < 10)
+                cout << "ERROR: neighbours of " << name << " crystal " << i-first << " are not symmetric, in the other detector or miss the closest crystal!" << endl;
+            nFailed++;
+        }
+    }
+    cout << name << ": " << minN << " to " << maxN << " neighbours, " << Double_t(sumN)/n << " on average" << endl;
+    return nFailed;
+}
+
+// the crystals of the known events from the neighbour tables
+static Bool_t   FindCrystals(const GReclustering& reclustering, GCheckCrystals& crystal)
+{
+    crystal.a   = 100;
+    crystal.b   = -1;
+    crystal.d   = -1;
+    crystal.f   = -1;
+    Double_t    closestCos  = -2;
+    for(Int_t j=0; j<GDetectorGeometry::N_NaI; j++)
+    {
+        if(j != crystal.a && GDetectorGeometry::GetCosAngle(crystal.a, j) > closestCos)
+        {
+            closestCos  = GDetectorGeometry::GetCosAngle(crystal.a, j);
+            crystal.b   = j;
+        }
+        if(crystal.f < 0 && GDetectorGeometry::GetCosAngle(crystal.a, j) < TMath::Cos(90*TMath::DegToRad()))
+            crystal.f   = j;
+    }
+    for(Int_t k=0; k<reclustering.GetNNeighbours(crystal.b); k++)
+    {
+        const Int_t nb  = reclustering.GetNeighbours(crystal.b)[k];
+        if(nb != crystal.a && !reclustering.IsNeighbour(crystal.a, nb))
+        {
+            crystal.d   = nb;
+            break;
+        }
+    }
+    return crystal.b >= 0 && crystal.d >= 0 && crystal.f >= 0;
+}
+
+// the known events: tracks and detectorHits
+static Bool_t   WriteEvents(const char* fileName, const GCheckCrystals& crystal)
+{
+    TFile   file(fileName, "RECREATE");
+    if(!file.IsOpen())
+        return kFALSE;
+
+    Int_t       nTracks;
+    Double_t    clusterEnergy[CHECK_MAX_TRACKS], theta[CHECK_MAX_TRACKS], phi[CHECK_MAX_TRACKS], time[CHECK_MAX_TRACKS];
+    Int_t       clusterSize[CHECK_MAX_TRACKS], centralCrystal[CHECK_MAX_TRACKS], centralVeto[CHECK_MAX_TRACKS], detectors[CHECK_MAX_TRACKS];
+    Double_t    vetoEnergy[CHECK_MAX_TRACKS], MWPC0Energy[CHECK_MAX_TRACKS], MWPC1Energy[CHECK_MAX_TRACKS];
+    Double_t    pseudoVertexX[CHECK_MAX_TRACKS], pseudoVertexY[CHECK_MAX_TRACKS], pseudoVertexZ[CHECK_MAX_TRACKS];
+    TTree*  tracks  = new TTree("tracks", "tracks");
+    tracks->Branch("nTracks", &nTracks, "nTracks/I");
+    tracks->Branch("clusterEnergy", clusterEnergy, "clusterEnergy[nTracks]/D");
+    tracks->Branch("theta", theta, "theta[nTracks]/D");
+    tracks->Branch("phi", phi, "phi[nTracks]/D");
+    tracks->Branch("time", time, "time[nTracks]/D");
+    tracks->Branch("clusterSize", clusterSize, "clusterSize[nTracks]/I");
+    tracks->Branch("centralCrystal", centralCrystal, "centralCrystal[nTracks]/I");
+    tracks->Branch("centralVeto", centralVeto, "centralVeto[nTracks]/I");
+    tracks->Branch("detectors", detectors, "detectors[nTracks]/I");
+    tracks->Branch("vetoEnergy", vetoEnergy, "vetoEnergy[nTracks]/D");
+    tracks->Branch("MWPC0Energy", MWPC0Energy, "MWPC0Energy[nTracks]/D");
+    tracks->Branch("MWPC1Energy", MWPC1Energy, "MWPC1Energy[nTracks]/D");
+    tracks->Branch("pseudoVertexX", pseudoVertexX, "pseudoVertexX[nTracks]/D");
+    tracks->Branch("pseudoVertexY", pseudoVertexY, "pseudoVertexY[nTracks]/D");
+    tracks->Branch("pseudoVertexZ", pseudoVertexZ, "pseudoVertexZ[nTracks]/D");
+
+    Int_t       nNaIHits, nPIDHits = 0, nMWPCHits = 0, nBaF2Hits = 0, nVetoHits = 0;
+    Int_t       NaIHits[CHECK_MAX_HITS], NaICluster[CHECK_MAX_HITS];
+    Int_t       PIDHits[1], MWPCHits[1], BaF2Hits[1], BaF2Cluster[1], VetoHits[1];
+    TTree*  hits    = new TTree("detectorHits", "detectorHits");
+    hits->Branch("nNaIHits", &nNaIHits, "nNaIHits/I");
+    hits->Branch("NaIHits", NaIHits, "NaIHits[nNaIHits]/I");
+    hits->Branch("NaICluster", NaICluster, "NaICluster[nNaIHits]/I");
+    hits->Branch("nPIDHits", &nPIDHits, "nPIDHits/I");
+    hits->Branch("PIDHits", PIDHits, "PIDHits[nPIDHits]/I");
+    hits->Branch("nMWPCHits", &nMWPCHits, "nMWPCHits/I");
+    hits->Branch("MWPCHits", MWPCHits, "MWPCHits[nMWPCHits]/I");
+    hits->Branch("nBaF2Hits", &nBaF2Hits, "nBaF2Hits/I");
+    hits->Branch("BaF2Hits", BaF2Hits, "BaF2Hits[nBaF2Hits]/I");
+    hits->Branch("BaF2Cluster", BaF2Cluster, "BaF2Cluster[nBaF2Hits]/I");
+    hits->Branch("nVetoHits", &nVetoHits, "nVetoHits/I");
+    hits->Branch("VetoHits", VetoHits, "VetoHits[nVetoHits]/I");
+
+    for(Int_t e=0; e<N_EVENTS; e++)
+    {
+        // track 0 at a with 300 MeV, track 1 with 10 MeV at b or f;
+        // the split event has one track at a with the crystals a, b and d
+        const Int_t     second      = e == EVENT_SEPARATE ? crystal.f : crystal.b;
+        const Int_t     central[2]  = {crystal.a, second};
+        const Double_t  energy[2]   = {e == EVENT_SPLIT ? splitCluster : 300, 10};
+        nTracks     = e == EVENT_SPLIT ? 1 : 2;
+        for(Int_t i=0; i<nTracks; i++)
+        {
+            clusterEnergy[i]    = energy[i];
+            theta[i]            = GDetectorGeometry::GetTheta(central[i]);
+            phi[i]              = GDetectorGeometry::GetPhi(central[i]);
+            time[i]             = 0;
+            clusterSize[i]      = e == EVENT_SPLIT ? 3 : 2-i;
+            centralCrystal[i]   = central[i];
+            centralVeto[i]      = -1;
+            detectors[i]        = GTreeTrack::DETECTOR_NaI;
+            vetoEnergy[i]       = e == EVENT_CHARGED && i == 1 ? 1 : 0;
+            MWPC0Energy[i]      = 0;
+            MWPC1Energy[i]      = 0;
+            pseudoVertexX[i]    = 0;
+            pseudoVertexY[i]    = 0;
+            pseudoVertexZ[i]    = 0;
+        }
+        if(e == EVENT_CHARGED)
+            detectors[1]    |= GTreeTrack::DETECTOR_PID;
+
+        // a and b (or f) for the two tracks, a, b and d for the split one
+        nNaIHits    = 0;
+        NaIHits[nNaIHits]       = crystal.a;
+        NaICluster[nNaIHits++]  = crystal.a;
+        if(e == EVENT_SPLIT)
+        {
+            NaIHits[nNaIHits]       = crystal.b;
+            NaICluster[nNaIHits++]  = crystal.a;
+            NaIHits[nNaIHits]       = crystal.d;
+            NaICluster[nNaIHits++]  = crystal.a;
+        }
+        else
+        {
+            NaIHits[nNaIHits]       = second;
+            NaICluster[nNaIHits++]  = second;
+        }
+        tracks->Fill();
+        hits->Fill();
+    }
+    file.Write();
+    file.Close();
+    return kTRUE;
+}
+
+/**
+ * @brief checks the neighbour tables of GReclustering and its merge and
+ *        split of known events
+ * @param argc number of parameters
+ * @param argv none
+ * @return exit code, 1 if a check failed
+ */
+int main(int argc, char *argv[])
+{
+    GReclustering   reclustering(CHECK_MAX_ENERGY, CHECK_MAX_ANGLE, CHECK_SPLIT_ENERGY);
+    Int_t           nFailed = 0;
+    nFailed += CheckNeighbours(reclustering, 0, GDetectorGeometry::N_NaI, "Crystal Ball");
+    nFailed += CheckNeighbours(reclustering, GDetectorGeometry::TAPS_OFFSET, GDetectorGeometry::N_TAPS, "TAPS");
+
+    GCheckCrystals  crystal;
+    if(!FindCrystals(reclustering, crystal))
+    {
+        cout << "ERROR: no crystals for the known events!" << endl;
+        return 1;
+    }
+    cout << "known events with the Crystal Ball crystals " << crystal.a << ", " << crystal.b << " (closest), " << crystal.d << " (next) and " << crystal.f << " (far)" << endl;
+
+    TString inputFile   = TString::Format("%s/goat-check-recluster-%d-in.root", gSystem->TempDirectory(), gSystem->GetPid());
+    TString outputFile  = TString::Format("%s/goat-check-recluster-%d-out.root", gSystem->TempDirectory(), gSystem->GetPid());
+    if(!WriteEvents(inputFile.Data(), crystal))
+    {
+        cout << "ERROR: can not write " << inputFile << "!" << endl;
+        return 1;
+    }
+
+    GCheckRecluster check(reclustering, crystal);
+    Bool_t  ok  = check.StartFile(inputFile.Data(), outputFile.Data());
+    gSystem->Unlink(inputFile.Data());
+    gSystem->Unlink(outputFile.Data());
+    nFailed += check.GetNFailed();
+
+    cout << nFailed << " checks failed." << endl;
+    return (ok && nFailed == 0) ? 0 : 1;
+}
+
+#endif
@@ -24,18 +24,18 @@ int main(int argc, char *argv[])
     if(!analysis->BaseConfig(argc, argv, "Acqu", "GoAT"))
     {
         system("man ./documents/goat.man");
-        return 0;
+        return 1;
     }
 
     // Perform full initialisation
     if(!analysis->Init())
     {
         cout << "ERROR: Init failed!" << endl;
-        return 0;
+        return 1;
     }
 
     // Run over files
-    analysis->TraverseFiles();
+    Bool_t  ok  = analysis->TraverseFiles();
 
     end = clock();
     cout << endl;
@@ -45,7 +45,7 @@ int main(int argc, char *argv[])
 
     if(analysis) delete analysis;
 
-    return 0;
+    return ok ? 0 : 1;
 }
 
 #endif
@@ -0,0 +1,46 @@
+#ifndef __CINT__
+
+#include "GFileMerger.h"
+#include <thread>
+#include <time.h>
+
+using namespace std;
+
+/**
+ * @brief the main routine
+ * @param argc number of parameters
+ * @param argv the parameters as strings
+ * @return exit code
+ */
+int main(int argc, char *argv[])
+{
+    Int_t   nWorkers    = std::thread::hardware_concurrency();
+    Int_t   fanIn       = 8;
+    Bool_t  force       = kFALSE;
+    std::string output  = "";
+    std::vector<std::string>    inputs;
+
+    for(Int_t i=1; i<argc; i++)
+    {
+        if(strcmp(argv[i], "-j") == 0 && i+1<argc)              nWorkers = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--fan-in") == 0 && i+1<argc)   fanIn = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--force") == 0)                force = kTRUE;
+        else if(output.length() == 0)                           output = argv[i];
+        else                                                    inputs.push_back(argv[i]);
+    }
+    if(output.length() == 0 || inputs.empty())
+    {
+        cout << "Usage: goat-merge [-j workers] [--fan-in files] [--force] output.root input1.root input2.root ..." << endl;
+        return 1;
+    }
+
+    time_t  start   = time(0);
+    GFileMerger merger(nWorkers, fanIn);
+    merger.SetForce(force);
+    Bool_t  ok  = merger.Merge(inputs, output);
+    cout << "Wall time: " << time(0)-start << " seconds." << endl;
+
+    return ok ? 0 : 1;
+}
+
+#endif
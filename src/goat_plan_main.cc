@@ -0,0 +1,53 @@
+#ifndef __CINT__
+
+#include "GChunkPlanner.h"
+#include <fstream>
+
+using namespace std;
+
+/**
+ * @brief the main routine
+ * @param argc number of parameters
+ * @param argv the parameters as strings
+ * @return exit code
+ */
+int main(int argc, char *argv[])
+{
+    // Create instance of planner
+    GChunkPlanner* planner = new GChunkPlanner;
+
+    // Strip the planner options, pass everything else to the basic configuration
+    std::string planFile = "";
+    Int_t   nArgs = 1;
+    for(Int_t i=1; i<argc; i++)
+    {
+        if(strcmp(argv[i], "--chunks") == 0 && i+1<argc)                planner->SetNChunks(atoi(argv[++i]));
+        else if(strcmp(argv[i], "--events-per-chunk") == 0 && i+1<argc) planner->SetEventsPerChunk(atoi(argv[++i]));
+        else if(strcmp(argv[i], "--plan") == 0 && i+1<argc)             planFile = argv[++i];
+        else argv[nArgs++] = argv[i];
+    }
+
+    // Perform basic configuration
+    if(!planner->BaseConfig(nArgs, argv, "Acqu", "GoAT"))
+    {
+        system("man ./documents/goat.man");
+        return 1;
+    }
+    planner->SetArguments(nArgs, argv);
+
+    Bool_t  ok;
+    if(planFile.length() > 0)
+    {
+        ofstream out(planFile.c_str());
+        ok = planner->Plan(out);
+        if(ok) cout << "Plan written to " << planFile << endl;
+    }
+    else
+        ok = planner->Plan(cout);
+
+    if(planner) delete planner;
+
+    return ok ? 0 : 1;
+}
+
+#endif
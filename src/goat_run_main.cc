@@ -0,0 +1,79 @@
+#ifndef __CINT__
+
+#include "GWorkerPool.h"
+#include <thread>
+#include <time.h>
+
+using namespace std;
+
+/**
+ * @brief the main routine
+ * @param argc number of parameters
+ * @param argv the parameters as strings
+ * @return exit code
+ */
+int main(int argc, char *argv[])
+{
+    // Create instance of planner
+    GChunkPlanner* planner = new GChunkPlanner;
+
+    // goat is expected next to goat-run, otherwise in the PATH
+    std::string executable  = argv[0];
+    std::string merger      = argv[0];
+    if(executable.find_last_of("/") != std::string::npos)
+    {
+        executable  = executable.substr(0, executable.find_last_of("/")+1) + "goat";
+        merger      = merger.substr(0, merger.find_last_of("/")+1) + "goat-merge";
+    }
+    else
+    {
+        executable  = "goat";
+        merger      = "goat-merge";
+    }
+
+    // Strip the runner options, pass everything else to the basic configuration
+    Int_t   nWorkers    = std::thread::hardware_concurrency();
+    Int_t   nChunks     = 0;
+    Int_t   nEventsPerChunk = 0;
+    Int_t   nRetries    = 2;
+    Int_t   nArgs = 1;
+    for(Int_t i=1; i<argc; i++)
+    {
+        if(strcmp(argv[i], "-j") == 0 && i+1<argc)                      nWorkers = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--chunks") == 0 && i+1<argc)           nChunks = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--events-per-chunk") == 0 && i+1<argc) nEventsPerChunk = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--retries") == 0 && i+1<argc)          nRetries = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--exe") == 0 && i+1<argc)              executable = argv[++i];
+        else argv[nArgs++] = argv[i];
+    }
+    if(nWorkers<1)
+        nWorkers    = 1;
+
+    // Perform basic configuration
+    if(!planner->BaseConfig(nArgs, argv, "Acqu", "GoAT"))
+    {
+        system("man ./documents/goat.man");
+        return 1;
+    }
+    planner->SetArguments(nArgs, argv);
+
+    // a few chunks per worker leave room for balancing
+    if(nEventsPerChunk>0)
+        planner->SetEventsPerChunk(nEventsPerChunk);
+    else if(nChunks>0)
+        planner->SetNChunks(nChunks);
+    else
+        planner->SetNChunks(4*nWorkers);
+
+    time_t  start   = time(0);
+    GWorkerPool pool(planner, executable, nWorkers, nRetries);
+    pool.SetMerger(merger);
+    Bool_t  ok  = pool.Run();
+    cout << endl << "Wall time: " << time(0)-start << " seconds." << endl;
+
+    if(planner) delete planner;
+
+    return ok ? 0 : 1;
+}
+
+#endif